@@ -8,6 +8,7 @@ runtime/parrot/languages/JSON/JSON.pir: compilers/data_json/JSON.nqp $(NQP_RX)
 	@$(ADDGENERATED) "$@" "[data_json]"
 
 compilers/data_json/data_json.pbc : \
+    compilers/data_json/data_json.pir \
     $(LIBRARY_DIR)/PGE.pbc \
     $(LIBRARY_DIR)/PGE/Util.pbc \
     $(LIBRARY_DIR)/TGE.pbc \
@@ -24,6 +24,23 @@ example:
 will create a PMC that C<does> C<array> containing the values 1, 2, and 3,
 and store it in the C<result>.
 
+The text is decoded by the C<JSONCodec> PMC from the F<jsoncodec> dynamic
+library, which builds the values in one pass as soon as C<compile> is called.
+The first call of the returned sub hands out those values, later calls decode
+the text again so that every call gets values of its own. With
+C<< target => 'pir' >>, or if the library can't be loaded, C<compile> uses the
+PGE grammar and returns the PIR that builds the values instead.
+
+The compiler also has C<decode> and C<encode> methods:
+
+    result = json.'decode'('{"a":[1,2]}')    # or a FileHandle to read from
+    $S0    = json.'encode'(result)           # '{"a":[1,2]}'
+    $S0    = json.'encode'(result, 1)        # indented, as _json does
+
+C<encode> writes the layout of C<_json> from F<JSON.pir>, with strings
+escaped as JSON wants them. Without the library, C<decode> goes through the
+grammar as C<compile> does, and C<encode> calls C<_json> itself.
+
 For more information about the structure of the JSON representation, see
 the documentation at L<http://www.json.org/>.
 
@@ -51,6 +68,14 @@ the documentation at L<http://www.json.org/>.
     $P1['\t'] = "\t"
 
     set_root_global ['parrot'; 'data_json'], '$escapes', $P1
+
+    null $P1
+    push_eh no_codec
+      $P0 = loadlib 'jsoncodec'
+      $P1 = new ['JSONCodec']
+    pop_eh
+  no_codec:
+    set_root_global ['parrot'; 'data_json'], '$codec', $P1
 .end
 
 
@@ -60,6 +85,22 @@ the documentation at L<http://www.json.org/>.
     .param string json_string
     .param pmc    opts :slurpy :named
 
+    .local pmc codec
+    codec = get_root_global ['parrot'; 'data_json'], '$codec'
+    if null codec goto use_grammar
+    $I0 = exists opts['target']
+    if $I0 goto use_grammar
+
+    .local pmc result, source
+    result = codec.'decode'(json_string)
+    source = box json_string
+    .lex '$result', result
+    .lex '$source', source
+    .const 'Sub' decoded = 'decoded'
+    $P0 = newclosure decoded
+    .return ($P0)
+
+  use_grammar:
     .local pmc parse, match
     parse = get_root_global ['parrot'; 'JSON'], 'value'
 
@@ -94,6 +135,54 @@ the documentation at L<http://www.json.org/>.
     throw $P0
 .end
 
+.sub 'decoded' :anon :outer('compile')
+    .local pmc result
+    result = find_lex '$result'
+    if null result goto decode_again
+    null $P0
+    store_lex '$result', $P0
+    .return (result)
+
+  decode_again:
+    $P0 = find_lex '$source'
+    $P1 = get_root_global ['parrot'; 'data_json'], '$codec'
+    .tailcall $P1.'decode'($P0)
+.end
+
+.sub 'decode' :method
+    .param pmc source
+    $P0 = get_root_global ['parrot'; 'data_json'], '$codec'
+    if null $P0 goto use_grammar
+    .tailcall $P0.'decode'(source)
+
+  use_grammar:
+    $I0 = isa source, 'Handle'
+    unless $I0 goto have_text
+    source = source.'readall'()
+  have_text:
+    $S0 = source
+    $P0 = self.'compile'($S0)
+    .tailcall $P0()
+.end
+
+.sub 'encode' :method
+    .param pmc value
+    .param int pretty     :optional
+    .param int has_pretty :opt_flag
+    if has_pretty goto done_init
+    pretty = 0
+
+  done_init:
+    $P0 = get_root_global ['parrot'; 'data_json'], '$codec'
+    if null $P0 goto use_json
+    .tailcall $P0.'encode'(value, pretty)
+
+  use_json:
+    load_bytecode 'JSON.pbc'
+    $P0 = get_root_global ['parrot'], '_json'
+    .tailcall $P0(value, pretty)
+.end
+
 
 .HLL 'parrot'
 
@@ -202,6 +202,55 @@ imcc_preprocess_file_api(Parrot_PMC interp_pmc, Parrot_PMC compiler,
     IMCC_API_CALLOUT(interp_pmc, interp)
 }
 
+/*
+
+=item C<Parrot_Int imcc_set_optimization_level_api(Parrot_PMC interp_pmc,
+Parrot_PMC compiler, const char *opts)>
+
+Set the optimization level of the given IMCCompiler PMC. C<opts> takes the
+same character flags as C<imcc_set_optimization_level>, e.g. C<"1"> or
+C<"2">.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+Parrot_Int
+imcc_set_optimization_level_api(Parrot_PMC interp_pmc, Parrot_PMC compiler,
+        ARGIN(const char *opts))
+{
+    ASSERT_ARGS(imcc_set_optimization_level_api)
+    IMCC_API_CALLIN(interp_pmc, interp)
+    imc_info_t * const imcc = (imc_info_t *)VTABLE_get_pointer(interp, compiler);
+    imcc_set_optimization_level(imcc, opts);
+    IMCC_API_CALLOUT(interp_pmc, interp)
+}
+
+/*
+
+=item C<Parrot_Int imcc_set_verbosity_api(Parrot_PMC interp_pmc, Parrot_PMC
+compiler, Parrot_Int verbose)>
+
+Turn on verbose output, including per-sub register statistics, for the given
+IMCCompiler PMC.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+Parrot_Int
+imcc_set_verbosity_api(Parrot_PMC interp_pmc, Parrot_PMC compiler,
+        Parrot_Int verbose)
+{
+    ASSERT_ARGS(imcc_set_verbosity_api)
+    IMCC_API_CALLIN(interp_pmc, interp)
+    imc_info_t * const imcc = (imc_info_t *)VTABLE_get_pointer(interp, compiler);
+    imcc_set_verbosity(imcc, verbose);
+    IMCC_API_CALLOUT(interp_pmc, interp)
+}
+
 /*
  * Local variables:
  *   c-file-style: "parrot"
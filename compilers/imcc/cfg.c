@@ -250,8 +250,8 @@ check_invoke_type(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit    *unit),
 
 =item C<void find_basic_blocks(imc_info_t *imcc, IMC_Unit *unit, int first)>
 
-Finds all basic blocks in the given IMC_Unit, expanding PCC calls if first is
-true.
+Finds all basic blocks in the given IMC_Unit, expanding PCC calls and the sub's
+parameters if first is true. Only the first pass over a unit may expand them.
 
 =cut
 
@@ -281,7 +281,7 @@ find_basic_blocks(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), int first)
 
     ins = unit->instructions;
 
-    if (unit->type & IMC_PCCSUB) {
+    if (first && (unit->type & IMC_PCCSUB)) {
         IMCC_debug(imcc, DEBUG_CFG, "pcc_sub %s nparams %d\n",
                 ins->symregs[0]->name, ins->symregs[0]->pcc_sub->nargs);
         expand_pcc_sub(imcc, unit, ins);
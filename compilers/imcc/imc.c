@@ -84,14 +84,7 @@ imc_compile_all_units(ARGMOD(imc_info_t * imcc))
     /* All done with compilation, now free all memory allocated
      * for instructions and other structures.  */
     for (unit = imcc->imc_units; unit;) {
-        IMC_Unit    * const unit_next = unit->next;
-        Instruction *ins;
-
-        for (ins = unit->instructions; ins;) {
-            Instruction * const ins_next = ins->next;
-            free_ins(ins);
-            ins = ins_next;
-        }
+        IMC_Unit * const unit_next = unit->next;
 
         imc_free_unit(imcc, unit);
         unit = unit_next;
@@ -145,6 +138,9 @@ imc_cleanup(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(void *yyscanner))
     mem_sys_free(imcc->ghash.data);
     imcc->ghash.data = NULL;
 
+    /* a trailing .namespace leaves this pointing into the ghash just freed */
+    imcc->cur_namespace = NULL;
+
     if (imcc->state)
         imcc->state->file = STRINGNULL;
     imcc->last_unit = NULL;
@@ -263,16 +259,14 @@ imc_free_unit(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 
     imcc->n_comp_units--;
 
-    clear_locals(unit);
+    /* the symbols, along with the instructions, go with the hash's arena */
+    clear_sym_hash(&unit->hash);
 
-    if (unit->_namespace && unit->owns_namespace)
-        free_sym(unit->_namespace);
     if (unit->vtable_name)
         mem_sys_free(unit->vtable_name);
     if (unit->instance_of)
         mem_sys_free(unit->instance_of);
 
-    mem_sys_free(unit->hash.data);
     mem_sys_free(unit);
 }
 
@@ -388,6 +388,7 @@ typedef enum _enum_opt {
     OPT_PRE,
     OPT_CFG  = 0x002,
     OPT_SUB  = 0x004,
+    OPT_SSA  = 0x008,
     OPT_PASM = 0x100,
     OPT_J    = 0x200
 } enum_opt_t;
@@ -473,6 +474,7 @@ struct _imc_info_t {
 
     char                 *macro_buffer;
     Hash                 *macros;
+    Hash                 *op_names;         /* interned op names and formats */
     PackFile_Debug       *debug_seg;
     opcode_t             *pc;
 
@@ -502,6 +504,7 @@ struct _imc_info_t {
     int                   compiler_state;    /* see PBC_* flags */
     int                   verbose;
     int                   seen_main;
+    int                   ran_immediate;     /* an :anon :immediate sub ran */
     int                   unique_count;      /* A compile-time unique value */
     opcode_t              npc;
 };
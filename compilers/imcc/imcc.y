@@ -583,7 +583,7 @@ INS_LABEL(ARGMOD(imc_info_t *imcc), ARGMOD_NULLOK(IMC_Unit *unit),
 {
     ASSERT_ARGS(INS_LABEL)
 
-    Instruction * const ins = _mk_instruction("", "%s:", 1, &r0, 0);
+    Instruction * const ins = _mk_instruction(imcc, unit, "", "%s:", 1, &r0, 0);
     ins->type               = ITLABEL;
     r0->first_ins           = ins;
 
@@ -4508,10 +4508,10 @@ scan_string(macro_frame_t *frame, ARGIN(const char *expansion), void *yyscanner)
     frame->s.next = (parser_state_t *)imcc->frames;
     imcc->frames = frame;
 
-    /* start at the effective *starting line* of the macro */
-    imcc->line   = frame->s.line - 2;
-
     yy_scan_string(expansion,yyscanner);
+
+    /* start at the effective *starting line* of the macro, in its buffer too */
+    yylineno = imcc->line = frame->s.line - 2;
 }
 
 static int
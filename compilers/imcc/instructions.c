@@ -38,35 +38,109 @@ These functions operate over this array and its contents.
 /* HEADERIZER HFILE: compilers/imcc/instructions.h */
 
 /* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static char * intern_op_name(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const char *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+#define ASSERT_ARGS_intern_op_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(name))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
 static const char types[] = "INPS";
 
 /*
 
-=item C<Instruction * _mk_instruction(const char *op, const char *fmt, int n,
-SymReg * const *r, int flags)>
+=item C<static char * intern_op_name(imc_info_t *imcc, const char *name)>
 
-Creates a new instruction
+Returns the compiler's one copy of the op name or format C<name>. There are
+only so many of those, so they're kept until the compiler goes away.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static char *
+intern_op_name(ARGMOD(imc_info_t *imcc), ARGIN(const char *name))
+{
+    ASSERT_ARGS(intern_op_name)
+    char *interned;
+
+    if (!imcc->op_names)
+        imcc->op_names = Parrot_hash_new_cstring_hash(imcc->interp);
+
+    interned = (char *)Parrot_hash_get(imcc->interp, imcc->op_names, name);
+
+    if (!interned) {
+        interned = mem_sys_strdup(name);
+        Parrot_hash_put(imcc->interp, imcc->op_names, interned, interned);
+    }
+
+    return interned;
+}
+
+/*
+
+=item C<void free_op_names(imc_info_t *imcc)>
+
+Frees the op names and formats interned by C<_mk_instruction>.
+
+=cut
+
+*/
+
+void
+free_op_names(ARGMOD(imc_info_t *imcc))
+{
+    ASSERT_ARGS(free_op_names)
+    Hash * const op_names = imcc->op_names;
+
+    if (op_names) {
+        parrot_hash_iterate(op_names,
+            mem_sys_free(_bucket->value););
+        Parrot_hash_destroy(imcc->interp, op_names);
+        imcc->op_names = NULL;
+    }
+}
+
+/*
+
+=item C<Instruction * _mk_instruction(imc_info_t *imcc, IMC_Unit *unit, const
+char *op, const char *fmt, int n, SymReg * const *r, int flags)>
+
+Creates a new instruction in the arena of C<unit>, which frees it along with
+its symbols. An instruction made outside of any unit lasts as long as the
+global symbols.
 
 =cut
 
 */
 
-PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 Instruction *
-_mk_instruction(ARGIN(const char *op), ARGIN(const char *fmt), int n,
+_mk_instruction(ARGMOD(imc_info_t *imcc), ARGMOD_NULLOK(IMC_Unit *unit),
+        ARGIN(const char *op), ARGIN(const char *fmt), int n,
         ARGIN(SymReg * const *r), int flags)
 {
     ASSERT_ARGS(_mk_instruction)
     const size_t reg_space  = (n > 1) ? (sizeof (SymReg *) * (n - 1)) : 0;
+    IMC_Arena   * const arena = unit ? &unit->hash.arena : &imcc->ghash.arena;
     Instruction * const ins =
-        (Instruction*)mem_sys_allocate_zeroed(sizeof (Instruction) + reg_space);
+        (Instruction *)imcc_arena_alloc(arena, sizeof (Instruction) + reg_space);
     int i;
 
-    ins->opname       = mem_sys_strdup(op);
-    ins->format       = mem_sys_strdup(fmt);
+    ins->opname       = intern_op_name(imcc, op);
+    ins->format       = intern_op_name(imcc, fmt);
     ins->symreg_count = n;
 
     for (i = 0; i < n; i++)
@@ -322,7 +396,7 @@ _delete_ins(ARGMOD(IMC_Unit *unit), ARGIN(Instruction *ins))
 
 =item C<Instruction * delete_ins(IMC_Unit *unit, Instruction *ins)>
 
-Delete instruction ins, and then free it.
+Delete instruction ins. Its memory goes with the rest of the unit's.
 
 The instruction following ins is returned.
 
@@ -336,12 +410,7 @@ Instruction *
 delete_ins(ARGMOD(IMC_Unit *unit), ARGMOD(Instruction *ins))
 {
     ASSERT_ARGS(delete_ins)
-    Instruction * next = _delete_ins(unit, ins);
-
-
-    free_ins(ins);
-
-    return next;
+    return _delete_ins(unit, ins);
 }
 
 /*
@@ -432,11 +501,9 @@ prepend_ins(ARGMOD(IMC_Unit *unit), ARGMOD_NULLOK(Instruction *ins),
 
 /*
 
-=item C<void subst_ins(IMC_Unit *unit, Instruction *ins, Instruction *tmp, int
-needs_freeing)>
+=item C<void subst_ins(IMC_Unit *unit, Instruction *ins, Instruction *tmp)>
 
 Substitute Instruction C<tmp> for Instruction C<ins>.
-Free C<ins> if C<needs_freeing> is true.
 
 =cut
 
@@ -444,7 +511,7 @@ Free C<ins> if C<needs_freeing> is true.
 
 void
 subst_ins(ARGMOD(IMC_Unit *unit), ARGMOD(Instruction *ins),
-          ARGMOD(Instruction *tmp), int needs_freeing)
+          ARGMOD(Instruction *tmp))
 {
     ASSERT_ARGS(subst_ins)
     Instruction * const prev = ins->prev;
@@ -465,9 +532,6 @@ subst_ins(ARGMOD(IMC_Unit *unit), ARGMOD(Instruction *ins),
 
     if (tmp->line == 0)
         tmp->line = ins->line;
-
-    if (needs_freeing)
-        free_ins(ins);
 }
 
 /*
@@ -529,25 +593,6 @@ emitb(ARGMOD(imc_info_t * imcc), ARGMOD_NULLOK(IMC_Unit *unit),
 
 /*
 
-=item C<void free_ins(Instruction *ins)>
-
-Free the Instruction structure ins.
-
-=cut
-
-*/
-
-void
-free_ins(ARGMOD(Instruction *ins))
-{
-    ASSERT_ARGS(free_ins)
-    mem_sys_free(ins->format);
-    mem_sys_free(ins->opname);
-    mem_sys_free(ins);
-}
-
-/*
-
 =item C<int ins_print(imc_info_t * imcc, PIOHANDLE io, const Instruction *ins)>
 
 Print details of instruction ins in file fd.
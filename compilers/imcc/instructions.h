@@ -81,17 +81,21 @@ Instruction * _delete_ins(ARGMOD(IMC_Unit *unit), ARGIN(Instruction *ins))
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*unit);
 
-PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 Instruction * _mk_instruction(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD_NULLOK(IMC_Unit *unit),
     ARGIN(const char *op),
     ARGIN(const char *fmt),
     int n,
     ARGIN(SymReg * const *r),
     int flags)
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(4);
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -126,9 +130,9 @@ Instruction * emitb(
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(*unit);
 
-void free_ins(ARGMOD(Instruction *ins))
+void free_op_names(ARGMOD(imc_info_t *imcc))
         __attribute__nonnull__(1)
-        FUNC_MODIFIES(*ins);
+        FUNC_MODIFIES(*imcc);
 
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -193,8 +197,7 @@ void prepend_ins(
 void subst_ins(
     ARGMOD(IMC_Unit *unit),
     ARGMOD(Instruction *ins),
-    ARGMOD(Instruction *tmp),
-    int needs_freeing)
+    ARGMOD(Instruction *tmp))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         __attribute__nonnull__(3)
@@ -206,7 +209,8 @@ void subst_ins(
        PARROT_ASSERT_ARG(unit) \
     , PARROT_ASSERT_ARG(ins))
 #define ASSERT_ARGS__mk_instruction __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(op) \
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(op) \
     , PARROT_ASSERT_ARG(fmt) \
     , PARROT_ASSERT_ARG(r))
 #define ASSERT_ARGS_delete_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -221,8 +225,8 @@ void subst_ins(
        PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_emitb __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc))
-#define ASSERT_ARGS_free_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_free_op_names __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_get_branch_reg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(ins))
 #define ASSERT_ARGS_get_branch_regno __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -258,7 +262,7 @@ void subst_ins(
  * please use INS
  */
 #ifndef _PARSER
-#  define _mk_instruction(a, b, n, c, d) dont_use_this_function((a), (b))
+#  define _mk_instruction(i, u, a, b, n, c, d) dont_use_this_function((a), (b))
 #endif
 /* This macro must come after the declaration of _mk_instruction() */
 
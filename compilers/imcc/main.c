@@ -56,6 +56,97 @@ static void do_pre_process(
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * imcc_cache_append(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(STRING *id),
+    ARGIN(STRING *text))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc);
+
+static void imcc_cache_define_macro(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const char *name),
+    ARGIN(const params_t *params),
+    ARGIN(const char *expansion),
+    int line)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*imcc);
+
+static void imcc_cache_field(
+    ARGMOD(char **buf),
+    ARGMOD(size_t *len),
+    ARGIN(const char *field))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*buf)
+        FUNC_MODIFIES(*len);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * imcc_cache_id(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(STRING *source),
+    int is_file,
+    int is_pasm)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * imcc_cache_includes(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(STRING *id),
+    ARGIN(STRING *text),
+    ARGMOD(Hash *seen))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*seen);
+
+static size_t imcc_cache_macros(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(char **buf),
+    ARGMOD(size_t *len))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*buf)
+        FUNC_MODIFIES(*len);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * imcc_cache_read_file(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+static void imcc_cache_restore(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(STRING *state))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * imcc_cache_state(ARGMOD(imc_info_t *imcc))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*imcc);
+
 static void imcc_destroy_macro_values(ARGMOD(void *value))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*value);
@@ -70,7 +161,8 @@ static PMC * imcc_run_compilation_internal(
     ARGMOD(imc_info_t *imcc),
     ARGIN(STRING *source),
     int is_file,
-    int is_pasm)
+    int is_pasm,
+    ARGIN_NULLOK(STRING *cache_id))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc);
@@ -94,6 +186,39 @@ static struct _imc_info_t* prepare_reentrant_compile(
 #define ASSERT_ARGS_do_pre_process __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(sourcefile))
+#define ASSERT_ARGS_imcc_cache_append __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(id) \
+    , PARROT_ASSERT_ARG(text))
+#define ASSERT_ARGS_imcc_cache_define_macro __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(params) \
+    , PARROT_ASSERT_ARG(expansion))
+#define ASSERT_ARGS_imcc_cache_field __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(len) \
+    , PARROT_ASSERT_ARG(field))
+#define ASSERT_ARGS_imcc_cache_id __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(source))
+#define ASSERT_ARGS_imcc_cache_includes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(id) \
+    , PARROT_ASSERT_ARG(text) \
+    , PARROT_ASSERT_ARG(seen))
+#define ASSERT_ARGS_imcc_cache_macros __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(buf) \
+    , PARROT_ASSERT_ARG(len))
+#define ASSERT_ARGS_imcc_cache_read_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_imcc_cache_restore __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(state))
+#define ASSERT_ARGS_imcc_cache_state __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc))
 #define ASSERT_ARGS_imcc_destroy_macro_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(value))
 #define ASSERT_ARGS_imcc_get_scanner __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -150,9 +275,11 @@ imcc_reset(ARGMOD(imc_info_t *imcc))
     ASSERT_ARGS(imcc_reset)
     Interp * interp = imcc->interp;
     Hash * macros = imcc->macros;
+    Hash * op_names = imcc->op_names;
     memset(imcc, 0, sizeof (imc_info_t));
     imcc->interp = interp;
     imcc->macros = macros;
+    imcc->op_names = op_names;
 }
 
 /*
@@ -263,6 +390,10 @@ imcc_set_optimization_level(ARGMOD(imc_info_t *imcc), ARGIN(const char *opts))
     if (strchr(opts, '2')) {
         imcc->optimizer_level |= (OPT_PRE | OPT_CFG);
     }
+    /* the SSA passes don't need the constant propagation of -O2 */
+    if (strchr(opts, '3')) {
+        imcc->optimizer_level |= (OPT_PRE | OPT_SSA);
+    }
 }
 
 /*
@@ -495,7 +626,33 @@ imcc_run_compilation_reentrant(ARGMOD(imc_info_t *imcc), ARGIN(STRING *fullname)
 {
     ASSERT_ARGS(imcc_run_compilation_reentrant)
     struct _imc_info_t * const imcc_use = prepare_reentrant_compile(imcc);
-    PMC * const result = imcc_run_compilation_internal(imcc_use, fullname, is_file, is_pasm);
+
+    STRING        *cache_id = STRINGNULL;
+    PMC           *result   = PMCNULL;
+
+    /* nested compiles see the outer one's constants, so aren't cached */
+    if (imcc_use == imcc) {
+        /* the source is scanned in place, so it must not move */
+        Parrot_block_GC_mark(imcc->interp);
+        cache_id = imcc_cache_id(imcc, fullname, is_file, is_pasm);
+        Parrot_unblock_GC_mark(imcc->interp);
+    }
+
+    if (!STRING_IS_NULL(cache_id)) {
+        STRING *state = STRINGNULL;
+        result = Parrot_pf_cache_find(imcc->interp, cache_id,
+                    is_file ? fullname : STRINGNULL, &state);
+        if (!PMC_IS_NULL(result)) {
+            Parrot_block_GC_mark(imcc->interp);
+            imcc_cache_restore(imcc, state);
+            Parrot_unblock_GC_mark(imcc->interp);
+        }
+    }
+
+    if (PMC_IS_NULL(result))
+        result = imcc_run_compilation_internal(imcc_use, fullname, is_file, is_pasm,
+                    cache_id);
+
     exit_reentrant_compile(imcc, imcc_use);
     return result;
 }
@@ -503,11 +660,12 @@ imcc_run_compilation_reentrant(ARGMOD(imc_info_t *imcc), ARGIN(STRING *fullname)
 /*
 
 =item C<static PMC * imcc_run_compilation_internal(imc_info_t *imcc, STRING
-*source, int is_file, int is_pasm)>
+*source, int is_file, int is_pasm, STRING *cache_id)>
 
 Perform an actual compilation. The input is either a string or a file
 (determined by C<is_file>), and is in either PIR or PASM format (determined by
-C<is_pasm>).
+C<is_pasm>). If C<cache_id> is given, the result is stored in the bytecode
+cache under it.
 
 All compilations go through this function.
 
@@ -519,7 +677,7 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC *
 imcc_run_compilation_internal(ARGMOD(imc_info_t *imcc), ARGIN(STRING *source),
-        int is_file, int is_pasm)
+        int is_file, int is_pasm, ARGIN_NULLOK(STRING *cache_id))
 {
     ASSERT_ARGS(imcc_run_compilation_internal)
     yyscan_t yyscanner = imcc_get_scanner(imcc);
@@ -542,6 +700,7 @@ imcc_run_compilation_internal(ARGMOD(imc_info_t *imcc), ARGIN(STRING *source),
 
     Parrot_pf_set_current_packfile(imcc->interp, packfilepmc);
 
+    imcc->ran_immediate = 0;
     IMCC_push_parser_state(imcc, source, is_file, is_pasm);
 
     success = imcc_compile_buffer_safe(imcc, yyscanner, source, is_file, is_pasm);
@@ -561,6 +720,11 @@ imcc_run_compilation_internal(ARGMOD(imc_info_t *imcc), ARGIN(STRING *source),
 
     IMCC_info(imcc, 1, "%ld lines compiled.\n", imcc->line);
 
+    /* before any of its subs run, as the cache can't replay :immediate ones;
+     * :anon :immediate subs have already run while emitting, so skip those */
+    if (!STRING_IS_NULL(cache_id) && !imcc->ran_immediate)
+        Parrot_pf_cache_store(imcc->interp, cache_id, packfilepmc, imcc_cache_state(imcc));
+
     /* TODO: Do not use this function, it is deprecated (TT #2140). Find a
        better way to handle :immediate and :postcomp subs instead. */
     PackFile_fixup_subs(imcc->interp, PBC_IMMEDIATE, packfilepmc);
@@ -573,6 +737,447 @@ imcc_run_compilation_internal(ARGMOD(imc_info_t *imcc), ARGIN(STRING *source),
 
 /*
 
+=item C<static STRING * imcc_cache_id(imc_info_t *imcc, STRING *source, int
+is_file, int is_pasm)>
+
+Describe everything compiling C<source> depends on, for the bytecode cache:
+the source text or the file's path and contents, the contents of every file it
+C<.include>s, the compiler options, and the macros and HLL left by earlier
+compiles. Returns STRINGNULL if the cache is off, or can't be used for this
+compile.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+imcc_cache_id(ARGMOD(imc_info_t *imcc), ARGIN(STRING *source), int is_file, int is_pasm)
+{
+    ASSERT_ARGS(imcc_cache_id)
+    Interp * const interp = imcc->interp;
+    STRING        *text;
+    STRING        *id;
+    size_t         macros;
+
+    /* diagnostics are only printed while compiling */
+    if (imcc->verbose || imcc->debug || yydebug || !Parrot_pf_cache_enabled(interp))
+        return STRINGNULL;
+
+    if (is_file) {
+        if (Parrot_str_length(interp, source) == 1 && STRING_ord(interp, source, 0) == '-')
+            return STRINGNULL;
+        text = imcc_cache_read_file(imcc, source);
+        if (STRING_IS_NULL(text))
+            return STRINGNULL;
+    }
+    else
+        text = source;
+
+    {
+        char  *table = NULL;
+        size_t len   = 0;
+        macros = imcc_cache_macros(imcc, &table, &len);
+        if (table)
+            mem_sys_free(table);
+    }
+
+    id = Parrot_sprintf_c(interp, "%s %d %d %d %d %d %Ss %lx %s %Ss\n",
+            is_file ? "file" : "string", is_pasm, imcc->optimizer_level,
+            imcc->dont_optimize, imcc->imcc_warn, imcc->seen_main,
+            Parrot_hll_get_HLL_name(interp,
+                Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))),
+            (unsigned long)macros, text->encoding->name,
+            is_file ? source : Parrot_str_new_constant(interp, ""));
+
+    {
+        Hash * const seen = Parrot_hash_new(interp);
+        id = imcc_cache_includes(imcc, imcc_cache_append(imcc, id, text), text, seen);
+        Parrot_hash_destroy(interp, seen);
+    }
+
+    return id;
+}
+
+/*
+
+=item C<static STRING * imcc_cache_includes(imc_info_t *imcc, STRING *id, STRING
+*text, Hash *seen)>
+
+Append the path and contents of each file C<text> includes, and of the files
+they include in turn, to the cache identifier C<id>. The contents of a file
+go in only the first time, which the paths in C<seen> keep track of.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+imcc_cache_includes(ARGMOD(imc_info_t *imcc), ARGIN(STRING *id), ARGIN(STRING *text),
+        ARGMOD(Hash *seen))
+{
+    ASSERT_ARGS(imcc_cache_includes)
+    Interp     * const interp = imcc->interp;
+    const char * const end    = text->strstart + Parrot_str_byte_length(interp, text);
+    const char        *p      = text->strstart;
+
+    while ((p = (const char *)memchr(p, '.', end - p)) != NULL) {
+        const char *q = p + 8;
+        const char *name;
+        char        quote;
+
+        if (end - p < 10 || memcmp(p, ".include", 8) != 0) {
+            ++p;
+            continue;
+        }
+
+        while (q < end && (*q == ' ' || *q == '\t'))
+            ++q;
+        if (q == end || (*q != '"' && *q != '\'')) {
+            p = q;
+            continue;
+        }
+
+        quote = *q++;
+        name  = q;
+        while (q < end && *q != quote && *q != '\n')
+            ++q;
+        if (q == end || *q != quote) {
+            p = q;
+            continue;
+        }
+
+        {
+            STRING * const file = Parrot_str_new(interp, name, q - name);
+            STRING * const path = Parrot_locate_runtime_file_str(interp, file,
+                                        PARROT_RUNTIME_FT_INCLUDE);
+            const int      first = !STRING_IS_NULL(path)
+                                && !Parrot_hash_exists(interp, seen, path);
+            STRING * const body  = first ? imcc_cache_read_file(imcc, path) : STRINGNULL;
+
+            id = Parrot_str_concat(interp, id,
+                    Parrot_sprintf_c(interp, "\n.include %Ss %Ss\n", file,
+                        STRING_IS_NULL(path) ? Parrot_str_new_constant(interp, "missing") : path));
+
+            if (!STRING_IS_NULL(body)) {
+                Parrot_hash_put(interp, seen, path, path);
+                id = imcc_cache_includes(imcc, imcc_cache_append(imcc, id, body), body, seen);
+            }
+        }
+
+        p = q;
+    }
+
+    return id;
+}
+
+/*
+
+=item C<static STRING * imcc_cache_append(imc_info_t *imcc, STRING *id, STRING
+*text)>
+
+Append the bytes of C<text>, whatever its encoding, to the cache identifier
+C<id>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+imcc_cache_append(ARGMOD(imc_info_t *imcc), ARGIN(STRING *id), ARGIN(STRING *text))
+{
+    ASSERT_ARGS(imcc_cache_append)
+    Interp * const interp = imcc->interp;
+
+    return Parrot_str_concat(interp,
+            Parrot_str_new_init(interp, id->strstart,
+                Parrot_str_byte_length(interp, id), Parrot_binary_encoding_ptr, 0),
+            Parrot_str_new_init(interp, text->strstart,
+                Parrot_str_byte_length(interp, text), Parrot_binary_encoding_ptr, 0));
+}
+
+/*
+
+=item C<static STRING * imcc_cache_read_file(imc_info_t *imcc, STRING *path)>
+
+Return the contents of the file C<path> as a binary string, or STRINGNULL if
+it can't be read.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+imcc_cache_read_file(ARGMOD(imc_info_t *imcc), ARGIN(STRING *path))
+{
+    ASSERT_ARGS(imcc_cache_read_file)
+    Interp * const interp = imcc->interp;
+    STRING        *text   = STRINGNULL;
+    PIOHANDLE      io;
+    INTVAL         size;
+    size_t         got    = 0;
+    char          *buf;
+
+    if (!Parrot_file_stat_intval(interp, path, STAT_EXISTS)
+    ||  !Parrot_file_stat_intval(interp, path, STAT_ISREG))
+        return STRINGNULL;
+
+    size = Parrot_file_stat_intval(interp, path, STAT_FILESIZE);
+    io   = Parrot_io_internal_open(interp, path, PIO_F_READ);
+    if (io == PIO_INVALID_HANDLE)
+        return STRINGNULL;
+
+    buf = mem_gc_allocate_n_typed(interp, size + 1, char);
+    while (got < (size_t)size) {
+        const size_t n = Parrot_io_internal_read(interp, io, buf + got, size - got);
+        if (n == 0)
+            break;
+        got += n;
+    }
+    Parrot_io_internal_close(interp, io);
+
+    if (got == (size_t)size)
+        text = Parrot_str_new_init(interp, buf, got, Parrot_binary_encoding_ptr, 0);
+    mem_gc_free(interp, buf);
+    return text;
+}
+
+/*
+
+=item C<static size_t imcc_cache_macros(imc_info_t *imcc, char **buf, size_t
+*len)>
+
+Append the macro table to the malloced buffer C<buf> of C<len> bytes, as
+NUL-terminated fields: for each macro its name, line, parameter count,
+parameter names and expansion. Returns a hash of the table that doesn't
+depend on the order of the macros in it.
+
+=cut
+
+*/
+
+static size_t
+imcc_cache_macros(ARGMOD(imc_info_t *imcc), ARGMOD(char **buf), ARGMOD(size_t *len))
+{
+    ASSERT_ARGS(imcc_cache_macros)
+    size_t digest = 0;
+
+    if (imcc->macros) {
+        Hash * const macros = imcc->macros;
+
+        parrot_hash_iterate(macros,
+            const macro_t * const m     = (const macro_t *)_bucket->value;
+            const size_t          start = *len;
+            char                  num[32];
+            int                   i;
+
+            imcc_cache_field(buf, len, (const char *)_bucket->key);
+            snprintf(num, sizeof (num), "%d", m->line);
+            imcc_cache_field(buf, len, num);
+            snprintf(num, sizeof (num), "%d", m->params.num_param);
+            imcc_cache_field(buf, len, num);
+            for (i = 0; i < m->params.num_param; ++i)
+                imcc_cache_field(buf, len, m->params.name[i]);
+            imcc_cache_field(buf, len, m->expansion);
+
+            digest += Parrot_hash_buffer((const unsigned char *)*buf + start,
+                        *len - start, 0x3c1a5b7d););
+    }
+
+    return digest;
+}
+
+/*
+
+=item C<static void imcc_cache_field(char **buf, size_t *len, const char
+*field)>
+
+Append C<field> and its terminating NUL to the malloced buffer C<buf> of
+C<len> bytes.
+
+=cut
+
+*/
+
+static void
+imcc_cache_field(ARGMOD(char **buf), ARGMOD(size_t *len), ARGIN(const char *field))
+{
+    ASSERT_ARGS(imcc_cache_field)
+    const size_t n = strlen(field) + 1;
+
+    *buf = (char *)mem_sys_realloc(*buf, *len + n);
+    memcpy(*buf + *len, field, n);
+    *len += n;
+}
+
+/*
+
+=item C<static STRING * imcc_cache_state(imc_info_t *imcc)>
+
+Return what a cached compile must restore to leave IMCC as compiling would
+have: whether a C<:main> sub has been seen, the HLL set by C<.HLL>, and the
+macro table.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+imcc_cache_state(ARGMOD(imc_info_t *imcc))
+{
+    ASSERT_ARGS(imcc_cache_state)
+    Interp * const interp = imcc->interp;
+    char   * const hll    = Parrot_str_to_cstring(interp,
+                                Parrot_hll_get_HLL_name(interp,
+                                    Parrot_pcc_get_HLL(interp, CURRENT_CONTEXT(interp))));
+    char          *buf    = NULL;
+    size_t         len    = 0;
+    STRING        *state;
+
+    imcc_cache_field(&buf, &len, imcc->seen_main ? "1" : "0");
+    imcc_cache_field(&buf, &len, hll);
+    Parrot_str_free_cstring(hll);
+    (void)imcc_cache_macros(imcc, &buf, &len);
+
+    state = Parrot_str_new_init(interp, buf, len, Parrot_binary_encoding_ptr, 0);
+    mem_sys_free(buf);
+    return state;
+}
+
+/*
+
+=item C<static void imcc_cache_restore(imc_info_t *imcc, STRING *state)>
+
+Restore the C<state> saved by C<imcc_cache_state> along with a cached
+packfile.
+
+=cut
+
+*/
+
+static void
+imcc_cache_restore(ARGMOD(imc_info_t *imcc), ARGIN(STRING *state))
+{
+    ASSERT_ARGS(imcc_cache_restore)
+    DECL_CONST_CAST;
+    Interp     * const interp = imcc->interp;
+    const size_t       len    = Parrot_str_byte_length(interp, state);
+    const char        *p      = state->strstart;
+    const char * const end    = p + len;
+
+    /* every field ends in a NUL; the cache entry should never be otherwise */
+    if (len < 2 || end[-1] != '\0')
+        return;
+
+    if (*p == '1')
+        imcc->seen_main = 1;
+    p += strlen(p) + 1;
+
+    if (p < end) {
+        STRING * const hll = Parrot_str_new(interp, p, 0);
+        PMC    * const ctx = CURRENT_CONTEXT(interp);
+
+        if (!STRING_equal(interp, hll,
+                Parrot_hll_get_HLL_name(interp, Parrot_pcc_get_HLL(interp, ctx))))
+            Parrot_pcc_set_HLL(interp, ctx, Parrot_hll_register_HLL(interp, hll));
+        p += strlen(p) + 1;
+    }
+
+    while (p < end) {
+        const char *name, *expansion;
+        params_t    params;
+        int         line, i;
+
+        name = p;
+        p   += strlen(p) + 1;
+        if (p >= end)
+            return;
+        line = atoi(p);
+        p   += strlen(p) + 1;
+        if (p >= end)
+            return;
+        params.num_param = atoi(p);
+        p   += strlen(p) + 1;
+        if (params.num_param < 0 || params.num_param > MAX_PARAM)
+            return;
+        for (i = 0; i < params.num_param; ++i) {
+            if (p >= end)
+                return;
+            params.name[i] = PARROT_const_cast(char *, p);
+            p += strlen(p) + 1;
+        }
+        if (p >= end)
+            return;
+        expansion = p;
+        p        += strlen(p) + 1;
+
+        imcc_cache_define_macro(imcc, name, &params, expansion, line);
+    }
+}
+
+/*
+
+=item C<static void imcc_cache_define_macro(imc_info_t *imcc, const char *name,
+const params_t *params, const char *expansion, int line)>
+
+Define the macro C<name> as the lexer's C<.macro> would, copying the strings
+it is given. A macro already defined the same way is left alone.
+
+=cut
+
+*/
+
+static void
+imcc_cache_define_macro(ARGMOD(imc_info_t *imcc), ARGIN(const char *name),
+        ARGIN(const params_t *params), ARGIN(const char *expansion), int line)
+{
+    ASSERT_ARGS(imcc_cache_define_macro)
+    Interp * const interp = imcc->interp;
+    macro_t       *m      = imcc->macros
+                          ? (macro_t *)Parrot_hash_get(interp, imcc->macros, name)
+                          : NULL;
+    int            i;
+
+    if (m) {
+        int same = m->line == line
+                && m->params.num_param == params->num_param
+                && STREQ(m->expansion, expansion);
+
+        for (i = 0; same && i < params->num_param; ++i)
+            same = STREQ(m->params.name[i], params->name[i]);
+        if (same)
+            return;
+
+        for (i = 0; i < m->params.num_param; ++i)
+            mem_sys_free(m->params.name[i]);
+        mem_sys_free(m->expansion);
+    }
+    else {
+        m = mem_gc_allocate_zeroed_typed(interp, macro_t);
+
+        if (!imcc->macros)
+            imcc->macros = Parrot_hash_new_cstring_hash(interp);
+        Parrot_hash_put(interp, imcc->macros, mem_sys_strdup(name), m);
+    }
+
+    for (i = 0; i < params->num_param; ++i)
+        m->params.name[i] = mem_sys_strdup(params->name[i]);
+    m->params.num_param = params->num_param;
+    m->expansion        = mem_sys_strdup(expansion);
+    m->line             = line;
+}
+
+/*
+
 =item C<static struct _imc_info_t* prepare_reentrant_compile(imc_info_t *imcc)>
 
 Prepare IMCC for a reentrant compile. Push a new imc_info_t structure onto the
@@ -616,6 +1221,7 @@ exit_reentrant_compile(ARGIN(imc_info_t *imcc), ARGMOD_NULLOK(struct _imc_info_t
     if (new_info && new_info->prev == imcc) {
         PARROT_ASSERT(imcc == new_info->prev);
         imc_cleanup(new_info, NULL);
+        free_op_names(new_info);
         if (new_info->globals)
             mem_sys_free(new_info->globals);
 
@@ -643,6 +1249,8 @@ imcc_destroy(ARGFREE(imc_info_t * imcc))
     if (macros)
         Parrot_hash_chash_destroy_values(imcc->interp, macros, imcc_destroy_macro_values);
 
+    free_op_names(imcc);
+
     if (imcc->globals)
         mem_sys_free(imcc->globals);
 
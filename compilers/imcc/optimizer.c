@@ -53,6 +53,15 @@ used_once ... deletes assignments, when LHS is unused
 
 constant_propagation
 
+With -O3, symbols that are written once, by an instruction dominating all
+their uses, are already in SSA form; ssa_optimize() runs these passes over
+them:
+
+copy_propagation ... replaces copies by their source
+value_numbering ... deletes ops computing a value already at hand
+loop_invariant_motion ... hoists ops into loop preheaders
+unbox_values ... does Integer and Float PMC arithmetic in native registers
+
 post_optimizer: currently pcc_optimize in pcc.c
 ---------------
 
@@ -75,6 +84,18 @@ e.g. eliminate new Px .PerlUndef because Px where different before
 #include "pmc/pmc_callcontext.h"
 #include "parrot/oplib/core_ops.h"
 
+/* what unbox_values() knows of a PMC boxed from a native value */
+typedef struct Unboxed {
+    Instruction *def;       /* the box op */
+    Instruction *last;      /* where to add ops computing the value */
+    SymReg      *value;     /* holds the boxed value, when known */
+    SymReg      *num;       /* holds it as a float, when needed */
+    int          uses;      /* reads of the PMC left */
+    int          usable;    /* nothing else gets hold of the PMC */
+    int          unboxed;   /* some read now uses the value instead */
+    char         type;      /* 'I' for an Integer, 'N' for a Float */
+} Unboxed;
+
 /* HEADERIZER HFILE: compilers/imcc/optimizer.h */
 
 /* HEADERIZER BEGIN: static */
@@ -86,44 +107,35 @@ static int branch_branch(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
-static int branch_cond_loop(
-    ARGMOD(imc_info_t *imcc),
-    ARGMOD(IMC_Unit *unit))
+PARROT_WARN_UNUSED_RESULT
+static int branch_reorg(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
 PARROT_WARN_UNUSED_RESULT
-static int branch_cond_loop_swap(
-    ARGMOD(imc_info_t *imcc),
-    ARGMOD(IMC_Unit *unit),
-    ARGMOD(Instruction *branch),
-    ARGMOD(Instruction *start),
-    ARGMOD(Instruction *cond))
+static int branches_back(
+    ARGIN(const Instruction *ins),
+    ARGIN(const SymReg *label))
         __attribute__nonnull__(1)
-        __attribute__nonnull__(2)
-        __attribute__nonnull__(3)
-        __attribute__nonnull__(4)
-        __attribute__nonnull__(5)
-        FUNC_MODIFIES(*imcc)
-        FUNC_MODIFIES(*unit)
-        FUNC_MODIFIES(*branch)
-        FUNC_MODIFIES(*start)
-        FUNC_MODIFIES(*cond);
+        __attribute__nonnull__(2);
 
-PARROT_WARN_UNUSED_RESULT
-static int branch_reorg(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+static int constant_propagation(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
-static int constant_propagation(
+static int copy_propagation(
     ARGMOD(imc_info_t *imcc),
-    ARGMOD(IMC_Unit *unit))
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Hash *values))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
@@ -146,18 +158,138 @@ static int eval_ins(
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*imcc);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Hash * find_ssa_values(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(const IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Unboxed * find_unboxed(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(Hash *boxed),
+    ARGIN(const SymReg *r))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc);
+
 static int if_branch(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int ins_dominates(
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const Instruction *a),
+    ARGIN(const Instruction *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static int loop_invariant_motion(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Hash *values))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
+PARROT_CAN_RETURN_NULL
+static SymReg * native_const(
+    ARGMOD(imc_info_t *imcc),
+    ARGIN(SymReg *r),
+    int set)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc);
+
+PARROT_CANNOT_RETURN_NULL
+static SymReg * native_value(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGMOD(Unboxed *u),
+    int set)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*u);
+
+PARROT_WARN_UNUSED_RESULT
+static int pure_op(ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static int reads_value_only(ARGIN(const Instruction *ins), int i)
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static int reassigns_pmc(ARGIN(const Instruction *ins))
+        __attribute__nonnull__(1);
+
+static void replace_uses(
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(const SymReg *from),
+    ARGIN(SymReg *to))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*unit);
+
+PARROT_WARN_UNUSED_RESULT
+static int same_value(
+    ARGIN(const Instruction *a),
+    ARGIN(const Instruction *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int ssa_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
 static int strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+PARROT_CAN_RETURN_NULL
+static Instruction * unbox_ins(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Hash *boxed),
+    ARGMOD(Instruction *ins))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*ins);
+
+static int unbox_values(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Hash *values))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
 PARROT_WARN_UNUSED_RESULT
 static int unused_label(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
@@ -171,24 +303,32 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(*imcc)
         FUNC_MODIFIES(*unit);
 
+static int value_numbering(
+    ARGMOD(imc_info_t *imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGIN(Hash *values))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*imcc)
+        FUNC_MODIFIES(*unit);
+
 #define ASSERT_ARGS_branch_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
-#define ASSERT_ARGS_branch_cond_loop __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(imcc) \
-    , PARROT_ASSERT_ARG(unit))
-#define ASSERT_ARGS_branch_cond_loop_swap __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(imcc) \
-    , PARROT_ASSERT_ARG(unit) \
-    , PARROT_ASSERT_ARG(branch) \
-    , PARROT_ASSERT_ARG(start) \
-    , PARROT_ASSERT_ARG(cond))
 #define ASSERT_ARGS_branch_reorg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_branches_back __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(label))
 #define ASSERT_ARGS_constant_propagation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_copy_propagation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(values))
 #define ASSERT_ARGS_dead_code_remove __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -196,18 +336,69 @@ static int used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(op) \
     , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_find_ssa_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_find_unboxed __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(boxed) \
+    , PARROT_ASSERT_ARG(r))
 #define ASSERT_ARGS_if_branch __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_ins_dominates __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_loop_invariant_motion __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(values))
+#define ASSERT_ARGS_native_const __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_native_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(u))
+#define ASSERT_ARGS_pure_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_reads_value_only __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_reassigns_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_replace_uses __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(from) \
+    , PARROT_ASSERT_ARG(to))
+#define ASSERT_ARGS_same_value __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_ssa_optimize __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_strength_reduce __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_unbox_ins __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(boxed) \
+    , PARROT_ASSERT_ARG(ins))
+#define ASSERT_ARGS_unbox_values __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(values))
 #define ASSERT_ARGS_unused_label __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_used_once __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_value_numbering __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(values))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -259,8 +450,6 @@ cfg_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         IMCC_info(imcc, 2, "cfg_optimize\n");
         if (branch_branch(imcc, unit))
             return 1;
-        if (branch_cond_loop(imcc, unit))
-            return 1;
         if (branch_reorg(imcc, unit))
             return 1;
         if (unused_label(imcc, unit))
@@ -279,6 +468,8 @@ Runs after the CFG is built and handles constant propagation.
 
 used_once ... deletes assignments, when LHS is unused
 
+With -O3 it also runs the SSA passes of ssa_optimize().
+
 =cut
 
 */
@@ -294,6 +485,8 @@ optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
         if (used_once(imcc, unit))
             return 1;
     }
+    if (!any && (imcc->optimizer_level & OPT_SSA))
+        any = ssa_optimize(imcc, unit);
     return any;
 }
 
@@ -339,6 +532,35 @@ get_neg_op(ARGIN(const char *op), ARGOUT(int *n))
  */
 /*
 
+=item C<static int branches_back(const Instruction *ins, const SymReg *label)>
+
+Returns TRUE if C<label> is defined before C<ins>, so that a jump from C<ins>
+to it closes a loop.
+
+Only the C<branch> op lets the scheduler run waiting tasks, so the optimizer
+must not turn such a jump into a conditional one or bypass it: a loop without
+a C<branch> would never yield.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+branches_back(ARGIN(const Instruction *ins), ARGIN(const SymReg *label))
+{
+    ASSERT_ARGS(branches_back)
+
+    for (ins = ins->prev; ins; ins = ins->prev) {
+        if ((ins->type & ITLABEL) && STREQ(ins->symregs[0]->name, label->name))
+            return 1;
+    }
+
+    return 0;
+}
+
+/*
+
 =item C<static int if_branch(imc_info_t *imcc, IMC_Unit *unit)>
 
 Convert if/branch/label constructs of the form:
@@ -351,6 +573,8 @@ to the simpler negated form:
 
   unless cond L2
 
+unless the C<branch> jumps back, closing a loop.
+
 =cut
 
 */
@@ -382,16 +606,15 @@ if_branch(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
                 IMCC_debug(imcc, DEBUG_OPT1, "if_branch %s ... %s\n",
                         last->opname, br_dest->name);
                 /* find the negated op (e.g if->unless, ne->eq ... */
-                if ((neg_op = get_neg_op(last->opname, &args)) != NULL) {
+                if (!branches_back(ins, go)
+                &&  (neg_op = get_neg_op(last->opname, &args)) != NULL) {
                     Instruction * tmp;
                     last->symregs[reg] = go;
                     tmp = INS(imcc, unit, neg_op, "",
                               last->symregs, args, 0, 0);
                     last->op = tmp->op;
                     last->opsize = tmp->opsize;
-                    mem_sys_free(last->opname);
-                    last->opname = mem_sys_strdup(tmp->opname);
-                    free_ins(tmp);
+                    last->opname = tmp->opname;
 
                     /* delete branch */
                     unit->ostat.deleted_ins++;
@@ -487,7 +710,7 @@ strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
             }
             tmp = INS(imcc, unit, ins->opname, "", ins->symregs, 2, 0, 0);
             IMCC_debug(imcc, DEBUG_OPT1, "%d\n", tmp);
-            subst_ins(unit, ins, tmp, 1);
+            subst_ins(unit, ins, tmp);
             ins = tmp;
             changes = 1;
         }
@@ -546,7 +769,7 @@ strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
                 tmp = INS(imcc, unit, "inc", "", ins->symregs, 1, 0, 0);
             else
                 tmp = INS(imcc, unit, "dec", "", ins->symregs, 1, 0, 0);
-            subst_ins(unit, ins, tmp, 1);
+            subst_ins(unit, ins, tmp);
             IMCC_debug(imcc, DEBUG_OPT1, "%d\n", tmp);
             ins = tmp;
             changes = 1;
@@ -600,7 +823,7 @@ strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
             }
             tmp = INS(imcc, unit, "set", "", ins->symregs, 2, 0, 0);
             IMCC_debug(imcc, DEBUG_OPT1, "%d\n", tmp);
-            subst_ins(unit, ins, tmp, 1);
+            subst_ins(unit, ins, tmp);
             ins = tmp;
             changes = 1;
             continue;
@@ -628,7 +851,7 @@ strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
             ins->symregs[1] = r;
             tmp = INS(imcc, unit, "set", "", ins->symregs, 2, 0, 0);
             IMCC_debug(imcc, DEBUG_OPT1, "%d\n", tmp);
-            subst_ins(unit, ins, tmp, 1);
+            subst_ins(unit, ins, tmp);
             ins = tmp;
             changes = 1;
         }
@@ -644,7 +867,7 @@ strength_reduce(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
             IMCC_debug(imcc, DEBUG_OPT1, "opt1 %d => ", ins);
             --ins->symregs[1]->use_count;
             tmp = INS(imcc, unit, "null", "", ins->symregs, 1, 0, 0);
-            subst_ins(unit, ins, tmp, 1);
+            subst_ins(unit, ins, tmp);
             IMCC_debug(imcc, DEBUG_OPT1, "%d\n", tmp);
             ins = tmp;
             changes = 1;
@@ -726,7 +949,7 @@ constant_propagation(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
                             if (found) {
                                 const Instruction * const prev = ins2->prev;
                                 if (prev) {
-                                    subst_ins(unit, ins2, tmp, 1);
+                                    subst_ins(unit, ins2, tmp);
                                     any = 1;
                                     IMCC_debug(imcc, DEBUG_OPT2,
                                             " reduced to %d\n", tmp);
@@ -1105,6 +1328,8 @@ if I0 goto L1  => if IO goto L2
 L1:
 branch L2
 
+A conditional jump is not redirected past a C<branch> closing a loop.
+
 Returns TRUE if any optimizations were performed. Otherwise, returns
 FALSE.
 
@@ -1133,7 +1358,9 @@ branch_branch(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
                 if (next &&
                         (next->type & IF_goto) &&
                         STREQ(next->opname, "branch") &&
-                        !STREQ(next->symregs[0]->name, get_branch_reg(ins)->name)) {
+                        !STREQ(next->symregs[0]->name, get_branch_reg(ins)->name) &&
+                        (STREQ(ins->opname, "branch") ||
+                         !branches_back(next, next->symregs[0]))) {
                     const int regno = get_branch_regno(ins);
                     IMCC_debug(imcc, DEBUG_OPT1,
                             "found branch to branch '%s' %d\n",
@@ -1165,6 +1392,8 @@ L2:           branch L3
 branch L4
 L5:
 
+A C<branch> closing a loop is kept.
+
 Returns TRUE if any optimizations were performed. Otherwise, returns
 FALSE.
 
@@ -1184,11 +1413,12 @@ branch_reorg(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
     for (i = 0; i < unit->n_basic_blocks; i++) {
         Instruction *ins = unit->bb_list[i]->end;
 
-        /* if basic block ends with unconditional jump */
+        /* if basic block ends with unconditional jump, not closing a loop */
         if ((ins->type & IF_goto) && STREQ(ins->opname, "branch")) {
             SymReg * const r = get_sym(imcc, ins->symregs[0]->name);
 
-            if (r && (r->type & VTADDRESS) && r->first_ins) {
+            if (r && (r->type & VTADDRESS) && r->first_ins
+            &&  !branches_back(ins, r)) {
                 Edge               *edge;
                 Instruction * const start = r->first_ins;
                 int                 found = 0;
@@ -1247,172 +1477,6 @@ branch_reorg(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
-=item C<static int branch_cond_loop_swap(imc_info_t *imcc, IMC_Unit *unit,
-Instruction *branch, Instruction *start, Instruction *cond)>
-
-Converts conditional loops to post-test
-
-Returns TRUE if any optimizations were performed. Otherwise, returns
-FALSE.
-
-=cut
-
-*/
-
-PARROT_WARN_UNUSED_RESULT
-static int
-branch_cond_loop_swap(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGMOD(Instruction *branch),
-        ARGMOD(Instruction *start), ARGMOD(Instruction *cond))
-{
-    ASSERT_ARGS(branch_cond_loop_swap)
-    int changed = 0;
-    int args;
-    const char * const neg_op = get_neg_op(cond->opname, &args);
-    if (neg_op) {
-        const size_t size  = strlen(branch->symregs[0]->name) + 10; /* + '_post999' */
-        char * const label = (char *)mem_sys_allocate(size);
-        int count;
-        int found = 0;
-
-        for (count = 1; count != 999; ++count) {
-            snprintf(label, size, "%s_post%d", branch->symregs[0]->name, count);
-            if (get_sym(imcc, label) == NULL) {
-                found = 1;
-                break;
-            }
-        }
-
-        if (found) {
-            Instruction *tmp;
-            SymReg *regs[3], *r;
-            int reg_index;
-
-            /* cond_op has 2 or 3 args */
-            PARROT_ASSERT(args <= 3);
-
-            r = mk_local_label(imcc, label);
-            tmp = INS_LABEL(imcc, unit, r, 0);
-            insert_ins(unit, cond, tmp);
-
-            for (start = start->next; start != cond; start = start->next) {
-                if (!(start->type & ITLABEL)) {
-                    tmp = INS(imcc, unit, start->opname, "",
-                        start->symregs, start->symreg_count, start->keys, 0);
-                    prepend_ins(unit, branch, tmp);
-                }
-            }
-
-            for (count = 0; count != args; ++count) {
-                regs[count] = cond->symregs[count];
-            }
-
-            reg_index = get_branch_regno(cond);
-            if (reg_index < 0)
-                Parrot_ex_throw_from_c_args(imcc->interp, NULL, 1,
-                    "Negative branch register address detected");
-
-            regs[reg_index] = mk_label_address(imcc, label);
-            tmp = INS(imcc, unit, (const char*)neg_op, "", regs, args, 0, 0);
-
-            IMCC_debug(imcc, DEBUG_OPT1,
-                "loop %s -> %s converted to post-test, added label %s\n",
-                branch->symregs[0]->name, get_branch_reg(cond)->name, label);
-
-            subst_ins(unit, branch, tmp, 1);
-            unit->ostat.branch_cond_loop++;
-            changed = 1;
-        }
-
-        mem_sys_free(label);
-    }
-
-    return changed;
-}
-
-/*
-
-=item C<static int branch_cond_loop(imc_info_t *imcc, IMC_Unit *unit)>
-
-start:           => start:
-if cond goto end    if cond goto end
-...
-branch start        start_post1:
-end:                ...
-                    unless cond goto start_post562
-                    end:
-
-The basic premise is "branch (A) to conditional (B), where B goes to
-just after A."
-
-Returns TRUE if any optimizations were performed. Otherwise, returns
-FALSE.
-
-=cut
-
-*/
-
-static int
-branch_cond_loop(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
-{
-    ASSERT_ARGS(branch_cond_loop)
-    Instruction *ins, *cond, *start, *prev;
-    int changed = 0, found;
-
-    IMCC_info(imcc, 2, "\tbranch_cond_loop\n");
-    /* reset statistic globals */
-
-    for (ins = unit->instructions; ins; ins = ins->next) {
-        if ((ins->type & IF_goto) && STREQ(ins->opname, "branch")) {
-            /* get `end` label */
-            Instruction * const end = ins->next;
-            /* get `start` label */
-            SymReg * const r = get_sym(imcc, ins->symregs[0]->name);
-
-            if (end && (end->type & ITLABEL) &&
-                r && (r->type & VTADDRESS) && r->first_ins) {
-
-                start = r->first_ins;
-                found = 0;
-
-                for (cond = start->next; cond; cond = cond->next) {
-                    /* no good if it's an unconditional branch*/
-                    if (cond->type & IF_goto && STREQ(cond->opname, "branch")) {
-                        break;
-                    }
-                    else if ((cond->type & ITPCCRET) || (cond->type & ITPCCSUB)
-                            || (cond->type & ITCALL)) {
-                        break;
-                        /* just until we can copy set_args et al */
-                    }
-                    else if ((cond->type & ITBRANCH) && (get_branch_regno(cond) >= 0)) {
-                        found = 1;
-                        break;
-                    }
-                }
-
-                if (found) {
-                    const char * const lbl = get_branch_reg(cond)->name;
-                    const SymReg * const r = get_sym(imcc, lbl);
-                    if (r && (r->type & VTADDRESS) && r->first_ins == end) {
-                        /* the current ins is replaced - remember prev
-                         * and set ins again after the changes
-                         */
-                        prev = ins->prev;
-                        if (!prev)
-                            continue;
-                        changed |= branch_cond_loop_swap(imcc,
-                                unit, ins, start, cond);
-                        ins = prev->next;
-                    }
-                }
-            }
-        }
-    }
-    return changed;
-}
-
-/*
-
 =item C<static int unused_label(imc_info_t *imcc, IMC_Unit *unit)>
 
 Removes unused labels.
@@ -1611,6 +1675,899 @@ used_once(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
     return opt;
 }
 
+/* optimizations on single-assignment symbols */
+
+/*
+
+=item C<static int pure_op(const Instruction *ins)>
+
+Returns true if C<ins> computes its first argument from the others and
+does nothing else: it can't throw, and moving it or running it once more
+or once less doesn't matter.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+pure_op(ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(pure_op)
+    PARROT_OBSERVER static const char * const ops[] = {
+        "set", "add", "sub", "mul", "neg", "abs",
+        "band", "bor", "bxor", "bnot", "shl", "shr", "lsr",
+        "not", "and", "or", "xor", "cmp",
+        "iseq", "isne", "islt", "isle", "isgt", "isge"
+    };
+    size_t i;
+    int    j;
+
+    if (!ins->op || ins->keys || ins->symreg_count < 2
+    ||  ins->opsize != ins->symreg_count + 1
+    || (ins->type & (ITBRANCH | ITPCCSUB | ITPCCRET | ITCALL | ITLABEL)))
+        return 0;
+
+    for (i = 0; i < N_ELEMENTS(ops); i++)
+        if (STREQ(ins->opname, ops[i]))
+            break;
+
+    if (i == N_ELEMENTS(ops))
+        return 0;
+
+    /* strings only get copied; division and PMCs may throw */
+    for (j = 0; j < ins->symreg_count; j++) {
+        const int set = ins->symregs[j]->set;
+
+        if (set != 'I' && set != 'N' && !(set == 'S' && i == 0))
+            return 0;
+    }
+
+    if (!instruction_writes(ins, ins->symregs[0])
+    ||   instruction_reads(ins, ins->symregs[0]))
+        return 0;
+
+    for (j = 1; j < ins->symreg_count; j++)
+        if (instruction_writes(ins, ins->symregs[j]))
+            return 0;
+
+    return 1;
+}
+
+/*
+
+=item C<static int ins_dominates(const IMC_Unit *unit, const Instruction *a,
+const Instruction *b)>
+
+Returns true if every path to instruction C<b> runs through C<a> first.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+ins_dominates(ARGIN(const IMC_Unit *unit), ARGIN(const Instruction *a),
+        ARGIN(const Instruction *b))
+{
+    ASSERT_ARGS(ins_dominates)
+
+    if (a->bbindex == b->bbindex)
+        return a->index < b->index;
+
+    return set_contains(unit->dominators[b->bbindex], a->bbindex);
+}
+
+/*
+
+=item C<static int reassigns_pmc(const Instruction *ins)>
+
+Returns true if C<ins> is one of the ops like C<add Px, Py, Pz> that put a new
+PMC in their first argument, though it's declared C<invar>, so nothing else
+knows it gets written.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+reassigns_pmc(ARGIN(const Instruction *ins))
+{
+    ASSERT_ARGS(reassigns_pmc)
+    PARROT_OBSERVER static const char * const ops[] = {
+        "add", "sub", "mul", "div", "fdiv", "mod", "cmod", "pow",
+        "and", "or", "xor", "concat", "repeat"
+    };
+    size_t i;
+
+    if (ins->symreg_count < 3 || ins->symregs[0]->set != 'P'
+    ||  instruction_writes(ins, ins->symregs[0]))
+        return 0;
+
+    for (i = 0; i < N_ELEMENTS(ops); i++)
+        if (STREQ(ins->opname, ops[i]))
+            return 1;
+
+    return 0;
+}
+
+/*
+
+=item C<static Hash * find_ssa_values(imc_info_t *imcc, const IMC_Unit *unit)>
+
+Finds the symbols of C<unit> that are in SSA form: written by a single
+instruction, which doesn't read them and dominates all their uses. Returns a
+hash mapping each to the instruction defining it. Lexicals, symbols used in
+keys, PMCs replaced by ops like C<add> and registers named in PASM don't count.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Hash *
+find_ssa_values(ARGMOD(imc_info_t *imcc), ARGIN(const IMC_Unit *unit))
+{
+    ASSERT_ARGS(find_ssa_values)
+    Hash * const values = Parrot_hash_new_pointer_hash(imcc->interp);
+    Instruction *ins;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int i;
+
+        for (i = 0; i < ins->symreg_count; i++) {
+            SymReg * const r = ins->symregs[i];
+
+            if (REG_NEEDS_ALLOC(r) && strchr("INSP", r->set)
+            &&  r->lhs_use_count == 1 && !r->reg
+            && !(r->usage & U_LEXICAL) && !(r->type & VTPASM)
+            &&  instruction_writes(ins, r) && !instruction_reads(ins, r))
+                Parrot_hash_put(imcc->interp, values, r, ins);
+        }
+    }
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int i;
+
+        for (i = 0; i < ins->symreg_count; i++) {
+            SymReg * const r = ins->symregs[i];
+
+            if (r->set == 'K') {
+                const SymReg *key;
+
+                for (key = r->nextkey; key; key = key->nextkey)
+                    if (key->reg)
+                        Parrot_hash_delete(imcc->interp, values, key->reg);
+            }
+            else if (i == 0 && reassigns_pmc(ins))
+                Parrot_hash_delete(imcc->interp, values, r);
+            else {
+                const Instruction * const def =
+                    (const Instruction *)Parrot_hash_get(imcc->interp, values, r);
+
+                if (def && def != ins && !ins_dominates(unit, def, ins))
+                    Parrot_hash_delete(imcc->interp, values, r);
+            }
+        }
+    }
+
+    return values;
+}
+
+/*
+
+=item C<static void replace_uses(IMC_Unit *unit, const SymReg *from, SymReg
+*to)>
+
+Makes every instruction of C<unit> reading C<from> read C<to> instead.
+
+=cut
+
+*/
+
+static void
+replace_uses(ARGMOD(IMC_Unit *unit), ARGIN(const SymReg *from), ARGIN(SymReg *to))
+{
+    ASSERT_ARGS(replace_uses)
+    Instruction *ins;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        int i;
+
+        for (i = 0; i < ins->symreg_count; i++)
+            if (ins->symregs[i] == from)
+                ins->symregs[i] = to;
+    }
+}
+
+/*
+
+=item C<static int copy_propagation(imc_info_t *imcc, IMC_Unit *unit, Hash
+*values)>
+
+  set X, Y      =>  --
+  ... X ...         ... Y ...
+
+Neither X nor Y is ever written again, so Y can stand in for X everywhere.
+
+=cut
+
+*/
+
+static int
+copy_propagation(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGIN(Hash *values))
+{
+    ASSERT_ARGS(copy_propagation)
+    Instruction *ins;
+    int          changed = 0;
+
+    IMCC_info(imcc, 2, "\tcopy_propagation\n");
+
+    for (ins = unit->instructions; ins;) {
+        SymReg * const dest = ins->symreg_count == 2 ? ins->symregs[0] : NULL;
+        SymReg * const src  = ins->symreg_count == 2 ? ins->symregs[1] : NULL;
+
+        if (dest && STREQ(ins->opname, "set") && !ins->keys
+        &&  dest != src && dest->set == src->set
+        &&  Parrot_hash_get(imcc->interp, values, dest) == ins
+        &&  Parrot_hash_exists(imcc->interp, values, src)) {
+            IMCC_debug(imcc, DEBUG_OPT2, "copy %s = %s propagated\n",
+                    dest->name, src->name);
+            replace_uses(unit, dest, src);
+            ins = delete_ins(unit, ins);
+            unit->ostat.deleted_ins++;
+            unit->ostat.copies_propagated++;
+            changed = 1;
+        }
+        else
+            ins = ins->next;
+    }
+
+    return changed;
+}
+
+/*
+
+=item C<static int same_value(const Instruction *a, const Instruction *b)>
+
+Returns true if the pure ops C<a> and C<b> compute the same value.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+same_value(ARGIN(const Instruction *a), ARGIN(const Instruction *b))
+{
+    ASSERT_ARGS(same_value)
+    PARROT_OBSERVER static const char * const commutative[] = {
+        "add", "mul", "band", "bor", "bxor", "and", "or", "xor",
+        "iseq", "isne"
+    };
+    size_t j;
+    int    i;
+
+    if (a->op != b->op || a->symreg_count != b->symreg_count)
+        return 0;
+
+    for (i = 1; i < a->symreg_count; i++)
+        if (a->symregs[i] != b->symregs[i])
+            break;
+
+    if (i == a->symreg_count)
+        return 1;
+
+    /* X = A op B is Y = B op A for these */
+    if (a->symreg_count != 3
+    ||  a->symregs[1] != b->symregs[2] || a->symregs[2] != b->symregs[1])
+        return 0;
+
+    for (j = 0; j < N_ELEMENTS(commutative); j++)
+        if (STREQ(a->opname, commutative[j]))
+            return 1;
+
+    return 0;
+}
+
+/*
+
+=item C<static int value_numbering(imc_info_t *imcc, IMC_Unit *unit, Hash
+*values)>
+
+  add X, A, B   =>  add X, A, B
+  ...               ...
+  add Y, A, B       --
+  ... Y ...         ... X ...
+
+A pure op whose arguments are constants or single-assignment symbols computes
+the same value wherever it runs, so if an earlier op computing that value
+dominates it, the earlier result replaces the later one.
+
+=cut
+
+*/
+
+static int
+value_numbering(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGIN(Hash *values))
+{
+    ASSERT_ARGS(value_numbering)
+    Instruction  *ins;
+    Instruction **table;
+    size_t        size, used;
+    int           changed = 0;
+
+    IMCC_info(imcc, 2, "\tvalue_numbering\n");
+
+    /* an open addressed table, kept at most half full */
+    for (size = 16, ins = unit->instructions; ins; ins = ins->next)
+        if (ins->index >= size / 2)
+            size <<= 1;
+
+    table = mem_gc_allocate_n_zeroed_typed(imcc->interp, size, Instruction *);
+    used  = 0;
+
+    for (ins = unit->instructions; ins;) {
+        size_t slot;
+        int    i;
+
+        if (!pure_op(ins)
+        ||  Parrot_hash_get(imcc->interp, values, ins->symregs[0]) != ins) {
+            ins = ins->next;
+            continue;
+        }
+
+        /* adding the arguments up ignores their order, as commutative ops do */
+        slot = (size_t)ins->op >> 3;
+
+        for (i = 1; i < ins->symreg_count; i++) {
+            SymReg * const r = ins->symregs[i];
+
+            if (!(r->type & (VTCONST | VT_CONSTP))
+            &&  !Parrot_hash_exists(imcc->interp, values, r))
+                break;
+
+            slot += (size_t)r >> 3;
+        }
+
+        if (i < ins->symreg_count) {
+            ins = ins->next;
+            continue;
+        }
+
+        for (slot &= size - 1; table[slot]; slot = (slot + 1) & (size - 1))
+            if (same_value(table[slot], ins)
+            &&  ins_dominates(unit, table[slot], ins))
+                break;
+
+        if (table[slot]) {
+            IMCC_debug(imcc, DEBUG_OPT2, "%s %s is %s\n", ins->opname,
+                    ins->symregs[0]->name, table[slot]->symregs[0]->name);
+            replace_uses(unit, ins->symregs[0], table[slot]->symregs[0]);
+            ins = delete_ins(unit, ins);
+            unit->ostat.deleted_ins++;
+            unit->ostat.values_numbered++;
+            changed = 1;
+        }
+        else {
+            if (++used < size / 2)
+                table[slot] = ins;
+
+            ins = ins->next;
+        }
+    }
+
+    mem_sys_free(table);
+    return changed;
+}
+
+/*
+
+=item C<static int loop_invariant_motion(imc_info_t *imcc, IMC_Unit *unit, Hash
+*values)>
+
+Moves pure ops out of loops with a natural preheader when their arguments are
+constants or single-assignment symbols defined outside the loop. They run
+once before the loop instead of on every trip around it; as pure ops, running
+them when the loop doesn't run at all does no harm.
+
+=cut
+
+*/
+
+static int
+loop_invariant_motion(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit),
+        ARGIN(Hash *values))
+{
+    ASSERT_ARGS(loop_invariant_motion)
+    int changed = 0;
+    int l;
+
+    IMCC_info(imcc, 2, "\tloop_invariant_motion\n");
+
+    for (l = 0; l < unit->n_loops; l++) {
+        const Loop_info * const loop = unit->loop_info[l];
+        Instruction            *ins, *end;
+
+        if (loop->preheader >= unit->n_basic_blocks
+        || !(unit->bb_list[loop->header]->start->type & ITLABEL))
+            continue;
+
+        /* hoisted ops go before the jump to the loop, if there is one */
+        end = unit->bb_list[loop->preheader]->end;
+
+        if ((end->type & (ITPCCSUB | ITPCCRET | ITCALL))
+        || ((end->type & ITBRANCH) && (!end->prev || !STREQ(end->opname, "branch"))))
+            continue;
+
+        for (ins = unit->instructions; ins;) {
+            Instruction * const next = ins->next;
+            int                 i;
+
+            if (!set_contains(loop->loop, ins->bbindex) || !pure_op(ins)
+            ||  Parrot_hash_get(imcc->interp, values, ins->symregs[0]) != ins) {
+                ins = next;
+                continue;
+            }
+
+            for (i = 1; i < ins->symreg_count; i++) {
+                SymReg * const r = ins->symregs[i];
+                const Instruction * const def =
+                    (const Instruction *)Parrot_hash_get(imcc->interp, values, r);
+
+                if (r->type & (VTCONST | VT_CONSTP))
+                    continue;
+
+                if (!def || set_contains(loop->loop, def->bbindex))
+                    break;
+            }
+
+            if (i == ins->symreg_count) {
+                IMCC_debug(imcc, DEBUG_OPT2, "%s %s moved out of loop %d\n",
+                        ins->opname, ins->symregs[0]->name, l);
+                if (end->type & ITBRANCH)
+                    move_ins(unit, ins, end->prev);
+                else {
+                    move_ins(unit, ins, end);
+                    end = ins;
+                }
+
+                /* later ops in this loop may depend on it */
+                ins->bbindex = loop->preheader;
+                unit->ostat.invariants_moved++;
+                changed = 1;
+            }
+
+            ins = next;
+        }
+    }
+
+    return changed;
+}
+
+/*
+
+=item C<static int reads_value_only(const Instruction *ins, int i)>
+
+Returns true if argument C<i> of C<ins> is an Integer or Float PMC whose
+value it reads without keeping hold of the PMC or changing it: printing it,
+testing or comparing it, copying its value into a native register or adding,
+subtracting or multiplying it into a new PMC.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+reads_value_only(ARGIN(const Instruction *ins), int i)
+{
+    ASSERT_ARGS(reads_value_only)
+    const char * const op = ins->opname;
+
+    if (ins->keys)
+        return 0;
+
+    switch (ins->symreg_count) {
+      case 1:
+        return STREQ(op, "print") || STREQ(op, "say");
+      case 2:
+        if (i == 0)
+            return STREQ(op, "if") || STREQ(op, "unless");
+        return STREQ(op, "set") && strchr("INS", ins->symregs[0]->set);
+      case 3:
+        if (i < 2 && (STREQ(op, "eq") || STREQ(op, "ne") || STREQ(op, "lt")
+                  ||  STREQ(op, "le") || STREQ(op, "gt") || STREQ(op, "ge")))
+            return 1;
+        return i > 0 && ins->symregs[0]->set == 'P'
+            && (STREQ(op, "add") || STREQ(op, "sub") || STREQ(op, "mul"));
+      default:
+        return 0;
+    }
+}
+
+/*
+
+=item C<static Unboxed * find_unboxed(imc_info_t *imcc, Hash *boxed, const
+SymReg *r)>
+
+Returns what's known of the PMC in C<r>, if it was boxed from a native value
+and nothing but the reads above get hold of it.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static Unboxed *
+find_unboxed(ARGMOD(imc_info_t *imcc), ARGIN(Hash *boxed), ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(find_unboxed)
+    Unboxed * const u = (Unboxed *)Parrot_hash_get(imcc->interp, boxed, r);
+
+    return u && u->usable ? u : NULL;
+}
+
+/*
+
+=item C<static SymReg * native_value(imc_info_t *imcc, IMC_Unit *unit, Unboxed
+*u, int set)>
+
+Returns a register or constant holding the value boxed in C<u>, as an
+integer or a float according to C<set>. Ops setting up the register go right
+after the box op.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static SymReg *
+native_value(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGMOD(Unboxed *u),
+        int set)
+{
+    ASSERT_ARGS(native_value)
+    SymReg      *regs[2];
+    Instruction *tmp;
+
+    if (!u->value) {
+        regs[0] = mk_temp_reg(imcc, u->type);
+        regs[1] = u->def->symregs[1];
+        tmp     = INS(imcc, unit, "set", "", regs, 2, 0, 0);
+        insert_ins(unit, u->last, tmp);
+        u->last  = tmp;
+        u->value = regs[0];
+    }
+
+    if (set == u->type)
+        return u->value;
+
+    if (!u->num) {
+        regs[0] = mk_temp_reg(imcc, set);
+        regs[1] = u->value;
+        tmp     = INS(imcc, unit, "set", "", regs, 2, 0, 0);
+        insert_ins(unit, u->last, tmp);
+        u->last = tmp;
+        u->num  = regs[0];
+    }
+
+    return u->num;
+}
+
+/*
+
+=item C<static SymReg * native_const(imc_info_t *imcc, SymReg *r, int set)>
+
+Returns the constant C<r> as an integer or a float according to C<set>, or
+NULL if it isn't a number or can't be converted.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static SymReg *
+native_const(ARGMOD(imc_info_t *imcc), ARGIN(SymReg *r), int set)
+{
+    ASSERT_ARGS(native_const)
+    const char *digits = r->name;
+
+    if (!(r->type & (VTCONST | VT_CONSTP)) || !strchr("IN", r->set))
+        return NULL;
+
+    if (r->set == set)
+        return r;
+
+    /* only decimal integers read the same as floats */
+    if (set != 'N')
+        return NULL;
+
+    if (*digits == '-')
+        digits++;
+
+    if (!*digits || digits[strspn(digits, "0123456789")])
+        return NULL;
+
+    return mk_const(imcc, r->name, 'N');
+}
+
+/*
+
+=item C<static Instruction * unbox_ins(imc_info_t *imcc, IMC_Unit *unit, Hash
+*boxed, Instruction *ins)>
+
+Rewrites C<ins> to use the native values of the PMCs it reads, where the
+native op is sure to do what the Integer or Float methods would:
+
+  set Ix, Py            =>  set Ix, Iy
+  if Py, L              =>  if Iy, L
+  lt Py, Pz, L          =>  lt Ny, Nz, L
+  add Px, Py, Pz        =>  add Nx, Ny, Nz
+                            box Px, Nx
+
+Comparing an Integer with a Float goes through C<cmp>, which calls a NaN
+equal to anything, and C<is_equal>, which compares integers, so only the
+comparisons agreeing with the native ones change. Integer arithmetic stays
+with the PMC, which moves to a BigInt rather than overflow.
+
+Returns the instruction to go on after, or NULL if C<ins> stays as it is.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+static Instruction *
+unbox_ins(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGIN(Hash *boxed),
+        ARGMOD(Instruction *ins))
+{
+    ASSERT_ARGS(unbox_ins)
+    const char * const op  = ins->opname;
+    SymReg            *regs[3], *boxed_regs[2];
+    Unboxed           *u, *v = NULL;
+    Instruction       *tmp, *box = NULL;
+    const int          n   = ins->symreg_count;
+    int                set;
+
+    if (ins->keys || n < 2 || n > 3)
+        return NULL;
+
+    if (n == 2 && STREQ(op, "set") && strchr("IN", ins->symregs[0]->set)) {
+        if (!(u = find_unboxed(imcc, boxed, ins->symregs[1])))
+            return NULL;
+
+        regs[0] = ins->symregs[0];
+        regs[1] = native_value(imcc, unit, u, u->type);
+    }
+    else if (n == 2 && (STREQ(op, "if") || STREQ(op, "unless"))) {
+        if (!(u = find_unboxed(imcc, boxed, ins->symregs[0])))
+            return NULL;
+
+        regs[0] = native_value(imcc, unit, u, u->type);
+        regs[1] = ins->symregs[1];
+    }
+    else if (n == 3 && (STREQ(op, "add") || STREQ(op, "sub") || STREQ(op, "mul"))) {
+        if (ins->symregs[0]->set != 'P'
+        || !(u = find_unboxed(imcc, boxed, ins->symregs[1])))
+            return NULL;
+
+        v = find_unboxed(imcc, boxed, ins->symregs[2]);
+
+        /* Integer * Float gives an Integer */
+        if (u->type == 'N' ? !v && !native_const(imcc, ins->symregs[2], 'N')
+                           : !v || v->type != 'N' || STREQ(op, "mul"))
+            return NULL;
+
+        regs[0] = mk_temp_reg(imcc, 'N');
+        regs[1] = native_value(imcc, unit, u, 'N');
+        regs[2] = v ? native_value(imcc, unit, v, 'N')
+                    : native_const(imcc, ins->symregs[2], 'N');
+        boxed_regs[0] = ins->symregs[0];
+        boxed_regs[1] = regs[0];
+        box = INS(imcc, unit, "box", "", boxed_regs, 2, 0, 0);
+    }
+    else if (n == 3 && (STREQ(op, "eq") || STREQ(op, "ne") || STREQ(op, "lt")
+                    ||  STREQ(op, "le") || STREQ(op, "gt") || STREQ(op, "ge"))) {
+        SymReg * const b = ins->symregs[1];
+
+        if (!(u = find_unboxed(imcc, boxed, ins->symregs[0])))
+            return NULL;
+
+        v = find_unboxed(imcc, boxed, b);
+
+        if (!v && !native_const(imcc, b, b->set))
+            return NULL;
+
+        /* lt_p_nc and friends compare get_number() with the constant */
+        if (u->type == 'I' && (v ? v->type : b->set) == 'I')
+            set = 'I';
+        else if (!v && b->set == 'N')
+            set = 'N';
+        else if (STREQ(op, "lt") || STREQ(op, "gt")
+             || (u->type == 'N' && (STREQ(op, "eq") || STREQ(op, "ne"))))
+            set = 'N';
+        else
+            return NULL;
+
+        if (!v && !(regs[1] = native_const(imcc, b, set)))
+            return NULL;
+
+        regs[0] = native_value(imcc, unit, u, set);
+        regs[2] = ins->symregs[2];
+
+        if (v)
+            regs[1] = native_value(imcc, unit, v, set);
+    }
+    else
+        return NULL;
+
+    IMCC_debug(imcc, DEBUG_OPT2, "%s %s unboxed\n", op, u->def->symregs[0]->name);
+    tmp = INS(imcc, unit, op, "", regs, n, 0, 0);
+
+    /* comparing constants gives a branch or nothing at all */
+    if (tmp)
+        subst_ins(unit, ins, tmp);
+    else {
+        tmp = ins->prev;
+        ins = delete_ins(unit, ins);
+        unit->ostat.deleted_ins++;
+    }
+
+    if (box) {
+        insert_ins(unit, tmp, box);
+        tmp = box;
+    }
+
+    u->uses--;
+    u->unboxed = 1;
+
+    if (v) {
+        v->uses--;
+        v->unboxed = 1;
+    }
+
+    unit->ostat.ops_unboxed++;
+    return tmp;
+}
+
+/*
+
+=item C<static int unbox_values(imc_info_t *imcc, IMC_Unit *unit, Hash *values)>
+
+  box Px, Iy        =>  --
+  ...                   ...
+  gt Px, 10, L          gt Iy, 10, L
+
+Integer and Float PMCs boxed once from a native value, and only ever read by
+ops which don't keep hold of them, hold that value all along. Where the value
+itself does the job, the ops reading them use it instead, and boxes nothing
+reads any more go away. This only happens in the parrot HLL, as others may
+map Integer and Float to types of their own.
+
+=cut
+
+*/
+
+static int
+unbox_values(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit), ARGIN(Hash *values))
+{
+    ASSERT_ARGS(unbox_values)
+    Hash        *boxed;
+    Unboxed     *boxes;
+    Instruction *ins;
+    int          n_boxes = 0;
+    int          changed = 0;
+    int          i;
+
+    if (unit->hll_id)
+        return 0;
+
+    IMCC_info(imcc, 2, "\tunbox_values\n");
+
+    for (ins = unit->instructions; ins; ins = ins->next)
+        if (STREQ(ins->opname, "box") && ins->symreg_count == 2
+        &&  strchr("IN", ins->symregs[1]->set)
+        &&  Parrot_hash_get(imcc->interp, values, ins->symregs[0]) == ins)
+            n_boxes++;
+
+    if (!n_boxes)
+        return 0;
+
+    boxes = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_boxes, Unboxed);
+    boxed = Parrot_hash_new_pointer_hash(imcc->interp);
+
+    for (n_boxes = 0, ins = unit->instructions; ins; ins = ins->next)
+        if (STREQ(ins->opname, "box") && ins->symreg_count == 2
+        &&  strchr("IN", ins->symregs[1]->set)
+        &&  Parrot_hash_get(imcc->interp, values, ins->symregs[0]) == ins) {
+            Unboxed * const u   = boxes + n_boxes++;
+            SymReg  * const src = ins->symregs[1];
+
+            u->def    = ins;
+            u->last   = ins;
+            u->type   = src->set;
+            u->usable = 1;
+
+            /* anything else may be written again after the box */
+            if ((src->type & (VTCONST | VT_CONSTP))
+            ||  Parrot_hash_exists(imcc->interp, values, src))
+                u->value = src;
+
+            Parrot_hash_put(imcc->interp, boxed, ins->symregs[0], u);
+        }
+
+    /* a PMC held anywhere else may change under its native value */
+    for (ins = unit->instructions; ins; ins = ins->next)
+        for (i = 0; i < ins->symreg_count; i++) {
+            Unboxed * const u = (Unboxed *)Parrot_hash_get(imcc->interp, boxed,
+                    ins->symregs[i]);
+
+            if (u && ins != u->def) {
+                if (reads_value_only(ins, i))
+                    u->uses++;
+                else
+                    u->usable = 0;
+            }
+        }
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        Instruction * const tmp = unbox_ins(imcc, unit, boxed, ins);
+
+        if (tmp) {
+            ins     = tmp;
+            changed = 1;
+        }
+    }
+
+    for (i = 0; i < n_boxes; i++)
+        if (boxes[i].unboxed && !boxes[i].uses) {
+            IMCC_debug(imcc, DEBUG_OPT2, "box %s deleted\n",
+                    boxes[i].def->symregs[0]->name);
+            ins = delete_ins(unit, boxes[i].def);
+            unit->ostat.deleted_ins++;
+        }
+
+    Parrot_hash_destroy(imcc->interp, boxed);
+    mem_sys_free(boxes);
+    return changed;
+}
+
+/*
+
+=item C<static int ssa_optimize(imc_info_t *imcc, IMC_Unit *unit)>
+
+Runs the passes working on the single-assignment symbols of C<unit>, up to
+the first to change anything. Returns TRUE if one did.
+
+=cut
+
+*/
+
+static int
+ssa_optimize(ARGMOD(imc_info_t *imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(ssa_optimize)
+    Hash *values;
+    int   changed;
+
+    if (imcc->dont_optimize || !unit->n_symbols || !unit->dominators)
+        return 0;
+
+    IMCC_info(imcc, 2, "ssa_optimize\n");
+    values  = find_ssa_values(imcc, unit);
+    changed = copy_propagation(imcc, unit, values)
+           || value_numbering(imcc, unit, values)
+           || loop_invariant_motion(imcc, unit, values)
+           || unbox_values(imcc, unit, values);
+
+    Parrot_hash_destroy(imcc->interp, values);
+    return changed;
+}
+
 /*
 
 =back
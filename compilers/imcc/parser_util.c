@@ -272,7 +272,7 @@ var_arg_ins(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit), ARGIN(const char
 
     PARROT_ASSERT(op && STREQ(op->full_name, fullname));
 
-    ins         = _mk_instruction(name, "", n, r, dirs);
+    ins         = _mk_instruction(imcc, unit, name, "", n, r, dirs);
     ins->op     = op;
     ins->opsize = n + 1;
 
@@ -312,7 +312,7 @@ INS(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit), ARGIN(const char *name),
     ASSERT_ARGS(INS)
 
     if (STREQ(name, ".annotate")) {
-        Instruction *ins = _mk_instruction(name, "", n, r, 0);
+        Instruction *ins = _mk_instruction(imcc, unit, name, "", n, r, 0);
         if (emit)
             return emitb(imcc, unit, ins);
         else
@@ -441,7 +441,7 @@ INS(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit), ARGIN(const char *name),
         IMCC_debug(imcc, DEBUG_PARSER, "%s %s\t%s\n", name, format, fullname);
 
         /* make the instruction */
-        ins         = _mk_instruction(name, format, n, r, dirs);
+        ins         = _mk_instruction(imcc, unit, name, format, n, r, dirs);
         ins->keys  |= keyvec;
 
         /* fill in oplib's info */
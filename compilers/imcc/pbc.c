@@ -151,6 +151,20 @@ static subs_t * find_global_label(
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(*pc);
 
+PARROT_WARN_UNUSED_RESULT
+static int find_lexical_slot(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGIN(const SymReg *name),
+    int set,
+    ARGOUT(INTVAL *depth))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*depth);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static PMC* find_outer(
@@ -236,6 +250,14 @@ static PMC* mk_multi_sig(
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(* bc);
 
+static void resolve_lexical_slots(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
 static void store_fixup(
     ARGMOD(imc_info_t * imcc),
     ARGIN(const SymReg *r),
@@ -318,6 +340,11 @@ static void verify_signature(
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(sym) \
     , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_find_lexical_slot __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(name) \
+    , PARROT_ASSERT_ARG(depth))
 #define ASSERT_ARGS_find_outer __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -353,6 +380,9 @@ static void verify_signature(
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(bc))
+#define ASSERT_ARGS_resolve_lexical_slots __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_store_fixup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(r))
@@ -1160,6 +1190,8 @@ add_const_str(ARGMOD(imc_info_t * imcc), ARGIN(STRING *s),
     if (i >= 0)
         return i;
 
+    /* share names with loaded packfiles, as the global cache is keyed on them */
+    s = Parrot_str_intern(imcc->interp, s);
 
     if (!ct->str.constants)
         ct->str.constants = mem_gc_allocate_n_zeroed_typed(imcc->interp, 1, STRING *);
@@ -1493,11 +1525,9 @@ add_const_pmc_sub(ARGMOD(imc_info_t * imcc), ARGMOD(SymReg *r), size_t offs,
 
         ns_const = ns->color;
 
-        if (real_name) {
-            char * const p = mem_sys_strdup(real_name);
-            mem_sys_free(r->name);
-            r->name = p;
-        }
+        /* the name lives in its symbol table's arena; shorten it in place */
+        if (real_name)
+            memmove(r->name, real_name, strlen(real_name) + 1);
     }
 
     /* Do we have to create an instance of a specific type for this sub? */
@@ -1540,10 +1570,10 @@ add_const_pmc_sub(ARGMOD(imc_info_t * imcc), ARGMOD(SymReg *r), size_t offs,
         unit->subid = r;
     else {
         /* trim the quotes  */
-        char *oldname     = unit->subid->name;
-        unit->subid->name = mem_sys_strdup(unit->subid->name + 1);
-        unit->subid->name[strlen(unit->subid->name) - 1] = 0;
-        mem_sys_free(oldname);
+        char * const name = unit->subid->name;
+        const size_t len  = strlen(name) - 2;
+        memmove(name, name + 1, len);
+        name[len] = '\0';
 
         /* create string constant for it. */
         unit->subid->color = add_const_str(imcc,
@@ -2191,6 +2221,181 @@ constant_folding(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
 }
 
 
+/*
+
+=item C<static int find_lexical_slot(imc_info_t * imcc, const IMC_Unit *unit,
+const SymReg *name, int set, INTVAL *depth)>
+
+Looks up the lexical C<name> first among the C<.lex> declarations of C<unit>,
+then in the LexInfo of each sub along its C<:outer> chain. Returns the register
+holding it and stores how many subs out it lives in C<depth>, or returns -1 if
+the lexical isn't found, isn't of type C<set>, or an outer sub wasn't compiled
+in this segment.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+find_lexical_slot(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
+        ARGIN(const SymReg *name), int set, ARGOUT(INTVAL *depth))
+{
+    ASSERT_ARGS(find_lexical_slot)
+    const SymHash * const hsh      = &unit->hash;
+    STRING        * const lex_name = IMCC_string_from_reg(imcc, name);
+    const INTVAL          reg_type = set == 'I' ? REGNO_INT :
+                                     set == 'N' ? REGNO_NUM :
+                                     set == 'S' ? REGNO_STR :
+                                                  REGNO_PMC;
+    PMC          *sub_pmc = PMCNULL;
+    subs_t       *s;
+    unsigned int  i;
+
+    for (i = 0; i < hsh->size; i++) {
+        const SymReg *r;
+
+        for (r = hsh->data[i]; r; r = r->next) {
+            if (r->usage & U_LEXICAL) {
+                const SymReg *n;
+
+                for (n = r->reg; n; n = n->reg) {
+                    if (!STRING_equal(imcc->interp, lex_name,
+                            IMCC_string_from_reg(imcc, n)))
+                        continue;
+
+                    if (r->set != set || r->color < 0)
+                        return -1;
+
+                    *depth = 0;
+                    return r->color;
+                }
+            }
+        }
+    }
+
+    if (!unit->outer || !*unit->outer->name)
+        return -1;
+
+    for (s = imcc->globals->cs->first; s; s = s->next) {
+        if (s->unit != unit
+        &&  STREQ(s->unit->subid->name, unit->outer->name)) {
+            sub_pmc = s->unit->sub_pmc;
+            break;
+        }
+    }
+
+    for (*depth = 1; !PMC_IS_NULL(sub_pmc); ++*depth) {
+        Parrot_Sub_attributes *sub;
+
+        PMC_get_sub(imcc->interp, sub_pmc, sub);
+
+        if (!PMC_IS_NULL(sub->lex_info)) {
+            INTVAL slot;
+
+            if (sub->lex_info->vtable->base_type != enum_class_LexInfo)
+                return -1;
+
+            if (VTABLE_exists_keyed_str(imcc->interp, sub->lex_info, lex_name)) {
+                slot = VTABLE_get_integer_keyed_str(imcc->interp,
+                        sub->lex_info, lex_name);
+
+                if ((slot & 3) != reg_type)
+                    return -1;
+
+                return slot >> 2;
+            }
+        }
+
+        sub_pmc = sub->outer_sub;
+    }
+
+    return -1;
+}
+
+
+/*
+
+=item C<static void resolve_lexical_slots(imc_info_t * imcc, IMC_Unit *unit)>
+
+Rewrites each C<find_lex> and C<store_lex> of a constant name which can be
+resolved at compile time into C<find_lex_slot> or C<store_lex_slot>, which
+carry the C<:outer> depth and register of the lexical besides its name.
+The register allocator must have run already.
+
+=cut
+
+*/
+
+static void
+resolve_lexical_slots(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(resolve_lexical_slots)
+    Instruction *ins;
+
+    /* an HLL with its own LexInfo may also lay out its pads differently */
+    if (Parrot_hll_get_ctx_HLL_type(imcc->interp, enum_class_LexInfo)
+            != enum_class_LexInfo)
+        return;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        SymReg     *regs[4];
+        SymReg     *name, *value;
+        Instruction *tmp;
+        const char *op;
+        char        buf[32];
+        INTVAL      depth;
+        int         slot;
+
+        if (ins->symreg_count != 2)
+            continue;
+
+        if (STREQ(ins->opname, "find_lex")) {
+            op    = "find_lex_slot";
+            name  = ins->symregs[1];
+            value = ins->symregs[0];
+        }
+        else if (STREQ(ins->opname, "store_lex")) {
+            op    = "store_lex_slot";
+            name  = ins->symregs[0];
+            value = ins->symregs[1];
+        }
+        else
+            continue;
+
+        if (name->set != 'S' || !(name->type & VTCONST))
+            continue;
+
+        /* store_lex_slot takes no PMC constant */
+        if (value->set == 'P' && (value->type & VTCONST))
+            continue;
+
+        slot = find_lexical_slot(imcc, unit, name, value->set, &depth);
+        if (slot < 0)
+            continue;
+
+        regs[0] = ins->symregs[0];
+        regs[1] = ins->symregs[1];
+
+        snprintf(buf, sizeof (buf), "%d", (int)depth);
+        regs[2] = mk_const(imcc, buf, 'I');
+        snprintf(buf, sizeof (buf), "%d", slot);
+        regs[3] = mk_const(imcc, buf, 'I');
+
+        /* registers were counted before this pass; keep the constants */
+        regs[2]->use_count++;
+        regs[3]->use_count++;
+
+        IMCC_debug(imcc, DEBUG_PBC, "lexical %s at depth %d slot %d\n",
+                name->name, (int)depth, slot);
+
+        tmp = INS(imcc, unit, op, "", regs, 4, 0, 0);
+        subst_ins(unit, ins, tmp);
+        ins = tmp;
+    }
+}
+
+
 /*
 
 =item C<void e_pbc_new_sub(imc_info_t * imcc, void *param, IMC_Unit *unit)>
@@ -2209,6 +2414,8 @@ e_pbc_new_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGIN(IMC_Unit *unit
     if (!unit->instructions)
         return;
 
+    resolve_lexical_slots(imcc, unit);
+
     /* we start a new compilation unit */
     make_new_sub(imcc, unit);
 }
@@ -2260,6 +2467,7 @@ e_pbc_end_sub(ARGMOD(imc_info_t * imcc), SHIM(void *param), ARGIN(IMC_Unit *unit
            to find a better mechanism to do this. */
         PackFile_fixup_subs(imcc->interp, PBC_IMMEDIATE, NULL);
 
+        imcc->ran_immediate = 1;
         imcc->globals  = g;
         memmove(&imcc->ghash, &ghash, sizeof (SymHash));
     }
@@ -21,6 +21,10 @@ The following parts are just missing:
  - Renumbering
  - Coalescing
 
+Without optimization every symbolic register gets a register of its own.
+From C<-O1> on, the live range of each symbolic register is computed from
+the CFG, and registers whose live ranges don't overlap share a register.
+
 =head2 Functions
 
 =over 4
@@ -32,6 +36,14 @@ The following parts are just missing:
 #include <string.h>
 #include "imc.h"
 #include "optimizer.h"
+#include "parrot/oplib/core_ops.h"
+
+/* the instructions a symbolic register is live at, in instruction order */
+typedef struct live_range {
+    SymReg *reg;
+    int     first;
+    int     last;
+} live_range;
 
 /* HEADERIZER HFILE: compilers/imcc/imc.h */
 
@@ -61,15 +73,49 @@ static void build_reglist(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(*unit);
 
+static void color_live_ranges(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit),
+    ARGMOD(live_range *ranges),
+    unsigned int n,
+    int reg_set)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit)
+        FUNC_MODIFIES(*ranges);
+
 static void compute_du_chain(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+static void compute_liveness(
+    ARGMOD(imc_info_t * imcc),
+    ARGIN(const IMC_Unit *unit),
+    ARGMOD(live_range *ranges),
+    unsigned int n,
+    ARGOUT(Set **live_in),
+    ARGOUT(Set **live_out))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(5)
+        __attribute__nonnull__(6)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*ranges)
+        FUNC_MODIFIES(*live_in)
+        FUNC_MODIFIES(*live_out);
+
 static void compute_one_du_chain(ARGMOD(SymReg *r), ARGIN(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*r);
 
+static void extend_live_range(ARGMOD(live_range *range), int index)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*range);
+
 PARROT_WARN_UNUSED_RESULT
 static unsigned int first_avail(
     ARGMOD(imc_info_t * imcc),
@@ -85,6 +131,24 @@ static void imc_stat_init(ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*unit);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int live_range_candidate(ARGIN(const SymReg *r))
+        __attribute__nonnull__(1);
+
+PARROT_WARN_UNUSED_RESULT
+static int live_range_cmp(ARGIN(const void *a), ARGIN(const void *b))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static int liveness_reg_alloc(
+    ARGMOD(imc_info_t * imcc),
+    ARGMOD(IMC_Unit *unit))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(* imcc)
+        FUNC_MODIFIES(*unit);
+
 static void make_stat(
     ARGMOD(IMC_Unit *unit),
     ARGMOD_NULLOK(int *sets),
@@ -94,6 +158,43 @@ static void make_stat(
         FUNC_MODIFIES(*sets)
         FUNC_MODIFIES(*cols);
 
+static void note_operand(
+    ARGIN(const Instruction *ins),
+    ARGIN(const SymReg *r),
+    ARGMOD(live_range *ranges),
+    ARGMOD(Set *use),
+    ARGMOD(Set *def))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*ranges)
+        FUNC_MODIFIES(*use)
+        FUNC_MODIFIES(*def);
+
+static void note_operands(
+    ARGIN(const Instruction *ins),
+    ARGMOD(live_range *ranges),
+    ARGMOD(Set *use),
+    ARGMOD(Set *def))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*ranges)
+        FUNC_MODIFIES(*use)
+        FUNC_MODIFIES(*def);
+
+static void pin_live_ranges(
+    ARGMOD(live_range *ranges),
+    unsigned int n,
+    ARGIN(const Set *live),
+    int last)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*ranges);
+
 static void print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -126,18 +227,52 @@ static void vanilla_reg_alloc(
 #define ASSERT_ARGS_build_reglist __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_color_live_ranges __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ranges))
 #define ASSERT_ARGS_compute_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_compute_liveness __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit) \
+    , PARROT_ASSERT_ARG(ranges) \
+    , PARROT_ASSERT_ARG(live_in) \
+    , PARROT_ASSERT_ARG(live_out))
 #define ASSERT_ARGS_compute_one_du_chain __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(r) \
     , PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_extend_live_range __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(range))
 #define ASSERT_ARGS_first_avail __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_imc_stat_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_live_range_candidate __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(r))
+#define ASSERT_ARGS_live_range_cmp __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(a) \
+    , PARROT_ASSERT_ARG(b))
+#define ASSERT_ARGS_liveness_reg_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(imcc) \
+    , PARROT_ASSERT_ARG(unit))
 #define ASSERT_ARGS_make_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(unit))
+#define ASSERT_ARGS_note_operand __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(r) \
+    , PARROT_ASSERT_ARG(ranges) \
+    , PARROT_ASSERT_ARG(use) \
+    , PARROT_ASSERT_ARG(def))
+#define ASSERT_ARGS_note_operands __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ins) \
+    , PARROT_ASSERT_ARG(ranges) \
+    , PARROT_ASSERT_ARG(use) \
+    , PARROT_ASSERT_ARG(def))
+#define ASSERT_ARGS_pin_live_ranges __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(ranges) \
+    , PARROT_ASSERT_ARG(live))
 #define ASSERT_ARGS_print_stat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(unit))
@@ -168,6 +303,7 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
 {
     ASSERT_ARGS(imc_reg_alloc)
     const char *function;
+    int         first;
 
     if (!unit)
         return;
@@ -188,7 +324,8 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     IMCC_debug(imcc, DEBUG_IMC, "processing sub %s\n", function);
     IMCC_debug(imcc, DEBUG_IMC, "------------------------\n\n");
 
-    if (imcc->optimizer_level == OPT_PRE && unit->pasm_file) {
+    /* the SSA passes leave registers named in PASM alone */
+    if ((imcc->optimizer_level & ~OPT_SSA) == OPT_PRE && unit->pasm_file) {
         while (pre_optimize(imcc, unit))
             ;
         goto done;
@@ -197,9 +334,10 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     /* all lexicals get a unique register */
     allocate_lexicals(imcc, unit);
 
-    /* build CFG and life info, and optimize iteratively */
+    /* build CFG and life info, and optimize iteratively; the calling
+     * conventions are expanded by the first pass only */
+    first = 1;
     do {
-        int first = 1;
         do {
             while (pre_optimize(imcc, unit)) { };
 
@@ -222,8 +360,8 @@ imc_reg_alloc(ARGMOD(imc_info_t * imcc), ARGIN_NULLOK(IMC_Unit *unit))
     if (imcc->debug & DEBUG_IMC)
         dump_symreg(unit);
 
-    /* TODO add option for a better allocator */
-    vanilla_reg_alloc(imcc, unit);
+    if (!(imcc->optimizer_level & OPT_PRE) || !liveness_reg_alloc(imcc, unit))
+        vanilla_reg_alloc(imcc, unit);
 
     if (imcc->debug & DEBUG_IMC)
         dump_instructions(imcc, unit);
@@ -353,6 +491,8 @@ print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 {
     ASSERT_ARGS(print_stat)
     int sets[4] = {0, 0, 0, 0};
+    int saved[4];
+    int j;
 
     const char * const function =
         unit->instructions->symreg_count
@@ -370,18 +510,28 @@ print_stat(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
               "%d if_branch, %d branch_branch\n",
               unit->ostat.deleted_labels, unit->ostat.deleted_ins,
               unit->ostat.if_branch, unit->ostat.branch_branch);
-    IMCC_info(imcc, 1, "\t%d branch_cond_loop\n",
-              unit->ostat.branch_cond_loop);
     IMCC_info(imcc, 1, "\t%d used once deleted\n",
               unit->ostat.used_once);
     IMCC_info(imcc, 1, "\t%d invariants_moved\n",
               unit->ostat.invariants_moved);
+    IMCC_info(imcc, 1, "\t%d copies propagated, %d values numbered, %d ops unboxed\n",
+              unit->ostat.copies_propagated, unit->ostat.values_numbered,
+              unit->ostat.ops_unboxed);
     IMCC_info(imcc, 1, "\tregisters needed:\t I%d, N%d, S%d, P%d\n",
             sets[0], sets[1], sets[2], sets[3]);
     IMCC_info(imcc, 1,
-            "\tregisters in .pasm:\t I%d, N%d, S%d, P%d - %d\n",
+            "\tregisters in .pasm:\t I%d, N%d, S%d, P%d\n",
             unit->n_regs_used[0], unit->n_regs_used[1],
             unit->n_regs_used[2], unit->n_regs_used[3]);
+
+    /* one register per symbol is what the frame would take without sharing */
+    for (j = 0; j < 4; j++)
+        saved[j] = sets[j] > unit->n_regs_used[j]
+                 ? sets[j] - unit->n_regs_used[j]
+                 : 0;
+
+    IMCC_info(imcc, 1, "\tregisters shared:\t I%d, N%d, S%d, P%d\n",
+            saved[0], saved[1], saved[2], saved[3]);
     IMCC_info(imcc, 1, "\t%d basic_blocks, %d edges\n",
             unit->n_basic_blocks, edge_count(unit));
 }
@@ -764,6 +914,499 @@ vanilla_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
 
 /*
 
+=item C<static int live_range_candidate(const SymReg *r)>
+
+Returns true if the symbol C<r> gets a live range of its own.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_PURE_FUNCTION
+static int
+live_range_candidate(ARGIN(const SymReg *r))
+{
+    ASSERT_ARGS(live_range_candidate)
+
+    if (!REG_NEEDS_ALLOC(r))
+        return 0;
+
+    return r->set == 'I' || r->set == 'N' || r->set == 'S' || r->set == 'P';
+}
+
+/*
+
+=item C<static void extend_live_range(live_range *range, int index)>
+
+Stretches C<range> to cover the instruction numbered C<index>.
+
+=cut
+
+*/
+
+static void
+extend_live_range(ARGMOD(live_range *range), int index)
+{
+    ASSERT_ARGS(extend_live_range)
+
+    if (range->first < 0 || index < range->first)
+        range->first = index;
+
+    if (index > range->last)
+        range->last = index;
+}
+
+/*
+
+=item C<static void note_operand(const Instruction *ins, const SymReg *r,
+live_range *ranges, Set *use, Set *def)>
+
+Records how C<ins> uses the symbol C<r>: a read not preceded by a write in the
+same block goes into C<use>, a write into C<def>, and either stretches the live
+range of C<r> over C<ins>.
+
+=cut
+
+*/
+
+static void
+note_operand(ARGIN(const Instruction *ins), ARGIN(const SymReg *r),
+        ARGMOD(live_range *ranges), ARGMOD(Set *use), ARGMOD(Set *def))
+{
+    ASSERT_ARGS(note_operand)
+    int reads, writes;
+
+    /* while live ranges are computed, a candidate's color is its index */
+    if (!live_range_candidate(r) || r->color < 0)
+        return;
+
+    reads  = instruction_reads(ins, r);
+    writes = instruction_writes(ins, r);
+
+    if (!reads && !writes)
+        return;
+
+    if (reads && !set_contains(def, (unsigned int)r->color))
+        set_add(use, (unsigned int)r->color);
+
+    if (writes)
+        set_add(def, (unsigned int)r->color);
+
+    extend_live_range(&ranges[r->color], (int)ins->index);
+}
+
+/*
+
+=item C<static void note_operands(const Instruction *ins, live_range *ranges,
+Set *use, Set *def)>
+
+Records every symbol C<ins> reads or writes, including registers used in keys
+and, for a sub call, its arguments and results.
+
+=cut
+
+*/
+
+static void
+note_operands(ARGIN(const Instruction *ins), ARGMOD(live_range *ranges),
+        ARGMOD(Set *use), ARGMOD(Set *def))
+{
+    ASSERT_ARGS(note_operands)
+    op_lib_t * const   core_ops = PARROT_GET_CORE_OPLIB(NULL);
+    const Instruction *call;
+    int                i;
+
+    for (i = 0; i < ins->symreg_count; i++) {
+        const SymReg * const r = ins->symregs[i];
+        const SymReg        *key;
+
+        note_operand(ins, r, ranges, use, def);
+
+        if (r->set == 'K')
+            for (key = r->nextkey; key; key = key->nextkey)
+                if (key->reg)
+                    note_operand(ins, key->reg, ranges, use, def);
+    }
+
+    if (!(ins->type & ITPCCSUB))
+        return;
+
+    /* the same set_args and get_results instruction_reads and _writes find */
+    for (call = ins; call; call = call->prev) {
+        if (call->op == &core_ops->op_info_table[PARROT_OP_set_args_pc]) {
+            for (i = 0; i < call->symreg_count; i++)
+                note_operand(ins, call->symregs[i], ranges, use, def);
+            break;
+        }
+    }
+
+    for (call = ins->prev; call; call = call->next) {
+        if (call->op == &core_ops->op_info_table[PARROT_OP_get_results_pc]) {
+            for (i = 0; i < call->symreg_count; i++)
+                note_operand(ins, call->symregs[i], ranges, use, def);
+            break;
+        }
+    }
+}
+
+/*
+
+=item C<static void compute_liveness(imc_info_t * imcc, const IMC_Unit *unit,
+live_range *ranges, unsigned int n, Set **live_in, Set **live_out)>
+
+Computes the symbols live on entry to and on exit from each basic block,
+iterating C<live_in = use + (live_out - def)> backwards over the CFG until
+nothing changes. Each live range is stretched over the instructions using its symbol
+and over the ends of the blocks the symbol is live through, so ranges which
+don't overlap never hold a value at the same time.
+
+=cut
+
+*/
+
+static void
+compute_liveness(ARGMOD(imc_info_t * imcc), ARGIN(const IMC_Unit *unit),
+        ARGMOD(live_range *ranges), unsigned int n, ARGOUT(Set **live_in),
+        ARGOUT(Set **live_out))
+{
+    ASSERT_ARGS(compute_liveness)
+    const unsigned int n_bb = unit->n_basic_blocks;
+    Set              **use  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_bb, Set *);
+    Set              **keep = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_bb, Set *);
+    unsigned int       i, j;
+    int                changed;
+
+    for (i = 0; i < n_bb; i++) {
+        const Basic_block * const bb  = unit->bb_list[i];
+        Set               * const def = set_make(imcc, n);
+        const Instruction        *ins;
+
+        use[i]      = set_make(imcc, n);
+        live_in[i]  = set_make(imcc, n);
+        live_out[i] = set_make(imcc, n);
+
+        for (ins = bb->start; ins; ins = ins->next) {
+            note_operands(ins, ranges, use[i], def);
+
+            if (ins == bb->end)
+                break;
+        }
+
+        /* a block passes on everything it doesn't write */
+        keep[i] = set_make_full(imcc, n);
+
+        for (j = 0; j < n; j++)
+            if (set_contains(def, j))
+                set_remove(keep[i], j);
+
+        set_free(def);
+    }
+
+    do {
+        changed = 0;
+
+        for (i = n_bb; i-- > 0;) {
+            const Edge *e;
+            Set        *in;
+
+            set_clear(live_out[i]);
+
+            for (e = unit->bb_list[i]->succ_list; e; e = e->succ_next)
+                set_union_inplace(live_out[i], live_in[e->to->index]);
+
+            in = set_copy(imcc, live_out[i]);
+            set_intersec_inplace(in, keep[i]);
+            set_union_inplace(in, use[i]);
+
+            if (set_equal(in, live_in[i]))
+                set_free(in);
+            else {
+                set_free(live_in[i]);
+                live_in[i] = in;
+                changed    = 1;
+            }
+        }
+    } while (changed);
+
+    for (i = 0; i < n_bb; i++) {
+        const Basic_block * const bb = unit->bb_list[i];
+
+        for (j = 0; j < n; j++) {
+            if (set_contains(live_in[i], j))
+                extend_live_range(&ranges[j], (int)bb->start->index);
+
+            if (set_contains(live_out[i], j))
+                extend_live_range(&ranges[j], (int)bb->end->index);
+        }
+
+        set_free(use[i]);
+        set_free(keep[i]);
+    }
+
+    mem_sys_free(use);
+    mem_sys_free(keep);
+}
+
+/*
+
+=item C<static void pin_live_ranges(live_range *ranges, unsigned int n, const
+Set *live, int last)>
+
+Stretches the ranges of all symbols in C<live> over the whole unit, up to the
+instruction numbered C<last>, so they keep a register of their own.
+
+=cut
+
+*/
+
+static void
+pin_live_ranges(ARGMOD(live_range *ranges), unsigned int n, ARGIN(const Set *live),
+        int last)
+{
+    ASSERT_ARGS(pin_live_ranges)
+    unsigned int j;
+
+    for (j = 0; j < n; j++) {
+        if (set_contains(live, j)) {
+            ranges[j].first = 0;
+            ranges[j].last  = last;
+        }
+    }
+}
+
+/*
+
+=item C<static int live_range_cmp(const void *a, const void *b)>
+
+Sorts live ranges by the instruction they start at.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+live_range_cmp(ARGIN(const void *a), ARGIN(const void *b))
+{
+    ASSERT_ARGS(live_range_cmp)
+    const live_range * const ra = *(const live_range * const *)a;
+    const live_range * const rb = *(const live_range * const *)b;
+
+    return ra->first - rb->first;
+}
+
+/*
+
+=item C<static void color_live_ranges(imc_info_t * imcc, IMC_Unit *unit,
+live_range *ranges, unsigned int n, int reg_set)>
+
+Linear scan over the live ranges of one register set: walking them in order of
+their start, each takes the lowest register not held by a range still live.
+Symbols no instruction uses never hold a value and get register 0.
+
+=cut
+
+*/
+
+static void
+color_live_ranges(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit),
+        ARGMOD(live_range *ranges), unsigned int n, int reg_set)
+{
+    ASSERT_ARGS(color_live_ranges)
+    const SymHash * const hsh      = &unit->hash;
+    live_range   ** const order    = mem_gc_allocate_n_zeroed_typed(imcc->interp, n, live_range *);
+    live_range   ** const active   = mem_gc_allocate_n_zeroed_typed(imcc->interp, n, live_range *);
+    Set           * const busy     = set_make(imcc, n + 1);
+    unsigned int          i, count, n_active;
+
+    for (i = count = 0; i < n; i++)
+        if (ranges[i].reg->set == reg_set)
+            order[count++] = &ranges[i];
+
+    /* symbols no instruction uses never hold a value */
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+
+        for (r = hsh->data[i]; r; r = r->next)
+            if (r->set == reg_set && REG_NEEDS_ALLOC(r) && r->color < 0)
+                r->color = 0;
+    }
+
+    qsort(order, count, sizeof (live_range *), live_range_cmp);
+
+    for (i = n_active = 0; i < count; i++) {
+        live_range * const range = order[i];
+        unsigned int       k;
+
+        /* ranges ended before this one starts give their registers back */
+        for (k = 0; k < n_active;) {
+            if (active[k]->last < range->first) {
+                set_remove(busy, (unsigned int)active[k]->reg->color);
+                active[k] = active[--n_active];
+            }
+            else
+                k++;
+        }
+
+        range->reg->color = set_first_zero(busy);
+        set_add(busy, (unsigned int)range->reg->color);
+        active[n_active++] = range;
+
+        IMCC_debug(imcc, DEBUG_IMC, "live range %c '%s' %d-%d color %d\n",
+                reg_set, range->reg->name, range->first, range->last,
+                (int)range->reg->color);
+    }
+
+    set_free(busy);
+    mem_sys_free(active);
+    mem_sys_free(order);
+}
+
+/*
+
+=item C<static int liveness_reg_alloc(imc_info_t * imcc, IMC_Unit *unit)>
+
+Register allocator used from C<-O1> on: symbols whose live ranges don't
+overlap share a register, so a frame only needs as many registers as are live
+at once.
+
+Some control flow the CFG can't follow: exception handlers and continuations
+resume at their label from wherever they are invoked, and the return
+continuation of a sub call may be invoked again long after the call returned,
+as backtracking does. Symbols live at such a label or across a call keep a
+register of their own, so whatever resumes there finds them as they were.
+
+Returns 0 without allocating if the control flow of the unit can't be
+followed at all; the caller then falls back to C<vanilla_reg_alloc>.
+
+=cut
+
+*/
+
+static int
+liveness_reg_alloc(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
+{
+    ASSERT_ARGS(liveness_reg_alloc)
+    const char         type[] = "INSP";
+    const SymHash     *hsh    = &unit->hash;
+    const Instruction *ins;
+    live_range        *ranges;
+    Set              **live_in;
+    Set              **live_out;
+    unsigned int       i, j, n, n_bb;
+    int                last   = 0;
+    int                ok     = 1;
+
+    /* computed jumps and local subroutines leave the CFG */
+    if (imcc->dont_optimize || !unit->n_basic_blocks || !unit->n_symbols)
+        return 0;
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        if (STREQ(ins->opname, "local_return"))
+            return 0;
+
+        last = (int)ins->index;
+    }
+
+    for (i = 0; i < hsh->size; i++) {
+        SymReg *r;
+
+        for (r = hsh->data[i]; r; r = r->next) {
+            /* registers named in .pasm keep the number they were given */
+            if (REG_NEEDS_ALLOC(r) && (r->type & VTPASM))
+                return 0;
+
+            if (live_range_candidate(r))
+                r->color = -1;
+        }
+    }
+
+    ranges = mem_gc_allocate_n_zeroed_typed(imcc->interp, unit->n_symbols, live_range);
+
+    for (i = n = 0; i < unit->n_symbols; i++) {
+        SymReg * const r = unit->reglist[i];
+
+        if (live_range_candidate(r)) {
+            ranges[n].reg   = r;
+            ranges[n].first = -1;
+            ranges[n].last  = -1;
+            r->color        = n++;
+        }
+    }
+
+    if (!n) {
+        mem_sys_free(ranges);
+        return 0;
+    }
+
+    n_bb     = unit->n_basic_blocks;
+    live_in  = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_bb, Set *);
+    live_out = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_bb, Set *);
+    compute_liveness(imcc, unit, ranges, n, live_in, live_out);
+
+    /* a call ends its basic block */
+    for (i = 0; i < n_bb; i++) {
+        const Instruction * const end = unit->bb_list[i]->end;
+
+        if ((end->type & ITPCCSUB)
+        ||  STREQ(end->opname, "invokecc")
+        ||  STREQ(end->opname, "callmethodcc"))
+            pin_live_ranges(ranges, n, live_out[i], last);
+    }
+
+    for (ins = unit->instructions; ins; ins = ins->next) {
+        const SymReg *label, *addr;
+
+        if (!STREQ(ins->opname, "push_eh")
+        &&  !STREQ(ins->opname, "set_label")
+        &&  !STREQ(ins->opname, "set_addr")
+        &&  !STREQ(ins->opname, "runinterp"))
+            continue;
+
+        label = get_branch_reg(ins);
+
+        if (!label)
+            continue;
+
+        addr = find_sym(imcc, label->name);
+
+        if (!addr || !(addr->type & VTADDRESS) || !addr->first_ins) {
+            ok = 0;
+            break;
+        }
+
+        pin_live_ranges(ranges, n, live_in[addr->first_ins->bbindex], last);
+    }
+
+    if (ok) {
+        for (j = 0; j < n; j++) {
+            /* lexicals are reached through the LexPad, from other frames
+             * too; symbols not seen in any instruction we don't guess at */
+            if (ranges[j].first < 0 || (ranges[j].reg->usage & U_LEXICAL)) {
+                ranges[j].first = 0;
+                ranges[j].last  = last;
+            }
+        }
+
+        for (j = 0; j < 4; j++)
+            color_live_ranges(imcc, unit, ranges, n, type[j]);
+    }
+
+    for (i = 0; i < n_bb; i++) {
+        set_free(live_in[i]);
+        set_free(live_out[i]);
+    }
+
+    mem_sys_free(live_in);
+    mem_sys_free(live_out);
+    mem_sys_free(ranges);
+
+    return ok;
+}
+
+/*
+
 =item C<static void allocate_lexicals(imc_info_t * imcc, IMC_Unit *unit)>
 
 Allocate registers for lexical variables. These must have unique registers
@@ -156,7 +156,7 @@ _get_sym_typed(ARGIN(const SymHash *hsh), ARGIN(const char *name), int t)
 {
     ASSERT_ARGS(_get_sym_typed)
     SymReg            *p;
-    const unsigned int i = hash_str(name) % hsh->size;
+    const unsigned int i = hash_str(name) & (hsh->size - 1);
 
     for (p = hsh->data[i]; p; p = p->next) {
         if ((t == p->set) && STREQ(name, p->name))
@@ -185,7 +185,7 @@ get_sym_by_name(ARGIN(const SymHash *hsh), ARGIN(const char *name))
     ASSERT_ARGS(get_sym_by_name)
 
     SymReg            *p;
-    const unsigned int i = hash_str(name) % hsh->size;
+    const unsigned int i = hash_str(name) & (hsh->size - 1);
 
     for (p = hsh->data[i]; p; p = p->next) {
         if (STREQ(name, p->name))
@@ -219,10 +219,10 @@ _mk_symreg(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh),
     SymReg * r = _get_sym_typed(hsh, name, t);
 
     if (!r) {
-        r             = mem_gc_allocate_zeroed_typed(imcc->interp, SymReg);
+        r             = (SymReg *)imcc_arena_alloc(&hsh->arena, sizeof (SymReg));
         r->set        = t;
         r->type       = VTREG;
-        r->name       = mem_sys_strdup(name);
+        r->name       = imcc_arena_strdup(&hsh->arena, name);
         r->color      = -1;
         r->want_regno = -1;
 
@@ -380,21 +380,15 @@ add_namespace(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit))
     if (unit->prev && unit->prev->_namespace == ns)
         unit->_namespace = ns;
     else {
-        SymReg * const g = dup_sym(imcc, ns);
+        SymReg * const g = dup_sym(&imcc->ghash, ns);
         SymReg * const r = _get_sym(&imcc->ghash, g->name);
 
         unit->_namespace     = g;
         g->reg               = ns;
         g->type              = VT_CONSTP;
 
-        /* this unit should free its namespace only if it's the only thing
-         * holding onto it */
-        if (!r || r->type != VT_CONSTP) {
+        if (!r || r->type != VT_CONSTP)
             _store_symreg(imcc, &imcc->ghash, g);
-            unit->owns_namespace = 0;
-        }
-        else
-            unit->owns_namespace = 1;
     }
 }
 
@@ -652,8 +646,7 @@ mk_pmc_const_2(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit),
     ASSERT_ARGS(mk_pmc_const_2)
     /* XXX This always returns NULL.  Probably shouldn't return anything then. */
     SymReg *r[3];
-    char   *name;
-    int     len;
+    size_t  len;
 
     if (imcc->state->pasm_file)
         IMCC_fataly(imcc, EXCEPTION_SYNTAX_ERROR,
@@ -662,13 +655,10 @@ mk_pmc_const_2(ARGMOD(imc_info_t * imcc), ARGMOD(IMC_Unit *unit),
     r[0] = left;
 
     /* strip delimiters */
-    name          = mem_sys_strdup(rhs->name + 1);
-    len           = strlen(name);
-    name[len - 1] = '\0';
-
-    mem_sys_free(rhs->name);
+    len = strlen(rhs->name) - 2;
+    memmove(rhs->name, rhs->name + 1, len);
+    rhs->name[len] = '\0';
 
-    rhs->name     = name;
     rhs->set      = 'P';
     rhs->pmc_type = left->pmc_type;
 
@@ -932,9 +922,9 @@ _mk_address(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh),
         if (r && r->usage & U_LEXICAL)
             is_lexical = 1;
 
-        r       = mem_gc_allocate_zeroed_typed(imcc->interp, SymReg);
+        r       = (SymReg *)imcc_arena_alloc(&hsh->arena, sizeof (SymReg));
         r->type = VTADDRESS;
-        r->name = mem_sys_strdup(name);
+        r->name = imcc_arena_strdup(&hsh->arena, name);
         _store_symreg(imcc, hsh, r);
 
         if (is_lexical)
@@ -1070,7 +1060,10 @@ mk_label_address(ARGMOD(imc_info_t * imcc), ARGIN(const char *name))
 
 /*
 
-=item C<SymReg * dup_sym(imc_info_t * imcc, const SymReg *r)>
+=item C<SymReg * dup_sym(SymHash *hsh, const SymReg *r)>
+
+Copies C<r> and its chain of keys into the arena of C<hsh>, without storing
+the copy in C<hsh>.
 
 Links keys to a keys structure = SymReg
 
@@ -1106,25 +1099,23 @@ what         op      type        pbc.c:build_key()
  We can't use the consts or keys in the chain directly,
  because a different usage would destroy the ->nextkey pointers
  so these are all copies.
- XXX and currently not freed
 
 =cut
 
 */
 
-PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 SymReg *
-dup_sym(ARGMOD(imc_info_t * imcc), ARGIN(const SymReg *r))
+dup_sym(ARGMOD(SymHash *hsh), ARGIN(const SymReg *r))
 {
     ASSERT_ARGS(dup_sym)
-    SymReg * const new_sym = mem_gc_allocate_zeroed_typed(imcc->interp, SymReg);
+    SymReg * const new_sym = (SymReg *)imcc_arena_alloc(&hsh->arena, sizeof (SymReg));
     STRUCT_COPY(new_sym, r);
     if (r->name)
-        new_sym->name = mem_sys_strdup(r->name);
+        new_sym->name = imcc_arena_strdup(&hsh->arena, r->name);
 
     if (r->nextkey)
-        new_sym->nextkey = dup_sym(imcc, r->nextkey);
+        new_sym->nextkey = dup_sym(hsh, r->nextkey);
 
     return new_sym;
 }
@@ -1141,7 +1132,6 @@ Links keys together in a keychain.
 
 */
 
-PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
 SymReg *
 link_keys(ARGMOD(imc_info_t * imcc), int nargs, ARGMOD(SymReg **keys), int force)
@@ -1187,7 +1177,7 @@ link_keys(ARGMOD(imc_info_t * imcc), int nargs, ARGMOD(SymReg **keys), int force
     }
 
     /* no, need a new one */
-    keychain       = mem_gc_allocate_zeroed_typed(imcc->interp, SymReg);
+    keychain       = (SymReg *)imcc_arena_alloc(&h->arena, sizeof (SymReg));
     keychain->type = VTCONST;
 
     ++keychain->use_count;
@@ -1200,7 +1190,7 @@ link_keys(ARGMOD(imc_info_t * imcc), int nargs, ARGMOD(SymReg **keys), int force
         if (REG_NEEDS_ALLOC(keys[i]))
             keychain->type |= VTREGKEY;
 
-        key->nextkey = dup_sym(imcc, keys[i]);
+        key->nextkey = dup_sym(h, keys[i]);
         key          = key->nextkey;
 
         /* for registers, point ->reg to the original, needed by
@@ -1209,10 +1199,12 @@ link_keys(ARGMOD(imc_info_t * imcc), int nargs, ARGMOD(SymReg **keys), int force
             key->reg = keys[i];
     }
 
-    keychain->name  = key_str;
+    keychain->name  = imcc_arena_strdup(&h->arena, key_str);
     keychain->set   = 'K';
     keychain->color = -1;
 
+    mem_sys_free(key_str);
+
     _store_symreg(imcc, h, keychain);
 
     return keychain;
@@ -1247,8 +1239,8 @@ free_pcc_sub(ARGMOD(pcc_sub_t *sub))
 
 =item C<void free_sym(SymReg *r)>
 
-Frees all memory of the specified SymReg.  If it has a pcc_sub_t entry, frees
-all memory of that structure as well.
+Frees the memory the specified SymReg holds outside of its symbol table's
+arena: that of its pcc_sub_t entry, if it has one.
 
 =cut
 
@@ -1260,22 +1252,145 @@ free_sym(ARGMOD(SymReg *r))
     ASSERT_ARGS(free_sym)
     pcc_sub_t * const sub = r->pcc_sub;
 
-    if (sub)
+    if (sub) {
         free_pcc_sub(sub);
+        r->pcc_sub = NULL;
+    }
+}
+
+/*
+ * The arena of a symbol table: SymRegs, their names and the instructions of a
+ * unit live as long as its symbols do, so they're carved out of a few large
+ * blocks and freed with the table instead of one by one.
+ */
+
+struct _IMC_Arena_Block {
+    struct _IMC_Arena_Block *prev;
+    size_t                   size;
+};
+
+#define IMC_ARENA_ALIGN(n)      (((n) + 15) & ~(size_t)15)
+#define IMC_ARENA_HEADER        IMC_ARENA_ALIGN(sizeof (struct _IMC_Arena_Block))
+#define IMC_ARENA_MIN_BLOCK     4096
+#define IMC_ARENA_MAX_BLOCK     65536
 
-    if (r->set == 'K') {
-        SymReg *key     = r->nextkey;
-        while (key) {
-            SymReg *nextkey = key->nextkey;
-            free_sym(key);
-            key = nextkey;
+/*
+
+=item C<void * imcc_arena_alloc(IMC_Arena *arena, size_t size)>
+
+Returns C<size> bytes of zeroed memory from C<arena>, which stays valid until
+the arena is destroyed.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+void *
+imcc_arena_alloc(ARGMOD(IMC_Arena *arena), size_t size)
+{
+    ASSERT_ARGS(imcc_arena_alloc)
+    char *mem;
+
+    size = IMC_ARENA_ALIGN(size);
+
+    if ((size_t)(arena->end - arena->next) < size) {
+        struct _IMC_Arena_Block *block;
+        size_t block_size = arena->blocks
+                          ? arena->blocks->size << 1
+                          : IMC_ARENA_MIN_BLOCK;
+
+        if (block_size > IMC_ARENA_MAX_BLOCK)
+            block_size = IMC_ARENA_MAX_BLOCK;
+
+        /* a large request gets a block of its own, leaving the current one
+         * to be filled */
+        if (size > block_size >> 2) {
+            block       = (struct _IMC_Arena_Block *)
+                              mem_sys_allocate_zeroed(IMC_ARENA_HEADER + size);
+            block->size = size;
+
+            if (arena->blocks) {
+                block->prev         = arena->blocks->prev;
+                arena->blocks->prev = block;
+            }
+            else
+                arena->blocks = block;
+
+            return (char *)block + IMC_ARENA_HEADER;
         }
+
+        block         = (struct _IMC_Arena_Block *)
+                            mem_sys_allocate_zeroed(IMC_ARENA_HEADER + block_size);
+        block->size   = block_size;
+        block->prev   = arena->blocks;
+        arena->blocks = block;
+        arena->next   = (char *)block + IMC_ARENA_HEADER;
+        arena->end    = arena->next + block_size;
     }
 
-    mem_sys_free(r->name);
-    mem_sys_free(r);
+    mem          = arena->next;
+    arena->next += size;
+
+    return mem;
+}
+
+
+/*
+
+=item C<char * imcc_arena_strdup(IMC_Arena *arena, const char *str)>
+
+Copies C<str> into C<arena>.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+char *
+imcc_arena_strdup(ARGMOD(IMC_Arena *arena), ARGIN(const char *str))
+{
+    ASSERT_ARGS(imcc_arena_strdup)
+    const size_t len  = strlen(str) + 1;
+    char * const copy = (char *)imcc_arena_alloc(arena, len);
+
+    memcpy(copy, str, len);
+
+    return copy;
 }
 
+
+/*
+
+=item C<void imcc_arena_destroy(IMC_Arena *arena)>
+
+Frees all the memory handed out by C<arena>, leaving it empty and ready for
+reuse.
+
+=cut
+
+*/
+
+void
+imcc_arena_destroy(ARGMOD(IMC_Arena *arena))
+{
+    ASSERT_ARGS(imcc_arena_destroy)
+    struct _IMC_Arena_Block *block = arena->blocks;
+
+    while (block) {
+        struct _IMC_Arena_Block * const prev = block->prev;
+        mem_sys_free(block);
+        block = prev;
+    }
+
+    arena->blocks = NULL;
+    arena->next   = NULL;
+    arena->end    = NULL;
+}
+
+
 /*
  * This functions manipulate the hash of symbols.
  * XXX: Migrate to use Symbol and SymbolTable
@@ -1299,6 +1414,10 @@ create_symhash(ARGMOD(imc_info_t * imcc), ARGOUT(SymHash *hash))
     hash->data    = mem_gc_allocate_n_zeroed_typed(imcc->interp, 16, SymReg *);
     hash->size    = 16;
     hash->entries = 0;
+
+    hash->arena.blocks = NULL;
+    hash->arena.next   = NULL;
+    hash->arena.end    = NULL;
 }
 
 
@@ -1316,48 +1435,28 @@ static void
 resize_symhash(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh))
 {
     ASSERT_ARGS(resize_symhash)
-    const int    new_size = hsh->size << 1; /* new size is twice as large */
-    int          n_next   = 16;
-    SymReg **next_r = mem_gc_allocate_n_zeroed_typed(imcc->interp, n_next, SymReg *);
-    SymHash      nh;                        /* new symbol table */
+    const unsigned int new_size = hsh->size << 1; /* new size is twice as large */
+    SymReg     **new_data = mem_gc_allocate_n_zeroed_typed(imcc->interp, new_size, SymReg *);
     unsigned int i;
 
-    nh.data = mem_gc_allocate_n_zeroed_typed(imcc->interp, new_size, SymReg *);
-
     for (i = 0; i < hsh->size; i++) {
         SymReg *r, *next;
-        int     k;
-        int     j = 0;
 
         for (r = hsh->data[i]; r; r = next) {
-            next = r->next;
-
-            /* remember all the chained next pointers and clear r->next */
-            if (j >= n_next) {
-                n_next <<= 1;
-                next_r = mem_gc_realloc_n_typed(imcc->interp, next_r, n_next, SymReg *);
-            }
-
-            r->next     = NULL;
-            next_r[j++] = r;
-        }
-
-        for (k = 0; k < j; ++k) {
-            int new_i;
-            r              = next_r[k];
             /* recompute hash for this symbol: */
-            new_i          = hash_str(r->name) % new_size;
-            r->next        = nh.data[new_i];
-            nh.data[new_i] = r;
+            const unsigned int new_i = hash_str(r->name) & (new_size - 1);
+
+            next            = r->next;
+            r->next         = new_data[new_i];
+            new_data[new_i] = r;
         }
     }
 
     /* free memory of old hash table */
     mem_sys_free(hsh->data);
-    mem_sys_free(next_r);
 
     /* let the hashtable's data pointers point to the new data */
-    hsh->data = nh.data;
+    hsh->data = new_data;
     hsh->size = new_size;
 }
 
@@ -1377,7 +1476,7 @@ _store_symreg(ARGMOD(imc_info_t * imcc), ARGMOD(SymHash *hsh),
         ARGMOD(SymReg *r))
 {
     ASSERT_ARGS(_store_symreg)
-    const int i = hash_str(r->name) % hsh->size;
+    const unsigned int i = hash_str(r->name) & (hsh->size - 1);
     r->next      = hsh->data[i];
     hsh->data[i] = r;
 
@@ -1423,7 +1522,7 @@ _get_sym(ARGIN(const SymHash *hsh), ARGIN(const char *name))
 {
     ASSERT_ARGS(_get_sym)
     SymReg   *p;
-    const unsigned int i = hash_str(name) % hsh->size;
+    const unsigned int i = hash_str(name) & (hsh->size - 1);
 
     for (p = hsh->data[i]; p; p = p->next) {
         if (STREQ(name, p->name))
@@ -1527,7 +1626,8 @@ find_sym(ARGMOD(imc_info_t * imcc), ARGIN(const char *name))
 
 =item C<void clear_sym_hash(SymHash *hsh)>
 
-Frees all memory of the symbols in the specified hash table.
+Frees all memory of the symbols in the specified hash table, along with its
+arena.
 
 =cut
 
@@ -1554,6 +1654,7 @@ clear_sym_hash(ARGMOD(SymHash *hsh))
     }
 
     mem_sys_free(hsh->data);
+    imcc_arena_destroy(&hsh->arena);
 
     hsh->data    = NULL;
     hsh->entries = 0;
@@ -1561,39 +1662,6 @@ clear_sym_hash(ARGMOD(SymHash *hsh))
 }
 
 
-/*
-
-=item C<void clear_locals(IMC_Unit *unit)>
-
-Deletes all local symbols and clears life info from the given IMC_Unit.
-
-=cut
-
-*/
-
-void
-clear_locals(ARGIN_NULLOK(IMC_Unit *unit))
-{
-    ASSERT_ARGS(clear_locals)
-    SymHash * const hsh = &unit->hash;
-    unsigned int    i;
-
-    for (i = 0; i < hsh->size; i++) {
-        SymReg *p;
-
-        for (p = hsh->data[i]; p;) {
-            SymReg * const next = p->next;
-            free_sym(p);
-            p = next;
-        }
-
-        hsh->data[i] = NULL;
-    }
-
-    hsh->entries = 0;
-}
-
-
 /*
 
 =item C<void clear_globals(imc_info_t * imcc)>
@@ -63,10 +63,19 @@ typedef struct _SymReg {
     int                  pmc_type;      /* class enum */
 } SymReg;
 
+/* Memory handed out in order from a list of blocks and released all at once;
+ * a symbol table keeps its SymRegs and their names in one */
+typedef struct _IMC_Arena {
+    struct _IMC_Arena_Block *blocks;    /* newest first */
+    char                    *next;      /* free space in the newest block */
+    char                    *end;
+} IMC_Arena;
+
 typedef struct _SymHash {
     SymReg     **data;
-    unsigned int size;
+    unsigned int size;                  /* always a power of two */
     unsigned int entries;
+    IMC_Arena    arena;
 } SymHash;
 
 /* namespaces */
@@ -246,7 +255,6 @@ void clear_globals(ARGMOD(imc_info_t * imcc))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(* imcc);
 
-void clear_locals(ARGIN_NULLOK(IMC_Unit *unit));
 void clear_sym_hash(ARGMOD(SymHash *hsh))
         __attribute__nonnull__(1)
         FUNC_MODIFIES(*hsh);
@@ -257,12 +265,11 @@ void create_symhash(ARGMOD(imc_info_t * imcc), ARGOUT(SymHash *hash))
         FUNC_MODIFIES(* imcc)
         FUNC_MODIFIES(*hash);
 
-PARROT_MALLOC
 PARROT_CANNOT_RETURN_NULL
-SymReg * dup_sym(ARGMOD(imc_info_t * imcc), ARGIN(const SymReg *r))
+SymReg * dup_sym(ARGMOD(SymHash *hsh), ARGIN(const SymReg *r))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
-        FUNC_MODIFIES(* imcc);
+        FUNC_MODIFIES(*hsh);
 
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -291,6 +298,22 @@ unsigned int hash_str(ARGIN(const char *str))
         __attribute__nonnull__(1);
 
 PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+void * imcc_arena_alloc(ARGMOD(IMC_Arena *arena), size_t size)
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*arena);
+
+void imcc_arena_destroy(ARGMOD(IMC_Arena *arena))
+        __attribute__nonnull__(1)
+        FUNC_MODIFIES(*arena);
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+char * imcc_arena_strdup(ARGMOD(IMC_Arena *arena), ARGIN(const char *str))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*arena);
+
 PARROT_CANNOT_RETURN_NULL
 SymReg * link_keys(
     ARGMOD(imc_info_t * imcc),
@@ -454,14 +477,13 @@ char * symreg_to_str(ARGIN(const SymReg *s))
     , PARROT_ASSERT_ARG(arg))
 #define ASSERT_ARGS_clear_globals __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc))
-#define ASSERT_ARGS_clear_locals __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_clear_sym_hash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(hsh))
 #define ASSERT_ARGS_create_symhash __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(hash))
 #define ASSERT_ARGS_dup_sym __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
-       PARROT_ASSERT_ARG(imcc) \
+       PARROT_ASSERT_ARG(hsh) \
     , PARROT_ASSERT_ARG(r))
 #define ASSERT_ARGS_find_sym __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
@@ -475,6 +497,13 @@ char * symreg_to_str(ARGIN(const SymReg *s))
     , PARROT_ASSERT_ARG(name))
 #define ASSERT_ARGS_hash_str __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(str))
+#define ASSERT_ARGS_imcc_arena_alloc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arena))
+#define ASSERT_ARGS_imcc_arena_destroy __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arena))
+#define ASSERT_ARGS_imcc_arena_strdup __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(arena) \
+    , PARROT_ASSERT_ARG(str))
 #define ASSERT_ARGS_link_keys __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(imcc) \
     , PARROT_ASSERT_ARG(keys))
@@ -25,17 +25,19 @@ struct imcc_ostat {
     int deleted_labels;
     int if_branch;
     int branch_branch;
-    int branch_cond_loop;
     int invariants_moved;
     int deleted_ins;
     int used_once;
+    int copies_propagated;
+    int values_numbered;
+    int ops_unboxed;
 } ;
 
 struct IMC_Unit {
     INTVAL            type;
     Instruction      *instructions;
     Instruction      *last_ins;
-    SymHash           hash;
+    SymHash           hash;             /* its arena holds the instructions too */
     int               bb_list_size;
     unsigned int      n_basic_blocks;
     Basic_block     **bb_list;
@@ -54,7 +56,6 @@ struct IMC_Unit {
     IMC_Unit         *next;
 
     SymReg           *_namespace;
-    int               owns_namespace;   /* should this unit free *_namespace */
     int               pasm_file;
     STRING           *file;
     int               n_vars_used[4];   /* INSP in PIR */
@@ -164,6 +164,11 @@ tree as a PIR code object that can be compiled.
     explabel = 'R'
     exp.'pir'(expcode, explabel, 'succeed')
 
+    ##   find out what a match has to start with, so that
+    ##   unanchored matches can skip to where one could begin.
+    .local pmc prescan
+    prescan = exp.'prescan'()
+
     if cutrule goto code_cutrule
     ##   Generate the initial PIR code for a backtracking (uncut) rule.
     .local string returnop
@@ -235,10 +240,17 @@ tree as a PIR code object that can be compiled.
     code.'append_format'("          captscope = mob\n")
   code_body_3:
 
-    code.'append_format'(<<"        CODE", PGE_CUT_RULE, returnop)
+    code.'append_format'(<<"        CODE")
           .local int pos, rep, cutmark
         try_match:
           if cpos > lastpos goto fail_rule
+        CODE
+    if null prescan goto code_body_4
+    code.'append_format'("          unless iscont goto try_prescanned\n")
+    self.'pir_scan'(code, prescan)
+    code.'append_format'("        try_prescanned:\n")
+  code_body_4:
+    code.'append_format'(<<"        CODE", PGE_CUT_RULE, returnop)
           mfrom = cpos
           pos = cpos
           cutmark = 0
@@ -365,6 +377,209 @@ tree as a PIR code object that can be compiled.
 .end
 
 
+=item C<prescan()>
+
+Return a Hash describing the text that any match of C<self> must
+start with, or null if C<self> can start with anything or doesn't
+begin by consuming a character.  The Hash has one of the keys
+
+    literal     the match starts with this string
+    charlist    the match starts with one of these characters
+    cclass      the match starts with a character of this class,
+                or outside of it if C<negate> is true
+
+Nodes that don't override this method return null.
+
+=cut
+
+.sub 'prescan' :method
+    null $P0
+    .return ($P0)
+.end
+
+
+=item C<pir_scan(PMC code, PMC prescan)>
+
+Add code to C<code> that advances C<cpos> to the next position
+where the text could start as C<prescan> says, going to
+C<fail_rule> if there isn't one.
+
+=cut
+
+.sub 'pir_scan' :method
+    .param pmc code
+    .param pmc prescan
+
+    .local string literal
+    $I0 = exists prescan['cclass']
+    if $I0 goto scan_cclass
+    $I0 = exists prescan['literal']
+    if $I0 goto scan_literal
+    literal = prescan['charlist']
+    $I0 = length literal
+    if $I0 == 1 goto scan_index
+    $P0 = get_root_global ['parrot';'PGE';'Util'], 'pir_str_escape'
+    $S0 = $P0(literal)
+    code.'append_format'(<<"        CODE", $S0)
+        try_prescan:
+          if cpos >= lastpos goto fail_rule
+          $S0 = substr target, cpos, 1
+          $I0 = index %0, $S0
+          if $I0 >= 0 goto try_prescanned
+          inc cpos
+          goto try_prescan
+        CODE
+    .return ()
+
+  scan_literal:
+    literal = prescan['literal']
+  scan_index:
+    $P0 = get_root_global ['parrot';'PGE';'Util'], 'pir_str_escape'
+    $S0 = $P0(literal)
+    code.'append_format'(<<"        CODE", $S0)
+          cpos = index target, %0, cpos
+          if cpos < 0 goto fail_rule
+        CODE
+    .return ()
+
+  scan_cclass:
+    .local string negstr
+    negstr = ''
+    $I0 = prescan['negate']
+    if $I0 == 0 goto scan_cclass_1
+    negstr = '_not'
+  scan_cclass_1:
+    $I0 = prescan['cclass']
+    code.'append_format'(<<"        CODE", negstr, $I0)
+          cpos = find%0_cclass %1, target, cpos, lastpos
+          if cpos >= lastpos goto fail_rule
+        CODE
+    .return ()
+.end
+
+
+=item C<pir_guard(PMC code, PMC prescan, string failure)>
+
+Add code to C<code> that goes to C<failure> unless the text at
+C<pos> starts as C<prescan> says.
+
+=cut
+
+.sub 'pir_guard' :method
+    .param pmc code
+    .param pmc prescan
+    .param string failure
+
+    .local pmc escape
+    escape = get_root_global ['parrot';'PGE';'Util'], 'pir_str_escape'
+
+    $I0 = exists prescan['cclass']
+    if $I0 goto guard_cclass
+    $I0 = exists prescan['literal']
+    if $I0 goto guard_literal
+    $S0 = prescan['charlist']
+    $S0 = escape($S0)
+    code.'append_format'(<<"        CODE", failure, $S0)
+          if pos >= lastpos goto %0
+          $S0 = substr target, pos, 1
+          $I0 = index %1, $S0
+          if $I0 < 0 goto %0
+        CODE
+    .return ()
+
+  guard_literal:
+    $S0 = prescan['literal']
+    $I0 = length $S0
+    $S0 = escape($S0)
+    code.'append_format'(<<"        CODE", failure, $S0, $I0)
+          $I0 = pos + %2
+          if $I0 > lastpos goto %0
+          $S0 = substr target, pos, %2
+          if $S0 != %1 goto %0
+        CODE
+    .return ()
+
+  guard_cclass:
+    $I0 = prescan['cclass']
+    $I1 = prescan['negate']
+    code.'append_format'(<<"        CODE", failure, $I0, $I1)
+          if pos >= lastpos goto %0
+          $I0 = is_cclass %1, target, pos
+          if $I0 == %2 goto %0
+        CODE
+    .return ()
+.end
+
+
+=item C<pir_quant_rep(PMC code, PMC args)>
+
+Add the code for a quantifier over a node that matches a single
+character, once C<rep> holds how many characters from C<pos> on
+the node could match.  C<args> are the quantifier's C<getargs>.
+Returns 1, so that C<pir_quant> methods can return its result.
+
+=cut
+
+.sub 'pir_quant_rep' :method
+    .param pmc code
+    .param pmc args
+
+    .local pmc quant
+    .local int backtrack
+    quant = args['quant']
+    backtrack = quant['backtrack']
+
+    code.'append_format'(<<"        CODE", args :flat :named)
+          %Mif rep < %m goto fail
+          %Nif rep <= %n goto %L_1
+          %Nrep = %n
+        %L_1:
+        CODE
+
+    if backtrack == PGE_BACKTRACK_NONE goto bt_none
+    if backtrack == PGE_BACKTRACK_EAGER goto bt_eager
+
+  bt_greedy:
+    code.'append_format'(<<"        CODE", args :flat :named)
+          pos += rep
+        %L_2:
+          if rep <= %m goto %S
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, %S
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          dec pos
+          dec rep
+          goto %L_2
+        CODE
+    .return (1)
+
+  bt_none:
+    code.'append_format'("          pos += rep\n          goto %S\n", args :flat :named)
+    .return (1)
+
+  bt_eager:
+    code.'append_format'(<<"        CODE", args :flat :named)
+          %Mpos += %m
+          %Mrep -= %m
+        %L_2:
+          if rep == 0 goto %S
+          push ustack, pos
+          push ustack, rep
+          local_branch cstack, %S
+          rep = pop ustack
+          pos = pop ustack
+          if cutmark != 0 goto fail
+          inc pos
+          dec rep
+          goto %L_2
+        CODE
+    .return (1)
+.end
+
+
 .namespace [ 'PGE';'Exp';'Literal' ]
 
 .sub 'reduce' :method
@@ -372,6 +587,19 @@ tree as a PIR code object that can be compiled.
     .return (self)
 .end
 
+.sub 'prescan' :method
+    .local pmc prescan
+    null prescan
+    $I0 = self['ignorecase']
+    if $I0 goto end
+    $S0 = self.'ast'()
+    if $S0 == '' goto end
+    prescan = new 'Hash'
+    prescan['literal'] = $S0
+  end:
+    .return (prescan)
+.end
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -464,6 +692,12 @@ tree as a PIR code object that can be compiled.
 .end
 
 
+.sub 'prescan' :method
+    $P0 = self[0]
+    .tailcall $P0.'prescan'()
+.end
+
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -526,6 +760,16 @@ tree as a PIR code object that can be compiled.
     .return (self)
 .end
 
+.sub 'prescan' :method
+    $I0 = self['min']
+    if $I0 < 1 goto anything
+    $P0 = self[0]
+    .tailcall $P0.'prescan'()
+  anything:
+    null $P0
+    .return ($P0)
+.end
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -719,6 +963,11 @@ tree as a PIR code object that can be compiled.
     .return (self)
 .end
 
+.sub 'prescan' :method
+    $P0 = self[0]
+    .tailcall $P0.'prescan'()
+.end
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -987,6 +1236,81 @@ tree as a PIR code object that can be compiled.
 .end
 
 
+.sub 'prescan' :method
+    .local pmc prescan, prescan0, prescan1
+    null prescan
+    $P0 = self[0]
+    prescan0 = $P0.'prescan'()
+    if null prescan0 goto end
+    $P0 = self[1]
+    prescan1 = $P0.'prescan'()
+    if null prescan1 goto end
+
+    ##   character classes only combine with the same class
+    $I0 = exists prescan0['cclass']
+    $I1 = exists prescan1['cclass']
+    if $I0 goto cclass
+    if $I1 goto end
+
+    .local string lit0, lit1
+    .local int islit0, islit1
+    islit0 = exists prescan0['literal']
+    islit1 = exists prescan1['literal']
+    if islit0 == 0 goto charlist
+    if islit1 == 0 goto charlist
+    ##   two literals: keep whatever prefix they have in common
+    lit0 = prescan0['literal']
+    lit1 = prescan1['literal']
+    $I0 = 0
+  literal_loop:
+    $S0 = substr lit0, $I0, 1
+    $S1 = substr lit1, $I0, 1
+    if $S0 != $S1 goto literal_end
+    if $S0 == '' goto literal_end
+    inc $I0
+    goto literal_loop
+  literal_end:
+    if $I0 == 0 goto charlist
+    prescan = new 'Hash'
+    $S0 = substr lit0, 0, $I0
+    prescan['literal'] = $S0
+    .return (prescan)
+
+  charlist:
+    ##   otherwise keep the characters either one can start with
+    if islit0 goto charlist_0
+    lit0 = prescan0['charlist']
+    goto charlist_1
+  charlist_0:
+    lit0 = prescan0['literal']
+    lit0 = substr lit0, 0, 1
+  charlist_1:
+    if islit1 goto charlist_2
+    lit1 = prescan1['charlist']
+    goto charlist_3
+  charlist_2:
+    lit1 = prescan1['literal']
+    lit1 = substr lit1, 0, 1
+  charlist_3:
+    prescan = new 'Hash'
+    $S0 = concat lit0, lit1
+    prescan['charlist'] = $S0
+    .return (prescan)
+
+  cclass:
+    if $I1 == 0 goto end
+    $I0 = prescan0['cclass']
+    $I1 = prescan1['cclass']
+    if $I0 != $I1 goto end
+    $I0 = prescan0['negate']
+    $I1 = prescan1['negate']
+    if $I0 != $I1 goto end
+    prescan = prescan0
+  end:
+    .return (prescan)
+.end
+
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -996,15 +1320,20 @@ tree as a PIR code object that can be compiled.
     $P0 = get_root_global ['parrot';'PGE';'Util'], 'unique'
     exp0label = $P0('R')
     exp1label = $P0('R')
+    exp0 = self[0]
+    code.'append_format'("        %0:  # alt %1, %2\n", label, exp0label, exp1label)
+    ##   don't try the first alternative where it can't match
+    $P0 = exp0.'prescan'()
+    if null $P0 goto alt_branch
+    self.'pir_guard'(code, $P0, exp1label)
+  alt_branch:
     code.'append_format'(<<"        CODE", label, exp0label, exp1label)
-        %0:  # alt %1, %2
           push ustack, pos
           local_branch cstack, %1
           pos = pop ustack
           if cutmark != 0 goto fail
           goto %2\n
         CODE
-    exp0 = self[0]
     exp0.'pir'(code, exp0label, next)
     exp1 = self[1]
     exp1.'pir'(code, exp1label, next)
@@ -1171,6 +1500,20 @@ tree as a PIR code object that can be compiled.
 .end
 
 
+.sub 'prescan' :method
+    .local pmc prescan
+    null prescan
+    $I0 = self['cclass']
+    if $I0 == .CCLASS_ANY goto end
+    prescan = new 'Hash'
+    prescan['cclass'] = $I0
+    $I0 = self['negate']
+    prescan['negate'] = $I0
+  end:
+    .return (prescan)
+.end
+
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -1199,11 +1542,7 @@ tree as a PIR code object that can be compiled.
     .param pmc quant
 
     .local pmc args
-    .local int min, max, backtrack
     args = self.'getargs'(label, next, 'quant'=>quant)
-    min = quant['min']
-    max = quant['max']
-    backtrack = quant['backtrack']
 
     ##  output initial label
     code.'append_format'("        %L: # cclass %0 %Q\n", self, args :flat :named)
@@ -1226,55 +1565,7 @@ tree as a PIR code object that can be compiled.
     code.'append_format'("          rep = lastpos - pos\n")
 
   emit_pir:
-    code.'append_format'(<<"        CODE", args :flat :named)
-          %Mif rep < %m goto fail
-          %Nif rep <= %n goto %L_1
-          %Nrep = %n
-        %L_1:
-        CODE
-
-    if backtrack == PGE_BACKTRACK_NONE goto bt_none
-    if backtrack == PGE_BACKTRACK_EAGER goto bt_eager
-
-  bt_greedy:
-    code.'append_format'(<<"        CODE", args :flat :named)
-          pos += rep
-        %L_2:
-          if rep <= %m goto %S
-          push ustack, pos
-          push ustack, rep
-          local_branch cstack, %S
-          rep = pop ustack
-          pos = pop ustack
-          if cutmark != 0 goto fail
-          dec pos
-          dec rep
-          goto %L_2
-        CODE
-    .return (1)
-
-  bt_none:
-    code.'append_format'("          pos += rep\n          goto %0\n", next)
-    .return (1)
-
-  bt_eager:
-    code.'append_format'(<<"        CODE", args :flat :named)
-          %Mpos += %m
-          %Mrep -= %m
-        %L_2:
-          if rep == 0 goto %S
-          push ustack, pos
-          push ustack, rep
-          local_branch cstack, %S
-          rep = pop ustack
-          pos = pop ustack
-          if cutmark != 0 goto fail
-          inc pos
-          dec rep
-          goto %L_2
-        CODE
-    .return (1)
-
+    .tailcall self.'pir_quant_rep'(code, args)
 .end
 
 .namespace [ 'PGE';'Exp';'Cut' ]
@@ -1370,6 +1661,18 @@ tree as a PIR code object that can be compiled.
     .return (self)
 .end
 
+.sub 'prescan' :method
+    .local pmc prescan
+    null prescan
+    $I0 = self['isnegated']
+    if $I0 goto end
+    prescan = new 'Hash'
+    $S0 = self.'ast'()
+    prescan['charlist'] = $S0
+  end:
+    .return (prescan)
+.end
+
 .sub 'pir' :method
     .param pmc code
     .param string label
@@ -1407,6 +1710,50 @@ tree as a PIR code object that can be compiled.
     .return ()
 .end
 
+.sub 'pir_quant' :method
+    .param pmc code
+    .param string label
+    .param string next
+    .param pmc quant
+
+    ##   zero-width lists repeat the generic way
+    $I0 = self['iszerowidth']
+    if $I0 == 0 goto scan
+    .return (0)
+
+  scan:
+    .local pmc args
+    args = self.'getargs'(label, next, 'quant'=>quant)
+
+    $P0 = get_root_global ['parrot';'PGE';'Util'], 'pir_str_escape'
+    $S0 = self.'ast'()
+    $S0 = $P0($S0)
+    $S1 = '<'
+    $I0 = self['isnegated']
+    if $I0 == 0 goto scan_1
+    $S1 = '>='
+  scan_1:
+    ##   count the characters in the list, but no more than %n
+    code.'append_format'(<<"        CODE", $S0, $S1, args :flat :named)
+        %L: # enumcharlist %0 %Q
+          $I1 = pos
+          $I2 = lastpos
+          %N$I2 = pos + %n
+          %Nif $I2 <= lastpos goto %L_scan
+          %N$I2 = lastpos
+        %L_scan:
+          if $I1 >= $I2 goto %L_scanned
+          $S0 = substr target, $I1, 1
+          $I0 = index %0, $S0
+          if $I0 %1 0 goto %L_scanned
+          inc $I1
+          goto %L_scan
+        %L_scanned:
+          rep = $I1 - pos
+        CODE
+    .tailcall self.'pir_quant_rep'(code, args)
+.end
+
 
 .namespace [ 'PGE';'Exp';'Newline' ]
 
@@ -1415,6 +1762,13 @@ tree as a PIR code object that can be compiled.
     .return (self)
 .end
 
+.sub 'prescan' :method
+    $P0 = new 'Hash'
+    $P0['cclass'] = .CCLASS_NEWLINE
+    $P0['negate'] = 0
+    .return ($P0)
+.end
+
 .sub 'pir' :method
     .param pmc code
     .param string label
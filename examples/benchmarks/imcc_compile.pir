@@ -0,0 +1,109 @@
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/imcc_compile.pir - PIR compiler throughput
+
+=head1 SYNOPSIS
+
+    % ./parrot examples/benchmarks/imcc_compile.pir [n [file.pir ...]]
+
+=head1 DESCRIPTION
+
+Compiles each of the given PIR files C<n> times (3 if unspecified) and
+reports how many lines per second IMCC got through. Without any files it
+compiles the largest generated PIR in the tree: the nqp-rx stage0 compiler and
+the winxed compiler. Unset C<PARROT_BYTECODE_CACHE> first, or this measures
+the cache instead.
+
+=cut
+
+.sub main :main
+    .param pmc argv
+
+    .local int argc, n
+    argc = argv
+    n    = 3
+    if argc <= 1 goto default_n
+    n = argv[1]
+  default_n:
+
+    .local pmc files
+    files = new 'ResizableStringArray'
+    if argc > 2 goto given
+    push files, 'ext/nqp-rx/src/stage0/HLL-s0.pir'
+    push files, 'ext/nqp-rx/src/stage0/P6Regex-s0.pir'
+    push files, 'ext/nqp-rx/src/stage0/NQP-s0.pir'
+    push files, 'ext/winxed/compiler.pir'
+    goto counted
+  given:
+    $I0 = 2
+  next_arg:
+    if $I0 >= argc goto counted
+    $S0 = argv[$I0]
+    push files, $S0
+    inc $I0
+    goto next_arg
+
+  counted:
+    .local int lines, nfiles, i, j
+    .local num start, elapsed
+    .local pmc pir
+    pir    = compreg 'PIR'
+    nfiles = files
+    lines  = 0
+    i      = 0
+  count_loop:
+    if i >= nfiles goto timed
+    $S0 = files[i]
+    $I0 = count_lines($S0)
+    lines += $I0
+    inc i
+    goto count_loop
+
+  timed:
+    start = time
+    j     = 0
+  pass_loop:
+    if j >= n goto done
+    i = 0
+  file_loop:
+    if i >= nfiles goto next_pass
+    $S0 = files[i]
+    pir.'compile_file'($S0)
+    inc i
+    goto file_loop
+  next_pass:
+    inc j
+    goto pass_loop
+
+  done:
+    elapsed = time
+    elapsed -= start
+    lines *= n
+
+    $P0    = new 'FixedPMCArray'
+    $P0    = 3
+    $P0[0] = lines
+    $P0[1] = elapsed
+    $N0    = lines
+    $N0   /= elapsed
+    $P0[2] = $N0
+    $S0    = sprintf "Compiled %d lines in %.3fs (%.0f lines/s)\n", $P0
+    print $S0
+.end
+
+.sub count_lines
+    .param string file
+    $P0 = new 'FileHandle'
+    $S0 = $P0.'readall'(file)
+    $P1 = split "\n", $S0
+    $I0 = $P1
+    .return ($I0)
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,117 @@
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/json.pir - JSON decoding and encoding
+
+=head1 SYNOPSIS
+
+    % ./parrot examples/benchmarks/json.pir [records]
+
+=head1 DESCRIPTION
+
+Builds a JSON document of C<records> objects (200 if unspecified), then times
+decoding it with the PGE grammar of data_json, which returns PIR that has to
+be compiled and run, against the C<JSONCodec> PMC, and encoding the result
+with C<_json> from F<JSON.pir> against C<JSONCodec>.
+
+=cut
+
+.sub main :main
+    .param pmc argv
+
+    .local int records
+    records = 200
+    $I0 = argv
+    if $I0 <= 1 goto default_records
+    records = argv[1]
+  default_records:
+
+    load_language 'data_json'
+    load_bytecode 'JSON.pbc'
+
+    .local pmc json, codec, pirc, data
+    .local string text
+    json  = compreg 'data_json'
+    pirc  = compreg 'PIR'
+    $P0   = loadlib 'jsoncodec'
+    codec = new ['JSONCodec']
+    text  = make_document(records)
+
+    .local num start, grammar, native
+    start   = time
+    $P0     = json.'compile'(text, 'target' => 'pir')
+    $P0     = pirc($P0)
+    $P0     = $P0.'first_sub_in_const_table'()
+    data    = $P0()
+    grammar = time
+    grammar -= start
+
+    start  = time
+    data   = codec.'decode'(text)
+    native = time
+    native -= start
+    report('decode', grammar, native)
+
+    start   = time
+    $S0     = _json(data)
+    grammar = time
+    grammar -= start
+
+    start  = time
+    $S1    = codec.'encode'(data)
+    native = time
+    native -= start
+    report('encode', grammar, native)
+.end
+
+.sub make_document
+    .param int records
+    .local pmc sb
+    .local int i
+    sb = new 'StringBuilder'
+    push sb, '['
+    i = 0
+  loop:
+    if i >= records goto finish
+    if i == 0 goto first
+    push sb, ','
+  first:
+    $P0    = new 'FixedPMCArray'
+    $P0    = 3
+    $P0[0] = i
+    $P0[1] = i
+    $N0    = i
+    $N0   *= 0.25
+    $P0[2] = $N0
+    $S0 = sprintf '{"id":%d,"name":"record \"%d\"","score":%.2f,"tags":["a","b\u00e4"],"ok":true,"next":null}', $P0
+    push sb, $S0
+    inc i
+    goto loop
+  finish:
+    push sb, ']'
+    $S0 = sb
+    .return ($S0)
+.end
+
+.sub report
+    .param string what
+    .param num grammar
+    .param num native
+    $P0    = new 'FixedPMCArray'
+    $P0    = 4
+    $P0[0] = what
+    $P0[1] = grammar
+    $P0[2] = native
+    $N0    = grammar
+    $N0   /= native
+    $P0[3] = $N0
+    $S0    = sprintf "%s: PIR %.4fs, JSONCodec %.4fs (%.1fx)\n", $P0
+    print $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
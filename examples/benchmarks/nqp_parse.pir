@@ -0,0 +1,98 @@
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/nqp_parse.pir - parse NQP source with the nqp-rx grammar
+
+=head1 SYNOPSIS
+
+    % ./parrot examples/benchmarks/nqp_parse.pir [rounds] [file ...]
+
+=head1 DESCRIPTION
+
+Parses each of the given NQP files (the nqp-rx tests if none are given)
+C<rounds> times (5 if unspecified) and reports how long that took.  Most
+of the time goes to the protoregexes of the grammar: terms, operators,
+statement controls and so on.
+
+=cut
+
+.sub main :main
+    .param pmc argv
+
+    .local int rounds
+    .local pmc files
+    rounds = 5
+    $S0 = shift argv
+    unless argv goto default_rounds
+    rounds = shift argv
+  default_rounds:
+    files = argv
+    if files goto have_files
+    $P0 = new ['OS']
+    files = $P0.'readdir'('ext/nqp-rx/t/nqp')
+    $I0 = elements files
+  prefix_loop:
+    dec $I0
+    if $I0 < 0 goto have_files
+    $S0 = files[$I0]
+    $S0 = concat 'ext/nqp-rx/t/nqp/', $S0
+    files[$I0] = $S0
+    goto prefix_loop
+  have_files:
+
+    load_bytecode 'nqp-rx.pbc'
+
+    .local pmc nqp, sources, it
+    .local int parsed
+    nqp     = compreg 'NQP-rx'
+    sources = new ['ResizableStringArray']
+    it      = iter files
+  read_loop:
+    unless it goto read_done
+    $S0 = shift it
+    $I0 = index $S0, '.t'
+    if $I0 < 0 goto read_loop
+    $P0 = new ['FileHandle']
+    $S1 = $P0.'readall'($S0)
+    ##  keep the files that parse
+    push_eh read_skip
+    nqp.'compile'($S1, 'target'=>'parse')
+    pop_eh
+    push sources, $S1
+    goto read_loop
+  read_skip:
+    pop_eh
+    goto read_loop
+  read_done:
+
+    .local num start
+    parsed = 0
+    start  = time
+  round_loop:
+    unless rounds goto round_done
+    dec rounds
+    it = iter sources
+  parse_loop:
+    unless it goto round_loop
+    $S0 = shift it
+    nqp.'compile'($S0, 'target'=>'parse')
+    inc parsed
+    goto parse_loop
+  round_done:
+    $N0 = time
+    $N0 -= start
+
+    $P0    = new 'FixedPMCArray'
+    $P0    = 2
+    $P0[0] = parsed
+    $P0[1] = $N0
+    $S0    = sprintf "parsed %d files in %.4fs\n", $P0
+    print $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
@@ -0,0 +1,106 @@
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+examples/benchmarks/pge_scan.pir - unanchored PGE matches over a log
+
+=head1 SYNOPSIS
+
+    % ./parrot examples/benchmarks/pge_scan.pir [lines]
+
+=head1 DESCRIPTION
+
+Builds a log of C<lines> lines (2000 if unspecified) and times how long
+a few Perl 6 regexes take to find all of their matches in it: a literal,
+an alternation of literals, a character class run, and a pattern that
+starts with a character class.
+
+=cut
+
+.sub main :main
+    .param pmc argv
+
+    .local int lines
+    lines = 2000
+    $I0 = argv
+    if $I0 <= 1 goto default_lines
+    lines = argv[1]
+  default_lines:
+
+    load_bytecode 'PGE.pbc'
+
+    .local string text
+    text = make_log(lines)
+
+    time_regex(text, 'ERROR')
+    time_regex(text, 'WARN|ERROR')
+    time_regex(text, '<[0..9]>+ \s ms')
+    time_regex(text, '\d\d\:\d\d')
+.end
+
+.sub make_log
+    .param int lines
+    .local pmc sb
+    .local int i
+    sb = new 'StringBuilder'
+    i = 0
+  loop:
+    if i >= lines goto finish
+    $P0    = new 'FixedPMCArray'
+    $P0    = 3
+    $I0    = i % 24
+    $P0[0] = $I0
+    $I0    = i % 60
+    $P0[1] = $I0
+    $I0    = i * 7
+    $I0   %= 1000
+    $P0[2] = $I0
+    $S0 = sprintf "%02d:%02d request served by the upstream worker pool in %d ms\n", $P0
+    push sb, $S0
+    $I0 = i % 50
+    if $I0 != 0 goto next
+    push sb, "ERROR upstream worker pool timed out\n"
+  next:
+    inc i
+    goto loop
+  finish:
+    $S0 = sb
+    .return ($S0)
+.end
+
+.sub time_regex
+    .param string text
+    .param string source
+
+    .local pmc regex, match
+    .local int count
+    .local num start
+    $P0   = compreg 'PGE::Perl6Regex'
+    regex = $P0(source)
+    count = 0
+    start = time
+    match = regex(text)
+  loop:
+    unless match goto done
+    inc count
+    $I0   = match.'to'()
+    match = regex(text, 'c'=>$I0)
+    goto loop
+  done:
+    $N0 = time
+    $N0 -= start
+
+    $P0    = new 'FixedPMCArray'
+    $P0    = 3
+    $P0[0] = source
+    $P0[1] = count
+    $P0[2] = $N0
+    $S0    = sprintf "%-16s %6d matches in %.4fs\n", $P0
+    print $S0
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
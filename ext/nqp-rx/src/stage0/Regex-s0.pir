@@ -1230,6 +1230,10 @@ Regex::Cursor-protoregex-peek - simple protoregex implementation
 
 Perform a match for protoregex C<name>.
 
+The token trie used here (see C<!protoregex_gen_trie>) is a local
+change to this generated file, not part of nqp-rx; re-apply it when
+stage0 is regenerated (see F<ext/nqp-rx/README>).
+
 =cut
 
 .sub '!protoregex' :method
@@ -1242,8 +1246,8 @@ Perform a match for protoregex C<name>.
     null debug
   have_debug:
 
-    .local pmc tokrx, toklen
-    (tokrx, toklen) = self.'!protoregex_tokrx'(name)
+    .local pmc tokrx, trie
+    (tokrx, trie) = self.'!protoregex_tokrx'(name)
   have_tokrx:
 
     if null debug goto debug_skip_1
@@ -1254,66 +1258,51 @@ Perform a match for protoregex C<name>.
     unless tokrx goto fail
 
     # Figure out where we are in the current match.
-    .local pmc target
+    .local string target
     .local int pos
-    target = getattribute self, '$!target'
+    $P0 = getattribute self, '$!target'
+    target = $P0
     $P1 = getattribute self, '$!pos'
     pos = $P1
 
-    # Use the character at the current match position to determine
-    # the longest possible token we could encounter at this point.
-    .local string token1, token
-    token1 = substr target, pos, 1
-    $I0 = toklen[token1]
-    token = substr target, pos, $I0
+    # Follow the characters at the current match position down the
+    # token trie as far as they go.  The deepest node with a list of
+    # candidates belongs to the longest token we could encounter here,
+    # and its list holds the candidates for all of the shorter tokens
+    # as well, in the order to try them.
+    .local pmc node, rxlist
+    .local int tpos
+    node = trie
+    rxlist = node['']
+    tpos = pos
+  trie_loop:
+    $S0 = substr target, tpos, 1
+    if $S0 == '' goto trie_done
+    node = node[$S0]
+    if null node goto trie_done
+    inc tpos
+    $P0 = node['']
+    if null $P0 goto trie_loop
+    rxlist = $P0
+    goto trie_loop
+  trie_done:
 
     if null debug goto debug_skip_2
-    $S0 = escape token
-    $S1 = escape token1
-    self.'!cursor_debug'('NOTE', 'token1="', $S1, '", token="', $S0, '"')
+    $I0 = tpos - pos
+    $S0 = substr target, pos, $I0
+    $S0 = escape $S0
+    self.'!cursor_debug'('NOTE', 'token="', $S0, '"')
   debug_skip_2:
 
-    # Create a hash to keep track of the methods we've already called,
-    # so that we don't end up calling it twice.
-    .local pmc mcalled
-    mcalled = new ['Hash']
-
-    # Look in the tokrx hash for any rules that are keyed with the
-    # current token.  If there aren't any, or the rules we have don't
-    # match, then shorten the token by one character and try again
-    # until we either have a match or we've run out of candidates.
-  token_loop:
-    .local pmc rx, result
-    rx = tokrx[token]
-    if null rx goto token_next
-    $I0 = isa rx, ['ResizablePMCArray']
-    if $I0 goto rx_array
-    .local int rxaddr
-    rxaddr = get_addr rx
-    $P0 = mcalled[rxaddr]
-    unless null $P0 goto token_next
-    result = self.rx()
-    mcalled[rxaddr] = mcalled
-    if result goto done
-    goto token_next
-  rx_array:
-    .local pmc rx_it
-    rx_it = iter rx
+    if null rxlist goto fail
+    .local pmc rx, rx_it, result
+    rx_it = iter rxlist
   cand_loop:
-    unless rx_it goto cand_done
+    unless rx_it goto fail
     rx = shift rx_it
-    rxaddr = get_addr rx
-    $P0 = mcalled[rxaddr]
-    unless null $P0 goto cand_loop
     result = self.rx()
-    mcalled[rxaddr] = mcalled
     if result goto done
     goto cand_loop
-  cand_done:
-  token_next:
-    unless token > '' goto fail
-    token = chopn token, 1
-    goto token_loop
 
   done:
     pos = result.'pos'()
@@ -1384,17 +1373,15 @@ create a new one and return it.
     # from the protoregex table.  If they already exist, we're
     # done, otherwise we create new ones below.
     # yet for this table, then do that now.
-    .local pmc tokrx, toklen
+    .local pmc tokrx, trie
     $S0 = concat name, '.tokrx'
     tokrx = prototable[$S0]
-    $S0 = concat name, '.toklen'
-    toklen = prototable[$S0]
+    $S0 = concat name, '.trie'
+    trie = prototable[$S0]
     unless null tokrx goto tokrx_done
 
     self.'!cursor_debug'('NOTE','Generating protoregex table for ', name)
 
-    .local pmc toklen, tokrx
-    toklen = new ['Hash']
     tokrx  = new ['Hash']
 
     # The prototable has already collected all of the names of
@@ -1444,8 +1431,7 @@ create a new one and return it.
     push tokens, ''
   method_peek_done:
 
-    # Now loop through all of the tokens for the method, updating
-    # the longest length per initial token character and adding
+    # Now loop through all of the tokens for the method, adding
     # the token to the tokrx hash.  Entries in the tokrx hash
     # are automatically promoted to arrays when there's more
     # than one candidate, and any arrays created are placed into
@@ -1454,7 +1440,7 @@ create a new one and return it.
     seentok = new ['Hash']
   tokens_loop:
     unless tokens goto tokens_done
-    .local string tkey, tfirst
+    .local string tkey
     $P0 = shift tokens
     $I0 = isa $P0, ['ResizablePMCArray']
     unless $I0 goto token_item
@@ -1469,14 +1455,6 @@ create a new one and return it.
     if $I0 goto tokens_loop
     seentok[tkey] = seentok
 
-    # Keep track of longest token lengths by initial character
-    tfirst = substr tkey, 0, 1
-    $I0 = length tkey
-    $I1 = toklen[tfirst]
-    if $I0 <= $I1 goto toklen_done
-    toklen[tfirst] = $I0
-  toklen_done:
-
     # Add the regex to the list under the token key, promoting
     # entries to lists as appropriate.
     .local pmc rxlist
@@ -1513,15 +1491,17 @@ create a new one and return it.
     goto sorttok_loop
   sorttok_done:
 
-    # It's built!  Now store the tokrx and toklen hashes in the
+    trie = self.'!protoregex_gen_trie'(tokrx)
+
+    # It's built!  Now store the tokrx hash and the trie in the
     # prototable and return them to the caller.
     $S0 = concat name, '.tokrx'
     prototable[$S0] = tokrx
-    $S0 = concat name, '.toklen'
-    prototable[$S0] = toklen
+    $S0 = concat name, '.trie'
+    prototable[$S0] = trie
 
   tokrx_done:
-    .return (tokrx, toklen)
+    .return (tokrx, trie)
 .end
 
 .sub '!protoregex_cmp' :anon
@@ -1535,6 +1515,104 @@ create a new one and return it.
     .return ($I2)
 .end
 
+=item !protoregex_gen_trie(tokrx)
+
+Generate the token trie that C<!protoregex> dispatches with from
+the C<tokrx> hash of a protoregex.  Each node of the trie is a hash
+keyed by the next character of the tokens below it.  A node where
+a token ends has a list of regexes under the '' key:  the regexes
+for that token, followed by those for the shorter tokens leading
+up to it that aren't already in the list.  That's the order the
+candidates are tried in when the token is the longest one found at
+the current position.
+
+=cut
+
+.sub '!protoregex_gen_trie' :method
+    .param pmc tokrx
+
+    # Enter each token's regexes into the trie.
+    .local pmc trie, node, rxlist, tok_it
+    .local string tkey
+    .local int tpos, tlen
+    trie = new ['Hash']
+    tok_it = iter tokrx
+  tok_loop:
+    unless tok_it goto tok_done
+    tkey = shift tok_it
+    tlen = length tkey
+    node = trie
+    tpos = 0
+  node_loop:
+    if tpos >= tlen goto node_done
+    $S0 = substr tkey, tpos, 1
+    $P0 = node[$S0]
+    unless null $P0 goto node_next
+    $P0 = new ['Hash']
+    node[$S0] = $P0
+  node_next:
+    node = $P0
+    inc tpos
+    goto node_loop
+  node_done:
+    rxlist = new ['ResizablePMCArray']
+    $P0 = tokrx[tkey]
+    $I0 = isa $P0, ['ResizablePMCArray']
+    unless $I0 goto rxlist_1
+    splice rxlist, $P0, 0, 0
+    goto rxlist_done
+  rxlist_1:
+    push rxlist, $P0
+  rxlist_done:
+    node[''] = rxlist
+    goto tok_loop
+  tok_done:
+
+    # Now walk the trie from the top, appending the candidates of
+    # the nearest token above each node to the node's own list.
+    .local pmc todo, outer, node_it
+    todo = new ['ResizablePMCArray']
+    push todo, trie
+    $P0 = new ['ResizablePMCArray']
+    push todo, $P0
+  walk_loop:
+    unless todo goto walk_done
+    outer = pop todo
+    node = pop todo
+    rxlist = node['']
+    if null rxlist goto walk_children
+    $P0 = iter outer
+  outer_loop:
+    unless $P0 goto outer_done
+    $P1 = shift $P0
+    $P2 = iter rxlist
+  seen_loop:
+    unless $P2 goto seen_done
+    $P3 = shift $P2
+    $I0 = issame $P1, $P3
+    if $I0 goto outer_loop
+    goto seen_loop
+  seen_done:
+    push rxlist, $P1
+    goto outer_loop
+  outer_done:
+    outer = rxlist
+  walk_children:
+    node_it = iter node
+  child_loop:
+    unless node_it goto walk_loop
+    $S0 = shift node_it
+    if $S0 == '' goto child_loop
+    $P0 = node[$S0]
+    push todo, $P0
+    push todo, outer
+    goto child_loop
+  walk_done:
+
+    .return (trie)
+.end
+
+
 =item !protoregex_gen_table(parrotclass)
 
 Generate a new protoregex table for C<parrotclass>.  This involves
@@ -2,7 +2,7 @@
 
 # test protoregexes in grammars
 
-plan(6);
+plan(10);
 
 grammar ABC {
 
@@ -29,4 +29,25 @@ ok( ?$/ ,           'successfully matched grammar' );
 $/ := ABC.parse('xxx');
 ok( !$/ ,           'successfully failed protoregex match' );
 
+grammar Fallback {
 
+    token TOP { <kw> .* }
+
+    proto token kw { <...> }
+
+    token kw:sym<iffy>  { 'iffy' \d }
+    token kw:sym<if>    { <sym> }
+    token kw:sym<other> { \w+ }
+}
+
+$/ := Fallback.parse('iffy1');
+ok( $<kw> eq 'iffy1', 'longest token candidate tried first' );
+
+$/ := Fallback.parse('iffyx');
+ok( $<kw> eq 'if', 'shorter token candidate tried when the longest fails' );
+
+$/ := Fallback.parse('ifx');
+ok( $<kw> eq 'if', 'token found when the text goes on past it' );
+
+$/ := Fallback.parse('zzz');
+ok( $<kw> eq 'zzz', 'candidates without a token tried last' );
@@ -30,6 +30,8 @@ struct init_args_t {
     const char *run_core_name;
     Parrot_Int trace;
     Parrot_Int turn_gc_off;
+    const char *optimize;
+    Parrot_Int verbose;
     const char ** argv;
     int argc;
 };
@@ -87,7 +89,10 @@ static void print_parrot_string(
         FUNC_MODIFIES(*vector);
 
 PARROT_CANNOT_RETURN_NULL
-static void setup_imcc(Parrot_PMC interp);
+static void setup_imcc(
+    Parrot_PMC interp,
+    ARGIN(const struct init_args_t *flags))
+        __attribute__nonnull__(2);
 
 static void show_last_error_and_exit(Parrot_PMC interp);
 static void usage(ARGMOD(FILE *fp))
@@ -110,7 +115,8 @@ static void usage(ARGMOD(FILE *fp))
     , PARROT_ASSERT_ARG(argv))
 #define ASSERT_ARGS_print_parrot_string __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(vector))
-#define ASSERT_ARGS_setup_imcc __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_setup_imcc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(flags))
 #define ASSERT_ARGS_show_last_error_and_exit __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_usage __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(fp))
@@ -161,7 +167,7 @@ main(int argc, const char *argv[])
         show_last_error_and_exit(interp);
 
     Parrot_api_toggle_gc(interp, 0);
-    setup_imcc(interp);
+    setup_imcc(interp, &parsed_flags);
     if (!parsed_flags.turn_gc_off)
         Parrot_api_toggle_gc(interp, 1);
 
@@ -179,9 +185,11 @@ main(int argc, const char *argv[])
 
 /*
 
-=item C<static void setup_imcc(Parrot_PMC interp)>
+=item C<static void setup_imcc(Parrot_PMC interp, const struct init_args_t
+*flags)>
 
-Call into IMCC to either compile or preprocess the input.
+Call into IMCC to either compile or preprocess the input, passing on the
+optimization level and verbosity from the command line.
 
 =cut
 
@@ -189,7 +197,7 @@ Call into IMCC to either compile or preprocess the input.
 
 PARROT_CANNOT_RETURN_NULL
 static void
-setup_imcc(Parrot_PMC interp)
+setup_imcc(Parrot_PMC interp, ARGIN(const struct init_args_t *flags))
 {
     ASSERT_ARGS(setup_imcc)
     Parrot_PMC pir_compiler = NULL;
@@ -198,6 +206,16 @@ setup_imcc(Parrot_PMC interp)
     if (!(imcc_get_pir_compreg_api(interp, 1, &pir_compiler) &&
           imcc_get_pasm_compreg_api(interp, 1, &pasm_compiler)))
         show_last_error_and_exit(interp);
+
+    if (flags->optimize
+    && !(imcc_set_optimization_level_api(interp, pir_compiler, flags->optimize) &&
+         imcc_set_optimization_level_api(interp, pasm_compiler, flags->optimize)))
+        show_last_error_and_exit(interp);
+
+    if (flags->verbose
+    && !(imcc_set_verbosity_api(interp, pir_compiler, flags->verbose) &&
+         imcc_set_verbosity_api(interp, pasm_compiler, flags->verbose)))
+        show_last_error_and_exit(interp);
 }
 
 
@@ -346,7 +364,7 @@ usage(ARGMOD(FILE *fp))
 {
     ASSERT_ARGS(usage)
     fprintf(fp,
-            "parrot -[acEGhrtVwy.] [-D [FLAGS]]"
+            "parrot -[acEGhrtvVwy.] [-D [FLAGS]]"
             "[-R runcore] [-o FILE] <file>\n");
 }
 
@@ -410,6 +428,7 @@ Parrot_cmd_options(void)
         { '\0', OPT_HASH_SEED, OPTION_required_FLAG, { "--hash-seed" } },
         { 'I', 'I', OPTION_required_FLAG, { "--include" } },
         { 'L', 'L', OPTION_required_FLAG, { "--library" } },
+        { 'O', 'O', OPTION_optional_FLAG, { "--optimize" } },
         { 'R', 'R', OPTION_required_FLAG, { "--runcore" } },
         { 'g', 'g', OPTION_required_FLAG, { "--gc" } },
         { '\0', OPT_GC_NURSERY_SIZE, OPTION_required_FLAG, { "--gc-nursery-size" } },
@@ -430,6 +449,7 @@ Parrot_cmd_options(void)
         { 'r', 'r', (OPTION_flags)0, { "--run-pbc" } },
         { '\0', OPT_RUNTIME_PREFIX, (OPTION_flags)0, { "--runtime-prefix" } },
         { 't', 't', OPTION_optional_FLAG, { "--trace" } },
+        { 'v', 'v', (OPTION_flags)0, { "--verbose" } },
         { 'w', 'w', (OPTION_flags)0, { "--warnings" } },
         { 'y', 'y', (OPTION_flags)0, { "--yydebug" } },
         { 0, 0, (OPTION_flags)0, { NULL } }
@@ -570,6 +590,8 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
     args->run_core_name = "fast";
     args->trace = 0;
     args->turn_gc_off = 0;
+    args->optimize = NULL;
+    args->verbose = 0;
     pargs[nargs++] = argv[0];
 
     while ((status = longopt_get(argc, argv, Parrot_cmd_options(), &opt)) > 0) {
@@ -586,6 +608,12 @@ parseflags(Parrot_PMC interp, int argc, ARGIN(const char *argv[]),
           case 'G':
             args->turn_gc_off = 1;
             break;
+          case 'O':
+            args->optimize = opt.opt_arg ? opt.opt_arg : "1";
+            break;
+          case 'v':
+            args->verbose = 1;
+            break;
           case 't':
             if (opt.opt_arg && is_all_hex_digits(opt.opt_arg)) {
                 const unsigned long _temp = strtoul(opt.opt_arg, NULL, 16);
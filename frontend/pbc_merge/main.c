@@ -8,7 +8,7 @@ pbc_merge - Merge multiple Parrot bytecode (PBC) files into
 
 =head1 SYNOPSIS
 
- pbc_merge -o out.pbc input1.pbc input2.pbc ...
+ pbc_merge [-s] -o out.pbc input1.pbc input2.pbc ...
 
 =head1 DESCRIPTION
 
@@ -25,8 +25,21 @@ table.
 The name of the PBC file to produce, containing the merged
 segments from the input PBC files.
 
+=item C<-s>, C<--strip>
+
+Leave out the subs that can't be reached from the C<:main> sub, the
+C<:load>, C<:init>, C<:immediate> and C<:postcomp> subs, the tagged subs,
+methods, vtable overrides and multis. A sub is reachable if reachable code
+refers to it as a constant, names it in a string constant (or a constant
+key), or is one of its inner subs. Code that builds sub names at runtime
+or walks namespaces can't be seen through, so only use this on code that
+doesn't.
+
 =back
 
+Number constants, strings, keys and call signatures that are the same in
+several input files are stored once.
+
 =head2 Functions
 
 =over 4
@@ -60,11 +73,46 @@ typedef struct pbc_merge_input {
     } num, str, pmc;
 } pbc_merge_input;
 
+/* Called by pbc_visit_op for each argument of an op, with its arg_type_t. */
+typedef void (*pbc_arg_visitor)(PARROT_INTERP, void *data, opcode_t *arg, INTVAL type);
+
+/* What pbc_strip_subs found out about the merged PMC constants so far. */
+typedef struct pbc_strip_info {
+    PackFile_ByteCode *bc;
+    char              *keep;    /* nonzero for the constants to keep */
+    opcode_t          *todo;    /* kept subs whose code is yet to be scanned */
+    opcode_t           n_todo;
+    Hash              *names;   /* strings the kept code uses */
+} pbc_strip_info;
+
+#define IS_SUB_CONSTANT(p) ((p)->vtable->base_type == enum_class_Sub \
+                         || (p)->vtable->base_type == enum_class_Coroutine)
+
 /* HEADERIZER HFILE: none */
 
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+static void add_annotation(PARROT_INTERP,
+    ARGMOD(PackFile_Annotations *ann),
+    opcode_t offset,
+    opcode_t key,
+    opcode_t type,
+    opcode_t value)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*ann);
+
+static void add_debug_mapping(
+    ARGMOD(PackFile_DebugFilenameMapping *mappings),
+    ARGMOD(opcode_t *count),
+    opcode_t offset,
+    opcode_t filename)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*mappings)
+        FUNC_MODIFIES(*count);
+
 static void ensure_libdep(PARROT_INTERP,
     ARGMOD(PackFile_ByteCode *bc),
     ARGIN(STRING *lib))
@@ -76,6 +124,28 @@ static void ensure_libdep(PARROT_INTERP,
 PARROT_DOES_NOT_RETURN
 static void help(void);
 
+PARROT_WARN_UNUSED_RESULT
+static int is_root_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void keep_constant(PARROT_INTERP,
+    ARGMOD(pbc_strip_info *info),
+    opcode_t idx)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*info);
+
+static void mark_used_constant(PARROT_INTERP,
+    ARGMOD(void *data),
+    ARGMOD(opcode_t *arg),
+    INTVAL type)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*data)
+        FUNC_MODIFIES(*arg);
+
 static void pbc_fixup_bytecode(PARROT_INTERP,
     ARGMOD(pbc_merge_input **inputs),
     int num_inputs,
@@ -93,7 +163,7 @@ static void pbc_fixup_constants(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*inputs);
 
-PARROT_WARN_UNUSED_RESULT
+PARROT_IGNORABLE_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PackFile_Annotations* pbc_merge_annotations(PARROT_INTERP,
     ARGMOD(pbc_merge_input **inputs),
@@ -112,7 +182,8 @@ PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PackFile* pbc_merge_begin(PARROT_INTERP,
     ARGMOD(pbc_merge_input **inputs),
-    int num_inputs)
+    int num_inputs,
+    int strip)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*inputs);
@@ -159,11 +230,58 @@ static void pbc_merge_write(PARROT_INTERP,
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*pf);
 
+static void pbc_strip_subs(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*bc);
+
+static opcode_t pbc_visit_op(PARROT_INTERP,
+    ARGIN(PackFile_ByteCode *bc),
+    ARGMOD(opcode_t *pc),
+    ARGIN_NULLOK(pbc_arg_visitor visit),
+    ARGMOD_NULLOK(void *data))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*pc)
+        FUNC_MODIFIES(*data);
+
+static void renumber_constant(PARROT_INTERP,
+    ARGMOD(void *data),
+    ARGMOD(opcode_t *arg),
+    INTVAL type)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*data)
+        FUNC_MODIFIES(*arg);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING * shareable_pmc_image(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+#define ASSERT_ARGS_add_annotation __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ann))
+#define ASSERT_ARGS_add_debug_mapping __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(mappings) \
+    , PARROT_ASSERT_ARG(count))
 #define ASSERT_ARGS_ensure_libdep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(bc) \
     , PARROT_ASSERT_ARG(lib))
 #define ASSERT_ARGS_help __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_is_root_sub __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sub_pmc))
+#define ASSERT_ARGS_keep_constant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_mark_used_constant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(data) \
+    , PARROT_ASSERT_ARG(arg))
 #define ASSERT_ARGS_pbc_fixup_bytecode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(inputs) \
@@ -195,6 +313,19 @@ static void pbc_merge_write(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pf) \
     , PARROT_ASSERT_ARG(filename))
+#define ASSERT_ARGS_pbc_strip_subs __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc))
+#define ASSERT_ARGS_pbc_visit_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(bc) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_renumber_constant __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(data) \
+    , PARROT_ASSERT_ARG(arg))
+#define ASSERT_ARGS_shareable_pmc_image __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -214,7 +345,8 @@ help(void)
 {
     printf("pbc_merge - merge multiple parrot bytecode files into one\n");
     printf("Usage:\n");
-    printf("   pbc_merge -o out.pbc file1.pbc file2.pbc ...\n\n");
+    printf("   pbc_merge [-s] -o out.pbc file1.pbc file2.pbc ...\n\n");
+    printf("   -s, --strip    leave out the subs nothing refers to\n\n");
     exit(0);
 }
 
@@ -311,7 +443,7 @@ pbc_merge_bytecode(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
         /* Update main_sub. */
         if (in_seg->main_sub >= 0) {
             if (bc_seg->main_sub < 0)
-                bc_seg->main_sub = in_seg->main_sub + inputs[i]->pmc.const_start;
+                bc_seg->main_sub = inputs[i]->pmc.const_map[in_seg->main_sub];
             /*
             XXX hide incessant warning messages triggered by implicit :main
             this can be added when GH #571 is implemented
@@ -333,12 +465,42 @@ pbc_merge_bytecode(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
 }
 
 
+/*
+
+=item C<static STRING * shareable_pmc_image(PARROT_INTERP, PMC *pmc)>
+
+Returns the frozen C<pmc> if it's a constant that all the inputs can share,
+being a key or a call signature, or NULL otherwise. Other PMCs, subs above
+all, stay one per input.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING *
+shareable_pmc_image(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(shareable_pmc_image)
+
+    switch (pmc->vtable->base_type) {
+      case enum_class_Key:
+      case enum_class_FixedIntegerArray:
+        return Parrot_freeze(interp, pmc);
+      default:
+        return NULL;
+    }
+}
+
 /*
 
 =item C<static PackFile_ConstTable* pbc_merge_constants(PARROT_INTERP,
 pbc_merge_input **inputs, int num_inputs, PackFile *pf)>
 
-This function merges the constants tables from the input PBC files.
+This function merges the constants tables from the input PBC files. Numbers,
+strings and the PMCs C<shareable_pmc_image> allows that several inputs have in
+common are stored once.
 
 =cut
 
@@ -356,6 +518,14 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
     Hash *all_seen_strings = Parrot_hash_create(interp, enum_type_INTVAL,
                                                 Hash_key_type_STRING);
 
+    /* bit pattern -> idx mapping for all numbers */
+    Hash *all_seen_nums = Parrot_hash_create(interp, enum_type_INTVAL,
+                                             Hash_key_type_STRING);
+
+    /* frozen PMC -> idx mapping for the PMCs that can be shared */
+    Hash *all_seen_pmcs = Parrot_hash_create(interp, enum_type_INTVAL,
+                                             Hash_key_type_STRING);
+
     FLOATVAL  *num_constants = mem_gc_allocate_typed(interp, FLOATVAL);
     STRING   **str_constants = mem_gc_allocate_typed(interp, STRING *);
     PMC      **pmc_constants = mem_gc_allocate_typed(interp, PMC *);
@@ -378,6 +548,9 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
         exit(1);
     }
 
+    /* the number and frozen PMC keys are only referenced from the hashes */
+    Parrot_block_GC_mark(interp);
+
     /* Loop over input files. */
     for (i = 0; i < num_inputs; ++i) {
         opcode_t pmc_cursor_start = pmc_cursor;
@@ -412,7 +585,19 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
 
         /* Loop over the constants and copy them to the output PBC. */
         for (j = 0; j < in_seg->num.const_count; j++) {
-            num_constants[num_cursor] = in_seg->num.constants[j];
+            const FLOATVAL num = in_seg->num.constants[j];
+
+            /* key on the bits, so 0.0 and -0.0 stay apart */
+            STRING * const bits = Parrot_str_new_init(interp, (const char *)&num,
+                                    sizeof (FLOATVAL), Parrot_binary_encoding_ptr, 0);
+
+            if (Parrot_hash_exists(interp, all_seen_nums, bits)) {
+                opcode_t new_idx = (opcode_t)Parrot_hash_get(interp, all_seen_nums, bits);
+                inputs[i]->num.const_map[j] = new_idx;
+                continue;
+            }
+            num_constants[num_cursor] = num;
+            Parrot_hash_put(interp, all_seen_nums, bits, (void *)num_cursor);
             inputs[i]->num.const_map[j] = num_cursor;
             num_cursor++;
         }
@@ -431,7 +616,17 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
         }
 
         for (j = 0; j < in_seg->pmc.const_count; j++) {
-            pmc_constants[pmc_cursor] = in_seg->pmc.constants[j];
+            PMC    * const pmc    = in_seg->pmc.constants[j];
+            STRING * const frozen = shareable_pmc_image(interp, pmc);
+
+            if (frozen && Parrot_hash_exists(interp, all_seen_pmcs, frozen)) {
+                opcode_t new_idx = (opcode_t)Parrot_hash_get(interp, all_seen_pmcs, frozen);
+                inputs[i]->pmc.const_map[j] = new_idx;
+                continue;
+            }
+            pmc_constants[pmc_cursor] = pmc;
+            if (frozen)
+                Parrot_hash_put(interp, all_seen_pmcs, frozen, (void *)pmc_cursor);
             inputs[i]->pmc.const_map[j] = pmc_cursor;
             pmc_cursor++;
         }
@@ -469,6 +664,8 @@ pbc_merge_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
         }
     }
 
+    Parrot_unblock_GC_mark(interp);
+
     /* Return the merged segment */
     return const_seg;
 }
@@ -480,13 +677,14 @@ pbc_merge_input **inputs, int num_inputs, PackFile *pf, PackFile_ByteCode *bc)>
 
 Merge Annotations segments from C<inputs> into a new C<PackFile_Annotations>
 segment. Returns the new merged segment (which is also already appended to
-the directory in C<pf>).
+the directory in C<pf>). Entries that don't change the value in force are
+left out.
 
 =cut
 
 */
 
-PARROT_WARN_UNUSED_RESULT
+PARROT_IGNORABLE_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PackFile_Annotations*
 pbc_merge_annotations(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
@@ -498,11 +696,12 @@ pbc_merge_annotations(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
     int key_cursor = 0;
 
     for (i = 0; i < num_inputs; i++) {
-        PackFile_ByteCode * const in_bc = inputs[i]->pf->cur_cs;
-        PackFile_Annotations * const in_ann =
-            Parrot_pf_get_annotations_segment(interp, inputs[i]->pf, in_bc);
+        const PackFile_Annotations * const in_ann = inputs[i]->pf->cur_cs->annotations;
         int j;
 
+        if (!in_ann)
+            continue;
+
         for (j = 0; j < in_ann->num_keys; j++) {
             const opcode_t old_name_idx = in_ann->keys[j].name;
             const opcode_t old_len = in_ann->keys[j].len;
@@ -532,7 +731,7 @@ pbc_merge_annotations(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
                         exit(1);
                 }
 
-                PackFile_Annotations_add_entry(interp, merged,
+                add_annotation(interp, merged,
                     old_offset + inputs[i]->code_start,
                     new_key,
                     in_ann->keys[j].type,
@@ -545,12 +744,84 @@ pbc_merge_annotations(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
 }
 
 
+/*
+
+=item C<static void add_annotation(PARROT_INTERP, PackFile_Annotations *ann,
+opcode_t offset, opcode_t key, opcode_t type, opcode_t value)>
+
+Adds an entry to C<ann> like C<PackFile_Annotations_add_entry>, for an
+C<offset> no smaller than that of the key's entries so far. An entry with the
+value already in force is left out; one at the same offset as the last
+replaces its value.
+
+=cut
+
+*/
+
+static void
+add_annotation(PARROT_INTERP, ARGMOD(PackFile_Annotations *ann),
+        opcode_t offset, opcode_t key, opcode_t type, opcode_t value)
+{
+    ASSERT_ARGS(add_annotation)
+    INTVAL i;
+
+    for (i = 0; i < ann->num_keys; ++i) {
+        const PackFile_Annotations_Key * const k = ann->keys + i;
+
+        if (k->name == (UINTVAL)key && k->type == (pf_ann_key_type_t)type && k->len) {
+            opcode_t * const last = ann->base.data + (k->start + k->len - 1) * 2;
+
+            if (last[ANN_ENTRY_VAL] == value)
+                return;
+
+            if (last[ANN_ENTRY_OFF] == offset) {
+                last[ANN_ENTRY_VAL] = value;
+                return;
+            }
+            break;
+        }
+    }
+
+    PackFile_Annotations_add_entry(interp, ann, offset, key, type, value);
+}
+
+/*
+
+=item C<static void add_debug_mapping(PackFile_DebugFilenameMapping *mappings,
+opcode_t *count, opcode_t offset, opcode_t filename)>
+
+Appends a mapping to the C<count> C<mappings>, which have room for it, unless
+the file is already mapped there. A mapping at the same offset as the last
+replaces it.
+
+=cut
+
+*/
+
+static void
+add_debug_mapping(ARGMOD(PackFile_DebugFilenameMapping *mappings),
+        ARGMOD(opcode_t *count), opcode_t offset, opcode_t filename)
+{
+    ASSERT_ARGS(add_debug_mapping)
+
+    if (*count && mappings[*count - 1].offset == offset)
+        --*count;
+
+    if (*count && mappings[*count - 1].filename == filename)
+        return;
+
+    mappings[*count].offset   = offset;
+    mappings[*count].filename = filename;
+    ++*count;
+}
+
 /*
 
 =item C<static void pbc_merge_debugs(PARROT_INTERP, pbc_merge_input **inputs,
 int num_inputs, PackFile_ByteCode *bc)>
 
-This function merges the debug segments from the input PBC files.
+This function merges the debug segments from the input PBC files. Inputs
+compiled from the same file share one filename mapping.
 
 =cut
 
@@ -591,16 +862,13 @@ pbc_merge_debugs(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs),
                 num_mappings + in_seg->num_mappings,
                 PackFile_DebugFilenameMapping);
 
-        for (j = 0; j < in_seg->num_mappings; ++j) {
-            PackFile_DebugFilenameMapping *mapping = mappings + num_mappings + j;
-
-            STRUCT_COPY_FROM_STRUCT(mapping, in_seg->mappings[j]);
-            mapping->offset   += num_lines;
-            mapping->filename = inputs[i]->str.const_map[mapping->filename];
-        }
+        /* Mappings are by bytecode offset, not by line. */
+        for (j = 0; j < in_seg->num_mappings; ++j)
+            add_debug_mapping(mappings, &num_mappings,
+                in_seg->mappings[j].offset + inputs[i]->code_start,
+                inputs[i]->str.const_map[in_seg->mappings[j].filename]);
 
         num_lines    += in_seg->base.size - 1;
-        num_mappings += in_seg->num_mappings;
     }
 
     /* Create merged debug segment. Replace created data and mappings
@@ -828,10 +1096,403 @@ pbc_fixup_constants(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs), int num_inp
 
 /*
 
+=item C<static opcode_t pbc_visit_op(PARROT_INTERP, PackFile_ByteCode *bc,
+opcode_t *pc, pbc_arg_visitor visit, void *data)>
+
+Calls C<visit>, if given, for each argument of the op at C<pc> in C<bc>,
+including those described by a call signature. Returns the size of the op.
+
+=cut
+
+*/
+
+static opcode_t
+pbc_visit_op(PARROT_INTERP, ARGIN(PackFile_ByteCode *bc), ARGMOD(opcode_t *pc),
+        ARGIN_NULLOK(pbc_arg_visitor visit), ARGMOD_NULLOK(void *data))
+{
+    ASSERT_ARGS(pbc_visit_op)
+    const op_info_t * const op       = bc->op_info_table[*pc];
+    const op_func_t         op_func  = bc->op_func_table[*pc];
+    op_lib_t        * const core_ops = PARROT_GET_CORE_OPLIB(interp);
+    PMC                    *sig      = PMCNULL;
+    opcode_t                size     = op->op_count;
+    int                     i;
+
+    /* Get the signature before a visitor gets to renumber it. */
+    if (op_func == core_ops->op_func_table[PARROT_OP_set_args_pc]    ||
+        op_func == core_ops->op_func_table[PARROT_OP_get_results_pc] ||
+        op_func == core_ops->op_func_table[PARROT_OP_get_params_pc]  ||
+        op_func == core_ops->op_func_table[PARROT_OP_set_returns_pc])
+        sig = bc->const_table->pmc.constants[pc[1]];
+
+    if (visit)
+        for (i = 1; i < op->op_count; ++i)
+            visit(interp, data, pc + i, op->types[i - 1]);
+
+    if (!PMC_IS_NULL(sig)) {
+        const INTVAL sig_items = VTABLE_elements(interp, sig);
+
+        if (visit)
+            for (i = 0; i < sig_items; ++i)
+                visit(interp, data, pc + size + i,
+                    VTABLE_get_integer_keyed_int(interp, sig, i));
+
+        size += sig_items;
+    }
+
+    return size;
+}
+
+/*
+
+=item C<static void keep_constant(PARROT_INTERP, pbc_strip_info *info, opcode_t
+idx)>
+
+Notes that kept code refers to PMC constant C<idx>. A sub is kept and queued
+for scanning; the strings in a key count as used.
+
+=cut
+
+*/
+
+static void
+keep_constant(PARROT_INTERP, ARGMOD(pbc_strip_info *info), opcode_t idx)
+{
+    ASSERT_ARGS(keep_constant)
+    PMC * const pmc = info->bc->const_table->pmc.constants[idx];
+
+    if (IS_SUB_CONSTANT(pmc)) {
+        if (!info->keep[idx]) {
+            info->keep[idx]                = 1;
+            info->todo[info->n_todo++] = idx;
+        }
+    }
+    else if (pmc->vtable->base_type == enum_class_Key) {
+        PMC *key;
+
+        for (key = pmc; !PMC_IS_NULL(key); key = Parrot_key_next(interp, key))
+            if (KEY_get_FLAGS(key) == KEY_string_FLAG)
+                Parrot_hash_put(interp, info->names, Parrot_key_string(interp, key),
+                        (void *)1);
+    }
+}
+
+/*
+
+=item C<static void mark_used_constant(PARROT_INTERP, void *data, opcode_t *arg,
+INTVAL type)>
+
+The C<pbc_arg_visitor> that records the string and PMC constants of kept code
+in the C<pbc_strip_info> C<data>.
+
+=cut
+
+*/
+
+static void
+mark_used_constant(PARROT_INTERP, ARGMOD(void *data), ARGMOD(opcode_t *arg), INTVAL type)
+{
+    ASSERT_ARGS(mark_used_constant)
+    pbc_strip_info * const info = (pbc_strip_info *)data;
+
+    if (!(type & PARROT_ARG_CONSTANT))
+        return;
+
+    switch (PARROT_ARG_TYPE(type)) {
+      case PARROT_ARG_STRING:
+        Parrot_hash_put(interp, info->names,
+            info->bc->const_table->str.constants[*arg], (void *)1);
+        break;
+      case PARROT_ARG_PMC:
+        keep_constant(interp, info, *arg);
+        break;
+      default:
+        break;
+    }
+}
+
+/*
+
+=item C<static void renumber_constant(PARROT_INTERP, void *data, opcode_t *arg,
+INTVAL type)>
+
+The C<pbc_arg_visitor> that moves PMC constant arguments to their index in
+the stripped table, which C<data> maps them to.
+
+=cut
+
+*/
+
+static void
+renumber_constant(SHIM_INTERP, ARGMOD(void *data), ARGMOD(opcode_t *arg), INTVAL type)
+{
+    ASSERT_ARGS(renumber_constant)
+
+    if ((type & PARROT_ARG_CONSTANT) && PARROT_ARG_TYPE(type) == PARROT_ARG_PMC)
+        *arg = ((const opcode_t *)data)[*arg];
+}
+
+/*
+
+=item C<static int is_root_sub(PARROT_INTERP, PMC *sub_pmc)>
+
+Returns true if the VM may run C<sub_pmc> without any code naming it: a
+C<:load>, C<:init>, C<:immediate> or C<:postcomp> sub, a method, a vtable
+override or a multi.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_root_sub(PARROT_INTERP, ARGIN(PMC *sub_pmc))
+{
+    ASSERT_ARGS(is_root_sub)
+    Parrot_Sub_attributes *sub;
+
+    PMC_get_sub(interp, sub_pmc, sub);
+
+    return (PObj_get_FLAGS(sub_pmc) & (SUB_FLAG_PF_LOAD | SUB_FLAG_PF_IMMEDIATE
+                                     | SUB_FLAG_PF_POSTCOMP))
+        || (sub->comp_flags & SUB_COMP_FLAG_PF_INIT)
+        || !STRING_IS_NULL(sub->method_name)
+        || sub->vtable_index != -1
+        || !PMC_IS_NULL(sub->multi_signature);
+}
+
+/*
+
+=item C<static void pbc_strip_subs(PARROT_INTERP, PackFile_ByteCode *bc)>
+
+Removes the subs that can't be reached from the main sub, the tagged subs and
+those C<is_root_sub> accepts from the merged C<bc>: their constants, their
+code, and its debug lines and annotations. Reachable code is scanned for the
+PMC constants and the names it uses, and the subs found are scanned in turn;
+the C<:outer> of a kept sub is kept too.
+
+=cut
+
+*/
+
+static void
+pbc_strip_subs(PARROT_INTERP, ARGMOD(PackFile_ByteCode *bc))
+{
+    ASSERT_ARGS(pbc_strip_subs)
+    PackFile_ConstTable * const ct      = bc->const_table;
+    PackFile_Debug      * const debug   = bc->debugs;
+    const opcode_t              n_pmc   = ct->pmc.const_count;
+    const opcode_t              size    = (opcode_t)bc->base.size;
+    opcode_t            * const ops     = bc->base.data;
+    char                * const in_sub  = mem_gc_allocate_n_zeroed_typed(interp, size + 1, char);
+    opcode_t            * const new_pos = mem_gc_allocate_n_typed(interp, size + 1, opcode_t);
+    opcode_t            * const pmc_map = mem_gc_allocate_n_typed(interp, n_pmc + 1, opcode_t);
+    pbc_strip_info              info;
+    opcode_t                    i, k, n, pc, cursor, n_ops, n_lines, added;
+
+    info.bc     = bc;
+    info.keep   = mem_gc_allocate_n_zeroed_typed(interp, n_pmc + 1, char);
+    info.todo   = mem_gc_allocate_n_typed(interp, n_pmc + 1, opcode_t);
+    info.n_todo = 0;
+    info.names  = Parrot_hash_create(interp, enum_type_INTVAL, Hash_key_type_STRING);
+
+    /* Find the roots, and the code that belongs to no sub. */
+    for (i = 0; i < n_pmc; ++i) {
+        PMC * const pmc = ct->pmc.constants[i];
+        Parrot_Sub_attributes *sub;
+
+        if (!IS_SUB_CONSTANT(pmc)) {
+            info.keep[i] = 1;
+            continue;
+        }
+
+        PMC_get_sub(interp, pmc, sub);
+        memset(in_sub + sub->start_offs, 1, sub->end_offs - sub->start_offs);
+
+        if (is_root_sub(interp, pmc))
+            keep_constant(interp, &info, i);
+    }
+
+    if (bc->main_sub >= 0)
+        keep_constant(interp, &info, bc->main_sub);
+
+    for (i = 0; i < ct->ntags; ++i)
+        keep_constant(interp, &info, ct->tag_map[i].const_idx);
+
+    for (pc = 0; pc < size; pc += n)
+        n = pbc_visit_op(interp, bc, ops + pc,
+                in_sub[pc] ? NULL : mark_used_constant, &info);
+
+    /* Scan the kept subs, then keep the subs they name, until no more turn up. */
+    do {
+        while (info.n_todo) {
+            PMC * const pmc = ct->pmc.constants[info.todo[--info.n_todo]];
+            Parrot_Sub_attributes *sub;
+
+            PMC_get_sub(interp, pmc, sub);
+
+            for (pc = sub->start_offs; pc < (opcode_t)sub->end_offs; pc += n)
+                n = pbc_visit_op(interp, bc, ops + pc, mark_used_constant, &info);
+
+            if (!PMC_IS_NULL(sub->outer_sub))
+                for (i = 0; i < n_pmc; ++i)
+                    if (ct->pmc.constants[i] == sub->outer_sub)
+                        keep_constant(interp, &info, i);
+        }
+
+        for (i = 0; i < n_pmc; ++i) {
+            PMC * const pmc = ct->pmc.constants[i];
+            Parrot_Sub_attributes *sub;
+
+            if (info.keep[i])
+                continue;
+
+            PMC_get_sub(interp, pmc, sub);
+
+            if (Parrot_hash_exists(interp, info.names, sub->name)
+            || (!STRING_IS_NULL(sub->ns_entry_name)
+            &&  Parrot_hash_exists(interp, info.names, sub->ns_entry_name)))
+                keep_constant(interp, &info, i);
+        }
+    } while (info.n_todo);
+
+    for (i = added = 0; i < n_pmc; ++i) {
+        pmc_map[i] = info.keep[i] ? added++ : -1;
+    }
+
+    if (added < n_pmc) {
+        /* Mark the code of the subs to drop, then move the rest down. */
+        memset(in_sub, 0, size);
+
+        for (i = 0; i < n_pmc; ++i) {
+            Parrot_Sub_attributes *sub;
+
+            if (info.keep[i])
+                continue;
+
+            PMC_get_sub(interp, ct->pmc.constants[i], sub);
+            memset(in_sub + sub->start_offs, 1, sub->end_offs - sub->start_offs);
+        }
+
+        cursor = n_ops = n_lines = 0;
+
+        for (pc = 0; pc < size; pc += n, ++n_ops) {
+            n = pbc_visit_op(interp, bc, ops + pc, NULL, NULL);
+
+            if (in_sub[pc]) {
+                for (k = 0; k < n; ++k)
+                    new_pos[pc + k] = cursor;
+                continue;
+            }
+
+            for (k = 0; k < n; ++k)
+                new_pos[pc + k] = cursor + k;
+
+            if (debug && n_ops < (opcode_t)debug->base.size)
+                debug->base.data[n_lines++] = debug->base.data[n_ops];
+
+            memmove(ops + cursor, ops + pc, n * sizeof (opcode_t));
+            cursor += n;
+        }
+
+        new_pos[size]  = cursor;
+        bc->base.size  = cursor;
+
+        pc = 0;
+        while (pc < cursor)
+            pc += pbc_visit_op(interp, bc, ops + pc, renumber_constant, pmc_map);
+
+        /* Drop the subs' constants and move the kept subs with their code. */
+        for (i = 0; i < n_pmc; ++i) {
+            PMC * const pmc = ct->pmc.constants[i];
+
+            if (pmc_map[i] < 0)
+                continue;
+
+            if (IS_SUB_CONSTANT(pmc)) {
+                Parrot_Sub_attributes *sub;
+                PMC_get_sub(interp, pmc, sub);
+                sub->start_offs = new_pos[sub->start_offs];
+                sub->end_offs   = new_pos[sub->end_offs];
+            }
+
+            ct->pmc.constants[pmc_map[i]] = pmc;
+        }
+
+        ct->pmc.const_count = added;
+
+        if (bc->main_sub >= 0)
+            bc->main_sub = pmc_map[bc->main_sub];
+
+        for (i = 0; i < ct->ntags; ++i)
+            ct->tag_map[i].const_idx = pmc_map[ct->tag_map[i].const_idx];
+
+        if (debug) {
+            opcode_t n_mappings = 0;
+
+            for (i = 0; i < debug->num_mappings; ++i)
+                add_debug_mapping(debug->mappings, &n_mappings,
+                    new_pos[debug->mappings[i].offset], debug->mappings[i].filename);
+
+            debug->num_mappings = n_mappings;
+            debug->base.size    = n_lines;
+            debug->indexed_size = 0;
+        }
+
+        /* An annotation from dropped code is still in force after it: keep it
+           just before the next op left. */
+        if (bc->annotations) {
+            PackFile_Annotations * const ann  = bc->annotations;
+            opcode_t             * const data = ann->base.data;
+            opcode_t                     out  = 0;
+
+            for (i = 0; i < ann->num_keys; ++i) {
+                PackFile_Annotations_Key * const key   = ann->keys + i;
+                const opcode_t                   start = out;
+
+                for (k = key->start; k < (opcode_t)(key->start + key->len); ++k) {
+                    const opcode_t old  = data[k * 2 + ANN_ENTRY_OFF];
+                    opcode_t       offs = new_pos[old];
+                    opcode_t       val  = data[k * 2 + ANN_ENTRY_VAL];
+
+                    if (old < size && in_sub[old] && offs > 0)
+                        --offs;
+
+                    if (key->type == PF_ANNOTATION_KEY_TYPE_PMC)
+                        val = pmc_map[val];
+
+                    if (out > start && data[(out - 1) * 2 + ANN_ENTRY_OFF] == offs)
+                        data[(out - 1) * 2 + ANN_ENTRY_VAL] = val;
+                    else if (out == start || data[(out - 1) * 2 + ANN_ENTRY_VAL] != val) {
+                        data[out * 2 + ANN_ENTRY_OFF] = offs;
+                        data[out * 2 + ANN_ENTRY_VAL] = val;
+                        ++out;
+                    }
+                }
+
+                key->start = start;
+                key->len   = out - start;
+            }
+
+            ann->base.size = out * 2;
+        }
+    }
+
+    Parrot_hash_destroy(interp, info.names);
+    mem_gc_free(interp, info.keep);
+    mem_gc_free(interp, info.todo);
+    mem_gc_free(interp, in_sub);
+    mem_gc_free(interp, new_pos);
+    mem_gc_free(interp, pmc_map);
+}
+
+/*
+
 =item C<static PackFile* pbc_merge_begin(PARROT_INTERP, pbc_merge_input
-**inputs, int num_inputs)>
+**inputs, int num_inputs, int strip)>
 
-This is the function that drives PBC merging process.
+This is the function that drives PBC merging process. If C<strip> is set,
+the subs nothing refers to are left out.
 
 =cut
 
@@ -839,7 +1500,8 @@ This is the function that drives PBC merging process.
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PackFile*
-pbc_merge_begin(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs), int num_inputs)
+pbc_merge_begin(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs), int num_inputs,
+        int strip)
 {
     ASSERT_ARGS(pbc_merge_begin)
     PackFile_ByteCode    *bc;
@@ -879,6 +1541,7 @@ pbc_merge_begin(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs), int num_inputs)
     interp->code    = bc;
 
     pbc_merge_debugs(interp, inputs, num_inputs, bc);
+    pbc_merge_annotations(interp, inputs, num_inputs, merged, bc);
 
     /* Walk bytecode and fix ops that reference the constants table. */
     pbc_fixup_bytecode(interp, inputs, num_inputs, bc);
@@ -886,6 +1549,9 @@ pbc_merge_begin(PARROT_INTERP, ARGMOD(pbc_merge_input **inputs), int num_inputs)
     /* Walk constants and fix references into bytecode. */
     pbc_fixup_constants(interp, inputs, num_inputs);
 
+    if (strip)
+        pbc_strip_subs(interp, bc);
+
     for (i = 0; i < num_inputs; ++i) {
         mem_gc_free(interp, inputs[i]->num.const_map);
         mem_gc_free(interp, inputs[i]->str.const_map);
@@ -949,6 +1615,7 @@ merge process and finally writes out the produced packfile.
 
 static struct longopt_opt_decl options[] = {
     { 'o', 'o', OPTION_required_FLAG, { "--output" } },
+    { 's', 's', (OPTION_flags)0,      { "--strip" } },
     {  0 ,  0 , OPTION_optional_FLAG, { NULL       } }
 };
 
@@ -960,6 +1627,7 @@ main(int argc, const char **argv)
     PackFile *merged;
     int i;
     const char *output_file     = NULL;
+    int         strip           = 0;
     struct longopt_opt_info opt = LONGOPT_OPT_INFO_INIT;
     Interp * const interp = Parrot_interp_new(NULL);
     STRING * pbcname = NULL;
@@ -980,6 +1648,9 @@ main(int argc, const char **argv)
                 else
                     help();
                 break;
+            case 's':
+                strip = 1;
+                break;
             case '?':
                 help();
                 break;
@@ -1025,7 +1696,7 @@ main(int argc, const char **argv)
     }
 
     /* Merge. */
-    merged = pbc_merge_begin(interp, input_files, argc);
+    merged = pbc_merge_begin(interp, input_files, argc, strip);
 
     /* Write merged packfile. */
     pbc_merge_write(interp, merged, output_file);
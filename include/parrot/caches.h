@@ -25,6 +25,18 @@ typedef struct _meth_cache_entry {
     struct _meth_cache_entry *next;
 } Meth_cache_entry;
 
+/*
+ * global lookup cache entry, valid while the NameSpace version matches
+ */
+typedef struct _global_cache_entry {
+    PMC     *ns;                /* the NameSpace looked in */
+    STRING  *name;              /* the interned name looked up */
+    UINTVAL  version;           /* version of ns when the entry was filled */
+    PMC     *value;             /* the global found, or PMCNULL */
+} Global_cache_entry;
+
+#define GLOBAL_CACHE_SIZE 512   /* entries, a power of two */
+
 /*
  * method cache, continuation freelist, stack chunk freelist, regsave cache
  */
@@ -32,6 +44,7 @@ typedef struct _Caches {
     UINTVAL mc_size;            /* sizeof table */
     Meth_cache_entry ***idx;    /* bufstart idx */
     /* PMC **hash */            /* for non-constant keys */
+    Global_cache_entry *globals;    /* direct-mapped on (ns, name) */
 } Caches;
 
 #endif   /* PARROT_CACHES_H_GUARD */
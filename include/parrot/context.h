@@ -24,10 +24,55 @@ typedef union {
 
 #include "pmc/pmc_callcontext.h"
 
+/* Storage for one positional argument of a CallContext */
+typedef struct Pcc_cell
+{
+    union u {
+        PMC     *p;
+        STRING  *s;
+        INTVAL   i;
+        FLOATVAL n;
+    } u;
+    INTVAL type;
+} Pcc_cell;
+
+#define NOCELL     0
+#define INTCELL    1
+#define FLOATCELL  2
+#define STRINGCELL 3
+#define PMCCELL    4
+
+#define CELL_TYPE_MASK(c) (c)->type
+
+#define CELL_INT(c)     (c)->u.i
+#define CELL_FLOAT(c)   (c)->u.n
+#define CELL_STRING(c)  (c)->u.s
+#define CELL_PMC(c)     (c)->u.p
+
 typedef struct Parrot_CallContext_attributes Parrot_Context;
 
 #define CONTEXT_STRUCT(c) (PMC_data_typed((c), Parrot_Context *))
 
+/* CallContext specific FLAGs. A CallContext is also a call signature, so
+ * these must not share a bit with the CALLSIGNATURE flags in call.h */
+typedef enum {
+    /* frame of a plain Sub called from bytecode; see Parrot_pcc_recycle_context */
+    CTX_recyclable_FLAG     = PObj_private2_FLAG,
+    /* frame may be referenced after it returns; so may all its callers */
+    CTX_escaped_FLAG        = PObj_private3_FLAG
+} CallContext_flags;
+
+#define CTX_flag_TEST(flag, c)  (PObj_get_FLAGS(c) & CTX_ ## flag ## _FLAG)
+#define CTX_flag_SET(flag, c)   (PObj_get_FLAGS(c) |= CTX_ ## flag ## _FLAG)
+#define CTX_flag_CLEAR(flag, c) (PObj_get_FLAGS(c) &= ~(UINTVAL)(CTX_ ## flag ## _FLAG))
+
+#define CTX_recyclable_TEST(c)  CTX_flag_TEST(recyclable, (c))
+#define CTX_recyclable_SET(c)   CTX_flag_SET(recyclable, (c))
+#define CTX_recyclable_CLEAR(c) CTX_flag_CLEAR(recyclable, (c))
+
+#define CTX_escaped_TEST(c)     CTX_flag_TEST(escaped, (c))
+#define CTX_escaped_SET(c)      CTX_flag_SET(escaped, (c))
+
 /*
  * Macros to make accessing registers more convenient/readable.
  */
@@ -18,6 +18,11 @@ void Parrot_cx_add_handler_local(PARROT_INTERP, ARGIN(PMC *handler))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+void Parrot_cx_add_label_handler_local(PARROT_INTERP, ARGIN(opcode_t *addr))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_EXPORT
 INTVAL Parrot_cx_count_handlers_local(PARROT_INTERP)
         __attribute__nonnull__(1);
@@ -61,6 +66,10 @@ PMC * Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
 #define ASSERT_ARGS_Parrot_cx_add_handler_local __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(handler))
+#define ASSERT_ARGS_Parrot_cx_add_label_handler_local \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(addr))
 #define ASSERT_ARGS_Parrot_cx_count_handlers_local \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
@@ -115,6 +115,13 @@ typedef enum {
 
 /* &end_gen */
 
+/* One caller frame, as noted when an exception is thrown.  File and line
+ * are looked up from the sub's segment only when a backtrace is asked for. */
+typedef struct Parrot_ex_frame {
+    PMC      *sub;      /* the sub running in the frame */
+    opcode_t *pc;       /* where it was when the exception was thrown */
+} Parrot_ex_frame;
+
 /* HEADERIZER BEGIN: src/exceptions.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -151,6 +158,16 @@ PMC * Parrot_ex_build_exception(PARROT_INTERP,
     ARGIN_NULLOK(STRING *msg))
         __attribute__nonnull__(1);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+Parrot_ex_frame * Parrot_ex_capture_frames(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *ctx),
+    ARGFREE(Parrot_ex_frame *frames),
+    ARGOUT(INTVAL *count))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*count);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
@@ -236,6 +253,9 @@ void Parrot_print_backtrace(void);
     , PARROT_ASSERT_ARG(jp))
 #define ASSERT_ARGS_Parrot_ex_build_exception __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_ex_capture_frames __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(count))
 #define ASSERT_ARGS_Parrot_ex_get_current_handler __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_ex_mark_unhandled __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -17,6 +17,9 @@
 /* preallocate freeze image for aggregates with this estimation */
 #define FREEZE_BYTES_PER_ITEM 9
 
+/* size of the chunks an image is written in when freezing to a Handle */
+#define FREEZE_STREAM_CHUNK_SIZE 8192
+
 enum {
     enum_PackID_normal      = 0,
     enum_PackID_seen        = 1,
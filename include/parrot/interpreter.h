@@ -63,7 +63,8 @@ typedef enum {
     PARROT_PROFILING_CORE   = 0x160,        /* used by parrot debugger */
     PARROT_SUBPROF_SUB_CORE = 0x200,        /* sub profiler core, sub mode */
     PARROT_SUBPROF_HLL_CORE = 0x201,        /* sub profiler core, hll mode */
-    PARROT_SUBPROF_OPS_CORE = 0x202         /* sub profiler core, ops mode */
+    PARROT_SUBPROF_OPS_CORE = 0x202,        /* sub profiler core, ops mode */
+    PARROT_SAMPLING_CORE    = 0x210         /* sampling profiler core */
 } Parrot_Run_core_t;
 /* &end_gen */
 
@@ -236,6 +237,7 @@ struct parrot_interp_t {
 
     STRING     **const_cstring_table;         /* CONST_STRING(x) items */
     Hash        *const_cstring_hash;          /* cache of const_string items */
+    Hash        *interned_strings;            /* canonical constant STRINGs */
 
     struct _handler_node_t *exit_handler_list;/* exit.c */
     int sleeping;                             /* used during sleep in events */
@@ -260,6 +262,9 @@ struct parrot_interp_t {
     /* during a call sequencer the caller fills these objects
      * inside the invoke these get moved to the context structure */
     PMC *current_cont;                        /* the return continuation PMC */
+    PMC *ctx_pool;                            /* returned CallContexts kept for
+                                               * reuse, chained by caller_ctx */
+    UINTVAL ctx_pool_size;                    /* number of contexts in ctx_pool */
     Parrot_jump_buff *api_jmp_buf;            /* jmp point out of Parrot */
     PMC * final_exception;                    /* Final exception PMC */
     INTVAL exit_code;
@@ -290,6 +295,7 @@ typedef enum {
     IGLOBALS_PBC_LIBS,          /* Hash of load_bytecode cde */
     IGLOBALS_EXECUTABLE,        /* How Parrot was invoked (from argv[0]) */
     IGLOBALS_LOADED_PBCS,       /* Hash of .pbc file -> PackfileView */
+    IGLOBALS_LIB_PATH_CACHE,    /* per search path Hash of resolved names */
 
     IGLOBALS_SIZE
 } iglobals_enum;
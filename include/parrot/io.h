@@ -398,6 +398,18 @@ INTVAL Parrot_io_puts(PARROT_INTERP, ARGMOD(PMC *pmc), ARGIN(const char *s))
         __attribute__nonnull__(3)
         FUNC_MODIFIES(*pmc);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+size_t Parrot_io_read_b(PARROT_INTERP,
+    ARGMOD(PMC *handle),
+    ARGOUT(void *buffer),
+    size_t byte_length)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*handle)
+        FUNC_MODIFIES(*buffer);
+
 PARROT_EXPORT
 PARROT_CANNOT_RETURN_NULL
 PMC * Parrot_io_read_byte_buffer_pmc(PARROT_INTERP,
@@ -775,6 +787,10 @@ INTVAL Parrot_io_write_byte_buffer_pmc(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(pmc) \
     , PARROT_ASSERT_ARG(s))
+#define ASSERT_ARGS_Parrot_io_read_b __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(handle) \
+    , PARROT_ASSERT_ARG(buffer))
 #define ASSERT_ARGS_Parrot_io_read_byte_buffer_pmc \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -698,6 +698,8 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_freeze_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_thaw_p_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_thaw_p_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_freeze_p_p(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_thaw_p_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_add_multi_s_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_add_multi_sc_s_p(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_add_multi_s_sc_p(opcode_t *, PARROT_INTERP);
@@ -1016,6 +1018,28 @@ op_lib_t *PARROT_CORE_OPLIB_INIT(PARROT_INTERP, long init);
  opcode_t * Parrot_find_lex_i_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_lex_n_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_lex_n_sc(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_p_s_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_p_sc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_s_s_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_s_sc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_i_s_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_i_sc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_n_s_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_find_lex_slot_n_sc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_p_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_s_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_s_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_sc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_sc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_i_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_i_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_ic_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_ic_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_n_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_n_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_s_nc_ic_ic(opcode_t *, PARROT_INTERP);
+ opcode_t * Parrot_store_lex_slot_sc_nc_ic_ic(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_dynamic_lex_p_s(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_dynamic_lex_p_sc(opcode_t *, PARROT_INTERP);
  opcode_t * Parrot_find_caller_lex_p_s(opcode_t *, PARROT_INTERP);
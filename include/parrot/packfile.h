@@ -231,6 +231,9 @@ typedef struct PackFile_Debug {
     opcode_t                num_mappings;
     PackFile_DebugFilenameMapping *mappings;
     PackFile_ByteCode      *code;   /* where this segment belongs to */
+    opcode_t               *op_offsets;     /* code offset of each op, ascending */
+    opcode_t                num_op_offsets; /* ops indexed; 0 until first lookup */
+    size_t                  indexed_size;   /* code size op_offsets was built for */
 } PackFile_Debug;
 
 #define ANN_ENTRY_OFF 0
@@ -579,6 +582,17 @@ void Parrot_debug_add_mapping(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*debug);
 
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+const opcode_t * Parrot_debug_get_op_offsets(PARROT_INTERP,
+    ARGMOD(PackFile_Debug *debug),
+    ARGOUT(opcode_t *count))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*debug)
+        FUNC_MODIFIES(*count);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
@@ -588,6 +602,15 @@ STRING * Parrot_debug_pc_to_filename(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_debug_pc_to_line(PARROT_INTERP,
+    ARGMOD(PackFile_Debug *debug),
+    opcode_t pc)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*debug);
+
 PARROT_EXPORT
 void Parrot_load_bytecode(PARROT_INTERP,
     ARGIN_NULLOK(Parrot_String file_str))
@@ -607,6 +630,26 @@ PackFile_Debug * Parrot_new_debug_seg(PARROT_INTERP,
         __attribute__nonnull__(2)
         FUNC_MODIFIES(*cs);
 
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_pf_annotations_find_key(PARROT_INTERP,
+    ARGIN(const PackFile_Annotations *self),
+    ARGIN(STRING *name))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+PARROT_EXPORT
+opcode_t Parrot_pf_annotations_range(
+    ARGIN(const PackFile_Annotations *self),
+    INTVAL key_id,
+    opcode_t start,
+    opcode_t end,
+    ARGOUT(opcode_t *first))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(5)
+        FUNC_MODIFIES(*first);
+
 PARROT_EXPORT
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
@@ -832,9 +875,16 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(debug) \
     , PARROT_ASSERT_ARG(filename))
+#define ASSERT_ARGS_Parrot_debug_get_op_offsets __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(debug) \
+    , PARROT_ASSERT_ARG(count))
 #define ASSERT_ARGS_Parrot_debug_pc_to_filename __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(debug))
+#define ASSERT_ARGS_Parrot_debug_pc_to_line __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(debug))
 #define ASSERT_ARGS_Parrot_load_bytecode __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_load_language __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -842,6 +892,14 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
 #define ASSERT_ARGS_Parrot_new_debug_seg __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(cs))
+#define ASSERT_ARGS_Parrot_pf_annotations_find_key \
+     __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(name))
+#define ASSERT_ARGS_Parrot_pf_annotations_range __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(first))
 #define ASSERT_ARGS_Parrot_pf_create_default_segments \
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
@@ -940,6 +998,46 @@ void Parrot_pf_mark_packfile(PARROT_INTERP, ARGMOD_NULLOK(PackFile * pf))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/packfile/api.c */
 
+/* HEADERIZER BEGIN: src/packfile/cache.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL Parrot_pf_cache_enabled(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC * Parrot_pf_cache_find(PARROT_INTERP,
+    ARGIN(STRING *id),
+    ARGIN_NULLOK(STRING *path),
+    ARGOUT_NULLOK(STRING **state))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*state);
+
+PARROT_EXPORT
+void Parrot_pf_cache_store(PARROT_INTERP,
+    ARGIN(STRING *id),
+    ARGIN(PMC *pf_pmc),
+    ARGIN_NULLOK(STRING *state))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_Parrot_pf_cache_enabled __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_Parrot_pf_cache_find __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(id))
+#define ASSERT_ARGS_Parrot_pf_cache_store __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(id) \
+    , PARROT_ASSERT_ARG(pf_pmc))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/packfile/cache.c */
+
 /* HEADERIZER BEGIN: src/packfile/output.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
@@ -371,6 +371,7 @@ size_t Parrot_str_platform_strlen(PARROT_INTERP, const char *s);
 #ifdef PARROT_HAS_SOME_SYS_TIMER
 
 void * new_sys_timer_ms(void);
+void * new_sys_cpu_timer_ms(void);
 void start_sys_timer_ms(void *handle, int ms);
 void stop_sys_timer_ms(void *handle);
 int get_sys_timer_ms(void *handle);
@@ -378,6 +379,7 @@ int get_sys_timer_ms(void *handle);
 #else
 
 #  define new_sys_timer_ms() NULL
+#  define new_sys_cpu_timer_ms() NULL
 #  define start_sys_timer_ms(h, m)
 #  define stop_sys_timer_ms(h)
 #  define get_sys_timer_ms(h) 0
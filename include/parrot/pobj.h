@@ -201,7 +201,9 @@ typedef enum PObj_enum {
     /* True if the PMC is a class */
     PObj_is_class_FLAG          = POBJ_FLAG(29),
     /* True if the PMC is a parrot object */
-    PObj_is_object_FLAG         = POBJ_FLAG(30)
+    PObj_is_object_FLAG         = POBJ_FLAG(30),
+    /* True if the PMC is sealed read-only shared data */
+    PObj_is_sealed_FLAG         = POBJ_FLAG(31)
 
 } PObj_flags;
 #undef POBJ_FLAG
@@ -289,6 +291,9 @@ typedef enum PObj_enum {
 #define PObj_is_object_TEST(o) PObj_flag_TEST(is_object, o)
 #define PObj_is_object_CLEAR(o) PObj_flag_CLEAR(is_object, o)
 
+#define PObj_is_sealed_SET(o) PObj_flag_SET(is_sealed, o)
+#define PObj_is_sealed_TEST(o) PObj_flag_TEST(is_sealed, o)
+
 #define PObj_is_PMC_TEST(o) PObj_flag_TEST(is_PMC, o)
 
 #define PObj_is_PMC_shared_TEST(o) PObj_flag_TEST(is_PMC_shared, o)
@@ -0,0 +1,94 @@
+/* runcore_sampling.h
+ *  Copyright (C) 2012, Parrot Foundation.
+ *  Overview:
+ *     Data structures for the sampling profiler runcore.
+ */
+
+#ifndef PARROT_RUNCORE_SAMPLING_H_GUARD
+#define PARROT_RUNCORE_SAMPLING_H_GUARD
+
+#include "parrot/parrot.h"
+#include "parrot/runcore_api.h"
+
+typedef struct sample_node sample_node;
+typedef struct sampling_data sampling_data;
+typedef struct sampling_runcore_t Parrot_sampling_runcore_t;
+
+typedef enum Parrot_sampling_output {
+    SAMPLING_OUTPUT_FOLDED,     /* one "outer;inner count" line per stack */
+    SAMPLING_OUTPUT_PPROF       /* the profiling runcore's format */
+} Parrot_sampling_output;
+
+/* one frame of the sampled call tree; the root node has no sub */
+struct sample_node {
+    /* the sub running in this frame and where it was */
+    PMC         *sub;
+    opcode_t    *pc;
+    /* samples taken with this frame on top of the stack */
+    UINTVAL      self;
+    sample_node *parent;
+    /* first frame called from here, and the next frame called from parent */
+    sample_node *child;
+    sample_node *sibling;
+};
+
+struct sampling_data {
+    /* the interpreter we're sampling */
+    Interp       *interp;
+    /* the call tree every sample is folded into */
+    sample_node   root;
+    UINTVAL       nodes;
+    UINTVAL       samples;
+    /* the subs the tree refers to, registered with the GC */
+    PMC          *markpmcs;
+    Hash         *seen_subs;
+
+    /* scratch space for the contexts being sampled, innermost first */
+    PMC         **stack;
+    UINTVAL       stack_size;
+
+    /* the tick count last seen by the runloop */
+    UINTVAL       last_tick;
+    /* fallback clock polling, for platforms without an interval timer */
+    UHUGEINTVAL   next_sample;
+    UINTVAL       countdown;
+
+    /* sampling interval in milliseconds */
+    INTVAL        interval;
+    void         *timer;
+    Parrot_sampling_output output;
+    STRING       *filename;
+    FILE         *out;
+};
+
+struct sampling_runcore_t {
+    STRING                      *name;
+    int                          id;
+    oplib_init_f                 opinit;
+    Parrot_runcore_runops_fn_t   runops;
+    Parrot_runcore_destroy_fn_t  destroy;
+    Parrot_runcore_prepare_fn_t  prepare_run;
+    INTVAL                       flags;
+
+    sampling_data               *sdata;
+};
+
+/* HEADERIZER BEGIN: src/runcore/sampling.c */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+void Parrot_runcore_sampling_init(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+#define ASSERT_ARGS_Parrot_runcore_sampling_init __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: src/runcore/sampling.c */
+
+#endif /* PARROT_RUNCORE_SAMPLING_H_GUARD */
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
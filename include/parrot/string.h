@@ -73,6 +73,16 @@
 
 typedef struct parrot_string_t STRING;
 
+/* STRING specific FLAGs */
+typedef enum {
+    /* STRING is the canonical copy in the interpreter's intern table */
+    STRING_interned_FLAG    = PObj_private0_FLAG
+} STRING_flags;
+
+#define STRING_interned_TEST(s)  PObj_flag_TEST(private0, (s))
+#define STRING_interned_SET(s)   PObj_flag_SET(private0, (s))
+#define STRING_interned_CLEAR(s) PObj_flag_CLEAR(private0, (s))
+
 /* String iterator */
 typedef struct string_iterator_t {
     UINTVAL bytepos;
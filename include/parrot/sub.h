@@ -19,6 +19,8 @@ typedef enum {
     SUB_FLAG_C_HANDLER    = PObj_private0_FLAG, /* C exceptions only */
     SUB_FLAG_TAILCALL     = PObj_private2_FLAG,
     SUB_FLAG_GENERATOR    = PObj_private3_FLAG, /* unused old python pmcs */
+    SUB_FLAG_EH_RECYCLE   = PObj_private1_FLAG, /* push_eh LABEL handler only its
+                                                   context knows about */
 
     /* compile/loadtime usage flags */
     /* from packfile */
@@ -183,6 +185,24 @@ STRING* Parrot_sub_Context_infostr(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_EXPORT
+int Parrot_sub_frame_get_info(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *subpmc),
+    ARGIN_NULLOK(opcode_t *pc),
+    ARGOUT(Parrot_Context_info *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*info);
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+STRING* Parrot_sub_frame_infostr(PARROT_INTERP,
+    ARGIN_NULLOK(PMC *subpmc),
+    ARGIN_NULLOK(opcode_t *pc),
+    int is_top)
+        __attribute__nonnull__(1);
+
 PARROT_EXPORT
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
@@ -214,6 +234,14 @@ PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC* Parrot_sub_find_lex_slot_ctx(PARROT_INTERP,
+    ARGIN(PMC *ctx),
+    INTVAL depth)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 PARROT_CAN_RETURN_NULL
 PARROT_WARN_UNUSED_RESULT
 PMC* Parrot_sub_find_pad(PARROT_INTERP,
@@ -248,6 +276,11 @@ INTVAL Parrot_sub_get_line_from_pc(PARROT_INTERP,
 #define ASSERT_ARGS_Parrot_sub_Context_infostr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_sub_frame_get_info __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_Parrot_sub_frame_infostr __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_sub_full_sub_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_Parrot_sub_new_closure __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -264,6 +297,9 @@ INTVAL Parrot_sub_get_line_from_pc(PARROT_INTERP,
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_Parrot_sub_find_lex_slot_ctx __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ctx))
 #define ASSERT_ARGS_Parrot_sub_find_pad __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(lex_name) \
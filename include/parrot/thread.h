@@ -114,6 +114,11 @@ VAR_SCOPE Shared_gc_info *shared_gc_info;
 /* HEADERIZER BEGIN: src/thread.c */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_EXPORT
+void Parrot_thread_seal(PARROT_INTERP, ARGIN(PMC *pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
 void Parrot_clone_code(Parrot_Interp d, Parrot_Interp s);
 int Parrot_get_num_threads(PARROT_INTERP);
 int Parrot_set_num_threads(PARROT_INTERP, INTVAL number_of_threads);
@@ -197,6 +202,9 @@ PMC * Parrot_thread_transfer_sub(
 void Parrot_thread_wait_for_notification(PARROT_INTERP)
         __attribute__nonnull__(1);
 
+#define ASSERT_ARGS_Parrot_thread_seal __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pmc))
 #define ASSERT_ARGS_Parrot_clone_code __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_get_num_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
 #define ASSERT_ARGS_Parrot_set_num_threads __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
@@ -249,6 +257,9 @@ void Parrot_thread_wait_for_notification(PARROT_INTERP)
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: src/thread.c */
 
+/* true for PMCs living in the shared read-only heap, see Parrot_thread_seal */
+#define Parrot_thread_is_sealed(pmc) PObj_is_sealed_TEST(pmc)
+
 #define Parrot_thread_maybe_create_proxy(i, thread, pmc) ( \
         (pmc)->vtable->base_type == enum_class_Proxy \
         ? (PARROT_PROXY(pmc)->interp == (thread) ? PARROT_PROXY(pmc)->target : (pmc)) \
@@ -11,7 +11,9 @@ Use the C<_json> method to generate a JSON representation of a PMC.
  load_bytecode 'JSON.pir'
  $S0 = _json( $P0 )
 
-To generate a PMC from a JSON string, see L<compilers/data_json>.
+To generate a PMC from a JSON string, see L<compilers/data_json>. Its
+C<encode> method, from the C<JSONCodec> PMC, writes the same text as C<_json>
+several times faster, but escapes strings as JSON rather than PIR does.
 
 =cut
 
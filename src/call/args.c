@@ -24,6 +24,7 @@ passing to and from subroutines following the Parrot Calling Conventions.
 #include "pmc/pmc_key.h"
 #include "pmc/pmc_fixedintegerarray.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_sub.h"
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -85,6 +86,16 @@ static void extract_named_arg_from_op(PARROT_INTERP,
         __attribute__nonnull__(5)
         FUNC_MODIFIES(*call_object);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL fill_bound_params(PARROT_INTERP,
+    ARGIN(PMC *call_object),
+    ARGIN(PMC *raw_sig),
+    ARGIN(opcode_t *raw_params))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 static void fill_params(PARROT_INTERP,
     ARGMOD_NULLOK(PMC *call_object),
     ARGIN(PMC *raw_sig),
@@ -209,6 +220,14 @@ static void set_call_from_varargs(PARROT_INTERP,
         __attribute__nonnull__(4)
         FUNC_MODIFIES(*args);
 
+PARROT_WARN_UNUSED_RESULT
+static INTVAL signatures_bind_directly(PARROT_INTERP,
+    ARGIN(PMC *arg_sig),
+    ARGIN(PMC *param_sig))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* string_constant_from_op(PARROT_INTERP,
@@ -253,6 +272,11 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(name) \
     , PARROT_ASSERT_ARG(raw_sig) \
     , PARROT_ASSERT_ARG(raw_args))
+#define ASSERT_ARGS_fill_bound_params __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(call_object) \
+    , PARROT_ASSERT_ARG(raw_sig) \
+    , PARROT_ASSERT_ARG(raw_params))
 #define ASSERT_ARGS_fill_params __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_sig) \
@@ -299,6 +323,10 @@ static STRING** string_param_from_op(PARROT_INTERP,
     , PARROT_ASSERT_ARG(signature) \
     , PARROT_ASSERT_ARG(sig) \
     , PARROT_ASSERT_ARG(args))
+#define ASSERT_ARGS_signatures_bind_directly __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(arg_sig) \
+    , PARROT_ASSERT_ARG(param_sig))
 #define ASSERT_ARGS_string_constant_from_op __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(raw_params))
@@ -340,7 +368,7 @@ Parrot_pcc_build_sig_object_from_op(PARROT_INTERP, ARGIN_NULLOK(PMC *signature),
     INTVAL          arg_named_count = 0;
 
     if (PMC_IS_NULL(signature))
-        call_object = Parrot_pmc_new(interp, enum_class_CallContext);
+        call_object = Parrot_pcc_allocate_call_context(interp);
     else {
         call_object = signature;
         VTABLE_morph(interp, call_object, PMCNULL);
@@ -850,6 +878,8 @@ fill_params(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
     else {
         const INTVAL second_flag = raw_params[param_count - 1];
         if (second_flag & PARROT_ARG_CALL_SIG) {
+            /* the frame is now visible to user code; never recycle it */
+            Parrot_pcc_mark_context_escaped(interp, call_object);
             *accessor->pmc(interp, arg_info, param_count - 1) = call_object ? call_object : PMCNULL;
             if (param_count == 1)
                 return;
@@ -1288,6 +1318,157 @@ assign_default_param_value(PARROT_INTERP, INTVAL param_index, INTVAL param_flags
 
 /*
 
+=item C<static INTVAL signatures_bind_directly(PARROT_INTERP, PMC *arg_sig, PMC
+*param_sig)>
+
+Returns true if arguments passed with the call-site signature C<arg_sig> can
+be copied one by one into parameters declared with C<param_sig>: both must
+have the same length, contain only plain positionals (no :flat, :slurpy,
+:optional, :named or :call_sig) and agree on the register type of each entry.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+signatures_bind_directly(PARROT_INTERP, ARGIN(PMC *arg_sig), ARGIN(PMC *param_sig))
+{
+    ASSERT_ARGS(signatures_bind_directly)
+    static const INTVAL plain_arg   = PARROT_ARG_TYPE_MASK
+                                    | PARROT_ARG_CONSTANT
+                                    | PARROT_ARG_INVOCANT;
+    static const INTVAL plain_param = PARROT_ARG_TYPE_MASK
+                                    | PARROT_ARG_INVOCANT;
+    INTVAL *arg_flags, *param_flags;
+    INTVAL  arg_count, param_count, i;
+
+    if (arg_sig->vtable->base_type != enum_class_FixedIntegerArray)
+        return 0;
+
+    GETATTR_FixedIntegerArray_size(interp, arg_sig, arg_count);
+    GETATTR_FixedIntegerArray_size(interp, param_sig, param_count);
+
+    if (arg_count != param_count)
+        return 0;
+
+    GETATTR_FixedIntegerArray_int_array(interp, arg_sig, arg_flags);
+    GETATTR_FixedIntegerArray_int_array(interp, param_sig, param_flags);
+
+    for (i = 0; i < arg_count; ++i) {
+        if (arg_flags[i] & ~plain_arg
+        ||  param_flags[i] & ~plain_param
+        ||  PARROT_ARG_TYPE_MASK_MASK(arg_flags[i])
+                != PARROT_ARG_TYPE_MASK_MASK(param_flags[i]))
+            return 0;
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static INTVAL fill_bound_params(PARROT_INTERP, PMC *call_object, PMC
+*raw_sig, opcode_t *raw_params)>
+
+Fast path of C<get_params> at the entry of a Sub.  Each Sub remembers the last
+call-site signature found to bind directly to its parameters (see
+C<signatures_bind_directly>); a call made with that signature just copies the
+positional argument cells into the parameter registers, without interpreting
+either signature again or going through the CallContext vtable.
+
+Returns false, having filled nothing reliable, if the call doesn't qualify;
+the caller then falls back to C<fill_params>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+fill_bound_params(PARROT_INTERP, ARGIN(PMC *call_object),
+        ARGIN(PMC *raw_sig), ARGIN(opcode_t *raw_params))
+{
+    ASSERT_ARGS(fill_bound_params)
+    PMC * const ctx     = CURRENT_CONTEXT(interp);
+    PMC * const sub_pmc = Parrot_pcc_get_sub(interp, ctx);
+    Parrot_Sub_attributes *sub;
+    PMC      *arg_sig;
+    Pcc_cell *cells;
+    Hash     *named;
+    INTVAL   *param_flags;
+    INTVAL    param_count, positional_count, i;
+
+    if (PMC_IS_NULL(sub_pmc) || sub_pmc->vtable->base_type != enum_class_Sub)
+        return 0;
+
+    PMC_get_sub(interp, sub_pmc, sub);
+
+    /* the binding is cached per Sub, so only its entry get_params qualifies */
+    if (raw_params != sub->seg->base.data + sub->start_offs)
+        return 0;
+
+    GETATTR_CallContext_arg_flags(interp, call_object, arg_sig);
+
+    if (PMC_IS_NULL(arg_sig))
+        return 0;
+
+    if (arg_sig != sub->bound_args_sig) {
+        if (!PObj_constant_TEST(arg_sig)
+        ||  !signatures_bind_directly(interp, arg_sig, raw_sig))
+            return 0;
+
+        /* both signatures are constants, so this needs no write barrier */
+        sub->bound_args_sig = arg_sig;
+    }
+
+    GETATTR_FixedIntegerArray_size(interp, raw_sig, param_count);
+    GETATTR_CallContext_num_positionals(interp, call_object, positional_count);
+    GETATTR_CallContext_hash(interp, call_object, named);
+
+    if (positional_count != param_count || (named && named->entries))
+        return 0;
+
+    GETATTR_CallContext_positionals(interp, call_object, cells);
+    GETATTR_FixedIntegerArray_int_array(interp, raw_sig, param_flags);
+
+    /* cells normally have the types the call-site signature promised, but
+     * the CallContext may have been filled by other means; check them */
+    for (i = 0; i < param_count; ++i) {
+        const Pcc_cell * const cell = &cells[i];
+        const INTVAL           reg  = raw_params[i + 2];
+
+        switch (PARROT_ARG_TYPE_MASK_MASK(param_flags[i])) {
+          case PARROT_ARG_INTVAL:
+            if (CELL_TYPE_MASK(cell) != INTCELL)
+                return 0;
+            CTX_REG_INT(interp, ctx, reg) = CELL_INT(cell);
+            break;
+          case PARROT_ARG_FLOATVAL:
+            if (CELL_TYPE_MASK(cell) != FLOATCELL)
+                return 0;
+            CTX_REG_NUM(interp, ctx, reg) = CELL_FLOAT(cell);
+            break;
+          case PARROT_ARG_STRING:
+            if (CELL_TYPE_MASK(cell) != STRINGCELL)
+                return 0;
+            CTX_REG_STR(interp, ctx, reg) = CELL_STRING(cell);
+            break;
+          case PARROT_ARG_PMC:
+            if (CELL_TYPE_MASK(cell) != PMCCELL)
+                return 0;
+            CTX_REG_PMC(interp, ctx, reg) = CELL_PMC(cell);
+            break;
+          default:
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
 =item C<void Parrot_pcc_fill_params_from_op(PARROT_INTERP, PMC *call_object, PMC
 *raw_sig, opcode_t *raw_params, Errors_classes direction)>
 
@@ -1322,6 +1503,11 @@ Parrot_pcc_fill_params_from_op(PARROT_INTERP, ARGMOD_NULLOK(PMC *call_object),
         (pmc_func_t)pmc_constant_from_op,
     };
 
+    if (direction == PARROT_ERRORS_PARAM_COUNT_FLAG
+    &&  call_object
+    &&  fill_bound_params(interp, call_object, raw_sig, raw_params))
+        return;
+
     fill_params(interp, call_object, raw_sig, raw_params, &function_pointers, direction);
 }
 
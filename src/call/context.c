@@ -63,6 +63,11 @@ an available context is stored corresponds to the size of the context.
         / SLOT_CHUNK_SIZE) * SLOT_CHUNK_SIZE)
 #define CALCULATE_SLOT_NUM(size) ((size) / SLOT_CHUNK_SIZE)
 
+/* Upper bound of returned frames kept for reuse by
+ * Parrot_pcc_allocate_call_context. Deep recursion unwinding past it leaves
+ * the remaining frames to the GC. */
+#define CTX_POOL_SIZE 64
+
 
 /* HEADERIZER HFILE: include/parrot/call.h */
 
@@ -252,6 +257,7 @@ init_context(ARGMOD(PMC *pmcctx), ARGIN_NULLOK(PMC *pmcold))
     ctx->outer_ctx         = NULL;
     ctx->current_cont      = NULL;
     ctx->handlers          = PMCNULL;
+    ctx->spare_handler     = PMCNULL;
     ctx->caller_ctx        = NULL;
     ctx->current_sig       = PMCNULL;
     ctx->current_sub       = PMCNULL;
@@ -616,6 +622,156 @@ Parrot_set_new_context(PARROT_INTERP, ARGIN(const UINTVAL *number_regs_used))
     return ctx;
 }
 
+/*
+
+=item C<PMC * Parrot_pcc_allocate_call_context(PARROT_INTERP)>
+
+Returns an empty CallContext for a new call, taking one from the pool of
+recycled frames if possible.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_pcc_allocate_call_context(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_allocate_call_context)
+    PMC * const ctx = interp->ctx_pool;
+
+    if (PMC_IS_NULL(ctx))
+        return Parrot_pmc_new(interp, enum_class_CallContext);
+
+    interp->ctx_pool = CONTEXT_STRUCT(ctx)->caller_ctx;
+    --interp->ctx_pool_size;
+
+    CONTEXT_STRUCT(ctx)->caller_ctx = NULL;
+    return ctx;
+}
+
+
+/*
+
+=item C<void Parrot_pcc_recycle_context(PARROT_INTERP, PMC *ctx)>
+
+Returns the frame of a plain Sub which has just returned to the pool used by
+C<Parrot_pcc_allocate_call_context>.  Its registers go back to the fixed-size
+allocator immediately instead of waiting for the GC to destroy the context.
+
+Only frames flagged recyclable by C<Sub.invoke> and never seen by
+C<Parrot_pcc_mark_context_escaped> qualify; everything else is left to the GC.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_recycle_context(PARROT_INTERP, ARGIN(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_recycle_context)
+    Parrot_Context * const c = CONTEXT_STRUCT(ctx);
+
+    if (!CTX_recyclable_TEST(ctx) || CTX_escaped_TEST(ctx))
+        return;
+
+    CTX_recyclable_CLEAR(ctx);
+
+    if (interp->ctx_pool_size >= CTX_POOL_SIZE)
+        return;
+
+    VTABLE_morph(interp, ctx, PMCNULL);
+
+    Parrot_pcc_free_registers(interp, ctx);
+    c->registers                = NULL;
+    c->n_regs_used[REGNO_INT]   = 0;
+    c->n_regs_used[REGNO_NUM]   = 0;
+    c->n_regs_used[REGNO_STR]   = 0;
+    c->n_regs_used[REGNO_PMC]   = 0;
+
+    PARROT_GC_WRITE_BARRIER(interp, ctx);
+    c->lex_pad           = PMCNULL;
+    c->outer_ctx         = NULL;
+    c->current_sub       = PMCNULL;
+    c->handlers          = PMCNULL;
+    c->current_cont      = NULL;
+    c->current_namespace = PMCNULL;
+    c->current_sig       = PMCNULL;
+    c->continuation      = PMCNULL;
+    c->spare_handler     = PMCNULL;
+
+    /* the pool is chained through caller_ctx, so marking its head keeps
+     * every pooled context alive */
+    c->caller_ctx        = interp->ctx_pool;
+    interp->ctx_pool     = ctx;
+    ++interp->ctx_pool_size;
+}
+
+
+/*
+
+=item C<void Parrot_pcc_finish_tailcall(PARROT_INTERP, PMC *ctx)>
+
+Completes a tail call once the callee C<ctx> has bound its parameters.  The
+tail-calling frame is unlinked, so C<ctx> returns straight to its caller's
+caller at the same recursion depth.
+
+When that frame was also the signature its own caller is waiting on, C<ctx>
+takes over that role and the tail-calling frame goes back to the pool right
+away.  A chain of tail calls (including self-recursion) then alternates
+between two pooled frames instead of allocating one per call.
+
+=cut
+
+*/
+
+void
+Parrot_pcc_finish_tailcall(PARROT_INTERP, ARGIN(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_finish_tailcall)
+    PMC * const tailcaller = Parrot_pcc_get_caller_ctx(interp, ctx);
+    PMC * const caller     = Parrot_pcc_get_caller_ctx(interp, tailcaller);
+
+    Parrot_pcc_dec_recursion_depth(interp, ctx);
+    Parrot_pcc_set_caller_ctx(interp, ctx, caller);
+
+    if (tailcaller == ctx || PMC_IS_NULL(caller)
+    ||  Parrot_pcc_get_signature(interp, caller) != tailcaller
+    ||  !CTX_recyclable_TEST(tailcaller) || CTX_escaped_TEST(tailcaller))
+        return;
+
+    Parrot_pcc_set_signature(interp, caller, ctx);
+    Parrot_pcc_recycle_context(interp, tailcaller);
+}
+
+
+/*
+
+=item C<void Parrot_pcc_mark_context_escaped(PARROT_INTERP, PMC *ctx)>
+
+Records that C<ctx> may be referenced after it returns (it was captured by a
+continuation, exposed to user code, noted as an exception thrower, ...).
+Since a captured frame can resume into its callers, the whole caller chain is
+marked too.  Marking stops at the first frame already escaped, which keeps the
+walk cheap: every caller of an escaped frame is escaped as well.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pcc_mark_context_escaped(SHIM_INTERP, ARGIN_NULLOK(PMC *ctx))
+{
+    ASSERT_ARGS(Parrot_pcc_mark_context_escaped)
+
+    while (!PMC_IS_NULL(ctx) && !CTX_escaped_TEST(ctx)) {
+        CTX_escaped_SET(ctx);
+        ctx = CONTEXT_STRUCT(ctx)->caller_ctx;
+    }
+}
+
 
 /*
 
@@ -860,11 +1016,53 @@ Parrot_pcc_set_context_func(PARROT_INTERP, ARGIN(PMC *ctx))
 
 /*
 
+=item C<PMC * Parrot_pcc_new_return_continuation(PARROT_INTERP)>
+
+Creates the return continuation for a call made from the current context.
+
+Unlike a user-created Continuation (see C<Continuation.init>) it doesn't mark
+the current context as escaped: it is only reachable from the callee's
+frame, which exposes it to user code only through paths that mark the frame
+themselves.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_pcc_new_return_continuation(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pcc_new_return_continuation)
+    PMC * const ctx  = CURRENT_CONTEXT(interp);
+    PMC * const cont = Parrot_pmc_new_noinit(interp, enum_class_Continuation);
+    Parrot_Continuation_attributes * const cc = PARROT_CONTINUATION(cont);
+
+    cc->to_ctx         = ctx;
+    cc->to_call_object = Parrot_pcc_get_signature(interp, ctx);
+    cc->from_ctx       = ctx;
+    cc->runloop_id     = 0;
+    cc->invoked        = 0;
+    cc->seg            = interp->code;
+    cc->address        = NULL;
+
+    PObj_custom_mark_SET(cont);
+    return cont;
+}
+
+/*
+
 =item C<void Parrot_pcc_reuse_continuation(PARROT_INTERP, PMC *call_context,
 opcode_t *next)>
 
 Try to reuse old Continuation for subsequent calls from same CallContext.
 
+The old one is reused only once it has been invoked (the previous call
+returned), it wasn't handed on by a tailcall, and nothing can still refer to
+it: a frame that exposed its return continuation is marked escaped.
+
 =cut
 
 */
@@ -881,12 +1079,22 @@ Parrot_pcc_reuse_continuation(PARROT_INTERP, ARGIN(PMC *call_context), ARGIN_NUL
         PMC * const cont = c->continuation;
         INTVAL   invoked;
         GETATTR_Continuation_invoked(interp, cont, invoked);
-        /* Reuse if invoked. And not tailcalled? */
-        reuse = invoked && !(PObj_get_FLAGS(cont) |= SUB_FLAG_TAILCALL);
+        reuse = invoked
+            && !(PObj_get_FLAGS(cont) & SUB_FLAG_TAILCALL)
+            && !CTX_escaped_TEST(call_context);
     }
 
-    if (!reuse) {
-        c->continuation = Parrot_pmc_new(interp, enum_class_Continuation);
+    if (reuse) {
+        Parrot_Continuation_attributes * const cc = PARROT_CONTINUATION(c->continuation);
+        PARROT_GC_WRITE_BARRIER(interp, c->continuation);
+        cc->to_call_object = Parrot_pcc_get_signature(interp, call_context);
+        cc->from_ctx       = call_context;
+        cc->seg            = interp->code;
+        cc->invoked        = 0;
+    }
+    else {
+        c->continuation = Parrot_pcc_new_return_continuation(interp);
+        PARROT_GC_WRITE_BARRIER(interp, call_context);
     }
 
     VTABLE_set_pointer(interp, c->continuation, next);
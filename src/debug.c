@@ -31,6 +31,7 @@ the Parrot debugger, and the C<debug> ops.
 #include "pmc/pmc_continuation.h"
 #include "pmc/pmc_callcontext.h"
 #include "pmc/pmc_sub.h"
+#include "pmc/pmc_exception.h"
 #include "parrot/oplib/core_ops.h"
 
 /* Hand switched debugger tracing
@@ -232,6 +233,13 @@ static STRING * PDB_get_continuation_backtrace(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * PDB_get_frames_backtrace(PARROT_INTERP,
+    ARGIN_NULLOK(const Parrot_ex_frame *frames),
+    INTVAL count)
+        __attribute__nonnull__(1);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 PARROT_PURE_FUNCTION
@@ -344,6 +352,8 @@ static const char * skip_whitespace(ARGIN(const char *cmd))
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ctx))
+#define ASSERT_ARGS_PDB_get_frames_backtrace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_skip_whitespace __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(cmd))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
@@ -3575,8 +3585,19 @@ STRING *
 Parrot_dbg_get_exception_backtrace(PARROT_INTERP, ARGMOD(PMC * exception))
 {
     ASSERT_ARGS(Parrot_dbg_get_exception_backtrace)
+    PMC *ctx;
+
+    if (exception->vtable->base_type == enum_class_Exception) {
+        Parrot_ex_frame *frames;
+        INTVAL           frame_count;
 
-    PMC * const ctx = get_exception_context(interp, exception);
+        GETATTR_Exception_frames(interp, exception, frames);
+        GETATTR_Exception_frame_count(interp, exception, frame_count);
+        if (frames)
+            return PDB_get_frames_backtrace(interp, frames, frame_count);
+    }
+
+    ctx = get_exception_context(interp, exception);
 
     if (PMC_IS_NULL(ctx))
         return STRINGNULL;
@@ -3652,25 +3673,47 @@ static STRING *
 PDB_get_continuation_backtrace(PARROT_INTERP, ARGIN(PMC *ctx))
 {
     ASSERT_ARGS(PDB_get_continuation_backtrace)
+    INTVAL                 count;
+    Parrot_ex_frame * const frames = Parrot_ex_capture_frames(interp, ctx, NULL, &count);
+    STRING          * const bt     = PDB_get_frames_backtrace(interp, frames, count);
+
+    if (frames)
+        mem_gc_free(interp, frames);
+
+    return bt;
+}
+
+/*
+
+=item C<static STRING * PDB_get_frames_backtrace(PARROT_INTERP, const
+Parrot_ex_frame *frames, INTVAL count)>
+
+Returns a string with the backtrace for the given frames, most recent first.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+PDB_get_frames_backtrace(PARROT_INTERP, ARGIN_NULLOK(const Parrot_ex_frame *frames),
+        INTVAL count)
+{
+    ASSERT_ARGS(PDB_get_frames_backtrace)
     PMC * const output = Parrot_pmc_new(interp, enum_class_StringBuilder);
     UINTVAL rec_level  = 0;
-    UINTVAL loop_count = 0;
-    PMC    *prev_ctx   = PMCNULL;
-    int     is_top     = 1;
+    INTVAL  i;
 
-    /* backtrace: follow the continuation chain */
-    while (ctx && (loop_count < RECURSION_LIMIT)) {
-        STRING * const info_str = Parrot_sub_Context_infostr(interp, ctx, is_top);
+    for (i = 0; i < count; ++i) {
+        PMC      * const sub_pmc  = frames[i].sub;
+        opcode_t * const pc       = frames[i].pc;
+        STRING   * const info_str = Parrot_sub_frame_infostr(interp, sub_pmc, pc, i == 0);
         if (!info_str)
             break;
 
         /* recursion detection */
-        if (ctx == prev_ctx) {
-            ++rec_level;
-        }
-        else if (!PMC_IS_NULL(prev_ctx)
-        &&       Parrot_pcc_get_pc(interp,  ctx) == Parrot_pcc_get_pc(interp,  prev_ctx)
-        &&       Parrot_pcc_get_sub(interp, ctx) == Parrot_pcc_get_sub(interp, prev_ctx)) {
+        if (i > 0 && pc == frames[i - 1].pc && sub_pmc == frames[i - 1].sub) {
             ++rec_level;
         }
         else if (rec_level != 0) {
@@ -3682,12 +3725,11 @@ PDB_get_continuation_backtrace(PARROT_INTERP, ARGIN(PMC *ctx))
 
         /* print the context description */
         if (rec_level == 0) {
-            const PMC * const sub               = Parrot_pcc_get_sub(interp, ctx);
-            const PackFile_ByteCode * const seg = PARROT_SUB(sub)->seg;
+            const PackFile_ByteCode * const seg = PARROT_SUB(sub_pmc)->seg;
             VTABLE_push_string(interp, output, info_str);
             if (seg->annotations) {
                 PMC * const annot = PackFile_Annotations_lookup(interp, seg->annotations,
-                        Parrot_pcc_get_pc(interp, ctx) - seg->base.data,
+                        pc - seg->base.data,
                         NULL);
 
                 if (!PMC_IS_NULL(annot)) {
@@ -3706,10 +3748,6 @@ PDB_get_continuation_backtrace(PARROT_INTERP, ARGIN(PMC *ctx))
             }
             VTABLE_push_string(interp, output, CONST_STRING(interp, "\n"));
         }
-        ++loop_count;
-        is_top   = 0;
-        prev_ctx = ctx;
-        ctx      = Parrot_pcc_get_caller_ctx(interp, ctx);
     }
 
     if (rec_level != 0) {
@@ -201,6 +201,8 @@ Parrot_api_set_runcore(Parrot_PMC interp_pmc, ARGIN(const char * corename),
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "slow"));
         else if (STREQ(corename, "profiling"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "profiling"));
+        else if (STREQ(corename, "sampling"))
+            Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "sampling"));
         else if (STREQ(corename, "gcdebug"))
             Parrot_runcore_switch(interp, Parrot_str_new_constant(interp, "gcdebug"));
         else
@@ -22,6 +22,8 @@ to the appropriate handler asynchronously.
 
 #include "events.str"
 #include "pmc/pmc_arrayiterator.h"
+#include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_continuation.h"
 #include "pmc/pmc_exception.h"
 
 
@@ -54,9 +56,57 @@ Parrot_cx_add_handler_local(PARROT_INTERP, ARGIN(PMC *handler))
 
 /*
 
+=item C<void Parrot_cx_add_label_handler_local(PARROT_INTERP, opcode_t *addr)>
+
+Add an ExceptionHandler that resumes at C<addr> to the current context's list
+of handlers, as C<push_eh LABEL> does.
+
+If C<pop_eh> last removed a handler for the same label from this context, and
+that handler was never used to catch anything or handed out, it is reused
+instead of allocating a new one. A C<push_eh>/C<pop_eh> pair in a loop then
+allocates nothing while no exception is thrown.
+
+This is a partial step only. Entering a try block still links a handler into
+the dynamic list, and C<Parrot_cx_find_handler_local> still walks that list.
+imcc emits no static pc-range handler tables that a throw could search.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_cx_add_label_handler_local(PARROT_INTERP, ARGIN(opcode_t *addr))
+{
+    ASSERT_ARGS(Parrot_cx_add_label_handler_local)
+    PMC * const ctx = CURRENT_CONTEXT(interp);
+    PMC        *handler;
+
+    GETATTR_CallContext_spare_handler(interp, ctx, handler);
+
+    if (!PMC_IS_NULL(handler) && VTABLE_get_pointer(interp, handler) == addr) {
+        Parrot_Continuation_attributes * const cc = PARROT_CONTINUATION(handler);
+
+        SETATTR_CallContext_spare_handler(interp, ctx, PMCNULL);
+        PARROT_GC_WRITE_BARRIER(interp, handler);
+        cc->to_call_object = Parrot_pcc_get_signature(interp, ctx);
+        cc->seg            = interp->code;
+    }
+    else {
+        handler = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
+        SUB_FLAG_flag_SET(EH_RECYCLE, handler);
+    }
+
+    VTABLE_set_pointer(interp, handler, addr);
+    Parrot_cx_add_handler_local(interp, handler);
+}
+
+/*
+
 =item C<void Parrot_cx_delete_handler_local(PARROT_INTERP)>
 
-Remove the top task handler from the context's list of handlers.
+Remove the top task handler from the context's list of handlers. A handler
+made by C<Parrot_cx_add_label_handler_local> is kept for reuse.
 
 =cut
 
@@ -68,6 +118,7 @@ Parrot_cx_delete_handler_local(PARROT_INTERP)
 {
     ASSERT_ARGS(Parrot_cx_delete_handler_local)
     PMC *handlers  = Parrot_pcc_get_handlers(interp, interp->ctx);
+    PMC *handler;
 
     if (PMC_IS_NULL(handlers))
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
@@ -78,7 +129,15 @@ Parrot_cx_delete_handler_local(PARROT_INTERP)
         Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
             "No handler to delete.");
 
-    VTABLE_shift_pmc(interp, handlers);
+    handler = VTABLE_shift_pmc(interp, handlers);
+
+    if (handler->vtable->base_type == enum_class_ExceptionHandler
+    &&  SUB_FLAG_flag_TEST(EH_RECYCLE, handler)) {
+        /* not marked, like the reusable continuation; the barrier makes the
+         * next GC run visit the context and drop it */
+        SETATTR_CallContext_spare_handler(interp, interp->ctx, handler);
+        PARROT_GC_WRITE_BARRIER(interp, interp->ctx);
+    }
 }
 
 
@@ -356,6 +415,10 @@ Parrot_cx_find_handler_local(PARROT_INTERP, ARGIN(PMC *task))
                         "P->I", task, &valid_handler);
 
                 if (valid_handler) {
+                    /* the handler is now known outside its context */
+                    if (handler->vtable->base_type == enum_class_ExceptionHandler)
+                        SUB_FLAG_flag_CLEAR(EH_RECYCLE, handler);
+
                     if (is_exception) {
                         /* Store iterator and context for a later rethrow. */
                         VTABLE_set_pointer(interp, task, context);
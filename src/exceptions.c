@@ -38,6 +38,11 @@ static PMC * build_exception_from_args(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+static void note_thrower(PARROT_INTERP, ARGMOD(PMC *exception))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*exception);
+
 static void Parrot_ex_update_for_rethrow(PARROT_INTERP, ARGMOD(PMC * ex))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2)
@@ -51,6 +56,9 @@ static void setup_exception_args(PARROT_INTERP, ARGIN(const char *sig), ...)
 #define ASSERT_ARGS_build_exception_from_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(format))
+#define ASSERT_ARGS_note_thrower __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(exception))
 #define ASSERT_ARGS_Parrot_ex_update_for_rethrow __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(ex))
@@ -201,8 +209,7 @@ Parrot_ex_throw_from_op(PARROT_INTERP, ARGIN(PMC *exception), ARGIN_NULLOK(void
     opcode_t   *address;
     PMC        *handler;
 
-    /* Note the thrower. */
-    VTABLE_set_attr_str(interp, exception, CONST_STRING(interp, "thrower"), CURRENT_CONTEXT(interp));
+    note_thrower(interp, exception);
 
     /* Locate the handler, if there is one. */
     handler = Parrot_cx_find_handler_local(interp, exception);
@@ -348,9 +355,7 @@ Parrot_ex_throw_from_c(PARROT_INTERP, ARGIN(PMC *exception))
         PDB_backtrace(interp);
     }
 
-    /* Note the thrower.
-     * Don't split line. It will break CONST_STRING handling. */
-    VTABLE_set_attr_str(interp, exception, CONST_STRING(interp, "thrower"), CURRENT_CONTEXT(interp));
+    note_thrower(interp, exception);
 
     if (PMC_IS_NULL(handler))
         die_from_exception(interp, exception);
@@ -657,6 +662,79 @@ Parrot_print_backtrace(void)
 
 /*
 
+=item C<Parrot_ex_frame * Parrot_ex_capture_frames(PARROT_INTERP, PMC *ctx,
+Parrot_ex_frame *frames, INTVAL *count)>
+
+Records the sub and pc of C<ctx> and each of its callers into C<frames>,
+which is grown (or allocated, when NULL) to fit, and returns the array.  The
+number of frames recorded, at most C<RECURSION_LIMIT>, is stored in
+C<count>.  Nothing is symbolized here; see C<Parrot_sub_frame_get_info>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+Parrot_ex_frame *
+Parrot_ex_capture_frames(PARROT_INTERP, ARGIN_NULLOK(PMC *ctx),
+        ARGFREE(Parrot_ex_frame *frames), ARGOUT(INTVAL *count))
+{
+    ASSERT_ARGS(Parrot_ex_capture_frames)
+    PMC   *cur_ctx;
+    INTVAL n = 0;
+
+    for (cur_ctx = ctx; !PMC_IS_NULL(cur_ctx) && n < RECURSION_LIMIT;
+            cur_ctx = Parrot_pcc_get_caller_ctx(interp, cur_ctx))
+        ++n;
+
+    if (n)
+        frames = mem_gc_realloc_n_typed(interp, frames, n, Parrot_ex_frame);
+
+    *count = n;
+    for (n = 0, cur_ctx = ctx; n < *count;
+            ++n, cur_ctx = Parrot_pcc_get_caller_ctx(interp, cur_ctx)) {
+        frames[n].sub = Parrot_pcc_get_sub(interp, cur_ctx);
+        frames[n].pc  = Parrot_pcc_get_pc(interp, cur_ctx);
+    }
+
+    return frames;
+}
+
+/*
+
+=item C<static void note_thrower(PARROT_INTERP, PMC *exception)>
+
+Notes where C<exception> is being thrown from.  A plain Exception copies the
+caller chain into its frame array, so the contexts themselves stay free to
+be recycled once they return; anything else gets the current context as its
+C<thrower> attribute.
+
+=cut
+
+*/
+
+static void
+note_thrower(PARROT_INTERP, ARGMOD(PMC *exception))
+{
+    ASSERT_ARGS(note_thrower)
+
+    if (exception->vtable->base_type == enum_class_Exception) {
+        Parrot_ex_frame *frames;
+        INTVAL           count;
+
+        GETATTR_Exception_frames(interp, exception, frames);
+        frames = Parrot_ex_capture_frames(interp, CURRENT_CONTEXT(interp), frames, &count);
+        SETATTR_Exception_frames(interp, exception, frames);
+        SETATTR_Exception_frame_count(interp, exception, count);
+    }
+    else
+        VTABLE_set_attr_str(interp, exception, CONST_STRING(interp, "thrower"),
+                CURRENT_CONTEXT(interp));
+}
+
+/*
+
 =item C<static void Parrot_ex_update_for_rethrow(PARROT_INTERP, PMC * ex)>
 
 Update an exception PMC so that it can be rethrown.
@@ -223,6 +223,9 @@ mark_interp(PARROT_INTERP)
     Parrot_gc_mark_PMC_alive(interp, interp->cur_task);
     Parrot_gc_mark_PMC_alive(interp, CURRENT_CONTEXT(interp));
 
+    /* mark the recycled contexts waiting for reuse */
+    Parrot_gc_mark_PMC_alive(interp, interp->ctx_pool);
+
     /* mark the vtables: the data, Class PMCs, etc. */
     if (! Interp_flags_TEST(interp, PARROT_IS_THREAD))
         Parrot_vtbl_mark_vtables(interp);
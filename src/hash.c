@@ -302,6 +302,8 @@ hash_compare_string_enc(ARGIN(const void *search_key), ARGIN(const void *bucket_
         return 1;
     if (s1->encoding != s2->encoding)
         return 1;
+    if (s1->bufused != s2->bufused)
+        return 1;
     else
         return memcmp(s1->strstart, s2->strstart, s1->bufused);
 }
@@ -644,6 +646,7 @@ Parrot_hash_thaw(PARROT_INTERP, ARGMOD(PMC *info))
 
     for (entry_index = 0; entry_index < num_entries; ++entry_index) {
         void       *key;
+        void       *value;
 
         switch (key_type) {
           case Hash_key_type_int:
@@ -676,19 +679,19 @@ Parrot_hash_thaw(PARROT_INTERP, ARGMOD(PMC *info))
           case enum_hash_int:
             {
                 const INTVAL i = VTABLE_shift_integer(interp, info);
-                Parrot_hash_put(interp, hash, key, (void *)i);
+                value          = (void *)i;
                 break;
             }
           case enum_hash_string:
             {
                 STRING * const s = VTABLE_shift_string(interp, info);
-                Parrot_hash_put(interp, hash, key, (void *)s);
+                value            = (void *)s;
                 break;
             }
           case enum_hash_pmc:
             {
                 PMC * const p = VTABLE_shift_pmc(interp, info);
-                Parrot_hash_put(interp, hash, key, (void *)p);
+                value         = (void *)p;
                 break;
             }
           default:
@@ -696,6 +699,15 @@ Parrot_hash_thaw(PARROT_INTERP, ARGMOD(PMC *info))
                     "unimplemented value type %i", (int)entry_type);
             break;
         }
+
+        /* PMC keys aren't thawed yet, so they can't be hashed by value here;
+         * every other key goes straight into its bucket, as serialized
+         * hashes don't contain duplicates */
+        if (key_type == Hash_key_type_PMC)
+            Parrot_hash_put(interp, hash, key, value);
+        else
+            parrot_hash_store_value_in_bucket(interp, hash, NULL,
+                    key_hash(interp, hash, key), key, value);
     }
 
     return hash;
@@ -924,8 +936,10 @@ expand_hash(PARROT_INTERP, ARGMOD(Hash *hash))
             /* rehash the bucket */
             if (hash->key_type == Hash_key_type_STRING
             ||  hash->key_type == Hash_key_type_STRING_enc) {
-                STRING *s = (STRING *)bucket->key;
-                hashval   = s->hashval;
+                /* a key that doesn't cache its hash, like STRINGNULL, must
+                 * land where a lookup will hash it */
+                const STRING * const s = (const STRING *)bucket->key;
+                hashval = key_hash_STRING(interp, s, hash->seed);
             }
             else {
                 hashval = key_hash(interp, hash, bucket->key);
@@ -875,6 +875,52 @@ Parrot_io_read_byte_buffer_pmc(PARROT_INTERP, ARGMOD(PMC *handle),
     }
 }
 
+/*
+
+=item C<size_t Parrot_io_read_b(PARROT_INTERP, PMC *handle, void *buffer, size_t
+byte_length)>
+
+Reads up to C<byte_length> raw bytes from C<handle> into the memory pointed to
+by C<buffer>, and returns the number of bytes actually read. This is the
+counterpart of C<Parrot_io_write_b>: no string encoding is applied. Fewer bytes
+than requested may be returned; zero bytes means end of file.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+size_t
+Parrot_io_read_b(PARROT_INTERP, ARGMOD(PMC *handle), ARGOUT(void *buffer),
+        size_t byte_length)
+{
+    ASSERT_ARGS(Parrot_io_read_b)
+
+    if (PMC_IS_NULL(handle))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Attempt to read bytes from a null or invalid PMC");
+
+    if (!byte_length)
+        return 0;
+
+    {
+        const IO_VTABLE * const vtable = IO_GET_VTABLE(interp, handle);
+        IO_BUFFER * const read_buffer = IO_GET_READ_BUFFER(interp, handle);
+        IO_BUFFER * const write_buffer = IO_GET_WRITE_BUFFER(interp, handle);
+        size_t bytes_read;
+
+        io_verify_is_open_for(interp, handle, vtable, PIO_F_READ);
+        io_sync_buffers_for_read(interp, handle, vtable, read_buffer, write_buffer);
+        bytes_read = Parrot_io_buffer_read_b(interp, read_buffer, handle, vtable,
+                                             (char *)buffer, byte_length);
+        if (bytes_read == 0)
+            vtable->set_eof(interp, handle, 1);
+        vtable->adv_position(interp, handle, bytes_read);
+        return bytes_read;
+    }
+}
+
 INTVAL
 Parrot_io_write_byte_buffer_pmc(PARROT_INTERP, ARGMOD(PMC * handle),
         ARGMOD(PMC *buffer), size_t byte_length)
@@ -42,6 +42,16 @@ static STRING * cnv_to_win32_filesep(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Hash* get_resolved_paths(PARROT_INTERP,
+    enum_lib_paths which,
+    ARGIN(PMC *paths),
+    ARGIN(STRING *prefix))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC* get_search_paths(PARROT_INTERP, enum_lib_paths which)
@@ -52,6 +62,14 @@ static int is_abs_path(PARROT_INTERP, ARGIN(const STRING *file))
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+static int is_stable_resolution(PARROT_INTERP,
+    ARGIN(const STRING *file),
+    ARGIN(const STRING *found))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static STRING* path_concat(PARROT_INTERP,
@@ -68,6 +86,18 @@ static STRING* path_guarantee_trailing_separator(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING* search_runtime_file(PARROT_INTERP,
+    ARGIN(STRING *file),
+    ARGIN(PMC *paths),
+    ARGIN(STRING *prefix),
+    enum_runtime_ft type)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CAN_RETURN_NULL
 static STRING* try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
@@ -87,11 +117,19 @@ static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
 #define ASSERT_ARGS_cnv_to_win32_filesep __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_get_resolved_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(paths) \
+    , PARROT_ASSERT_ARG(prefix))
 #define ASSERT_ARGS_get_search_paths __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_is_abs_path __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(file))
+#define ASSERT_ARGS_is_stable_resolution __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(file) \
+    , PARROT_ASSERT_ARG(found))
 #define ASSERT_ARGS_path_concat __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(l_path) \
@@ -100,6 +138,11 @@ static STRING* try_load_path(PARROT_INTERP, ARGIN(STRING* path))
      __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_search_runtime_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(file) \
+    , PARROT_ASSERT_ARG(paths) \
+    , PARROT_ASSERT_ARG(prefix))
 #define ASSERT_ARGS_try_bytecode_extensions __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
@@ -662,10 +705,175 @@ try_bytecode_extensions(PARROT_INTERP, ARGIN(STRING* path))
 
 /*
 
+=item C<static STRING* search_runtime_file(PARROT_INTERP, STRING *file, PMC
+*paths, STRING *prefix, enum_runtime_ft type)>
+
+Searches C<paths> (and each relative path again below C<prefix>) for C<file>,
+then falls back to C<file> itself. Returns the first name that exists or NULL.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static STRING*
+search_runtime_file(PARROT_INTERP, ARGIN(STRING *file), ARGIN(PMC *paths),
+        ARGIN(STRING *prefix), enum_runtime_ft type)
+{
+    ASSERT_ARGS(search_runtime_file)
+    STRING      *full_name;
+    const INTVAL n = VTABLE_elements(interp, paths);
+    INTVAL       i;
+
+    for (i = 0; i < n; ++i) {
+        STRING * const path = VTABLE_get_string_keyed_int(interp, paths, i);
+        STRING *found_name;
+
+        full_name = path_concat(interp, path, file);
+
+        found_name =
+            (type & PARROT_RUNTIME_FT_DYNEXT)
+                ? try_load_path(interp, full_name)
+                : try_bytecode_extensions(interp, full_name);
+
+        if (found_name)
+            return found_name;
+
+        if (Parrot_str_length(interp, prefix) && !is_abs_path(interp, path)) {
+            full_name = path_concat(interp, prefix, full_name);
+
+            found_name =
+                (type & PARROT_RUNTIME_FT_DYNEXT)
+                    ? try_load_path(interp, full_name)
+                    : try_bytecode_extensions(interp, full_name);
+
+            if (found_name)
+                return found_name;
+        }
+    }
+
+    full_name =
+        (type & PARROT_RUNTIME_FT_DYNEXT)
+            ? try_load_path(interp, file)
+            : try_bytecode_extensions(interp, file);
+
+    return full_name;
+}
+
+/*
+
+=item C<static int is_stable_resolution(PARROT_INTERP, const STRING *file, const
+STRING *found)>
+
+Tells whether C<found>, the file located for the requested name C<file>, may
+be remembered.  It must be an absolute path, so that changing the working
+directory cannot change what it names, and it must end with C<file> itself
+rather than with a guessed extension, so that a preferred variant (say the
+F<.pbc> asked for, next to the F<.pir> found instead) created later is not
+hidden by the cache.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static int
+is_stable_resolution(PARROT_INTERP, ARGIN(const STRING *file),
+        ARGIN(const STRING *found))
+{
+    ASSERT_ARGS(is_stable_resolution)
+    const INTVAL file_len  = Parrot_str_length(interp, file);
+    const INTVAL found_len = Parrot_str_length(interp, found);
+
+    if (!is_abs_path(interp, found) || found_len < file_len)
+        return 0;
+
+    return STRING_equal(interp, file,
+            STRING_substr(interp, found, found_len - file_len, file_len));
+}
+
+/*
+
+=item C<static Hash* get_resolved_paths(PARROT_INTERP, enum_lib_paths which, PMC
+*paths, STRING *prefix)>
+
+Returns the cache of names already resolved against the search path C<which>,
+mapping each requested name to the file found for it.
+
+The cache keeps a copy of C<paths> and C<prefix> taken when it was created.
+If the search path or prefix has changed since then, the cache is replaced by
+an empty one. That also catches code that modifies the C<lib_paths> arrays
+directly instead of calling C<Parrot_lib_add_path>.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static Hash*
+get_resolved_paths(PARROT_INTERP, enum_lib_paths which, ARGIN(PMC *paths),
+        ARGIN(STRING *prefix))
+{
+    ASSERT_ARGS(get_resolved_paths)
+    PMC         *cache = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                            IGLOBALS_LIB_PATH_CACHE);
+    PMC         *entry, *snapshot, *resolved;
+    const INTVAL n     = VTABLE_elements(interp, paths);
+    INTVAL       i;
+
+    if (PMC_IS_NULL(cache)) {
+        cache = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray,
+                    PARROT_LIB_PATH_SIZE);
+        VTABLE_set_pmc_keyed_int(interp, interp->iglobals,
+                IGLOBALS_LIB_PATH_CACHE, cache);
+    }
+
+    entry = VTABLE_get_pmc_keyed_int(interp, cache, which);
+
+    if (!PMC_IS_NULL(entry)) {
+        snapshot = VTABLE_get_pmc_keyed_int(interp, entry, 0);
+
+        if (VTABLE_elements(interp, snapshot) == n + 1) {
+            STRING * const old_prefix = VTABLE_get_string_keyed_int(interp, snapshot, n);
+
+            for (i = 0; i < n; ++i) {
+                STRING * const path     = VTABLE_get_string_keyed_int(interp, paths, i);
+                STRING * const old_path = VTABLE_get_string_keyed_int(interp, snapshot, i);
+                if (path != old_path && !STRING_equal(interp, path, old_path))
+                    break;
+            }
+
+            if (i == n && STRING_equal(interp, prefix, old_prefix)) {
+                resolved = VTABLE_get_pmc_keyed_int(interp, entry, 1);
+                return (Hash *)VTABLE_get_pointer(interp, resolved);
+            }
+        }
+    }
+
+    snapshot = Parrot_pmc_new_init_int(interp, enum_class_FixedStringArray, n + 1);
+    for (i = 0; i < n; ++i)
+        VTABLE_set_string_keyed_int(interp, snapshot, i,
+                VTABLE_get_string_keyed_int(interp, paths, i));
+    VTABLE_set_string_keyed_int(interp, snapshot, n, prefix);
+
+    resolved = Parrot_pmc_new_init_int(interp, enum_class_Hash, enum_type_STRING);
+    entry    = Parrot_pmc_new_init_int(interp, enum_class_FixedPMCArray, 2);
+    VTABLE_set_pmc_keyed_int(interp, entry, 0, snapshot);
+    VTABLE_set_pmc_keyed_int(interp, entry, 1, resolved);
+    VTABLE_set_pmc_keyed_int(interp, cache, which, entry);
+
+    return (Hash *)VTABLE_get_pointer(interp, resolved);
+}
+
+/*
+
 =item C<void Parrot_lib_add_path(PARROT_INTERP, STRING *path_str, enum_lib_paths
 which)>
 
 Add a path to the library searchpath of the given type (passing in a STRING).
+This drops the names already resolved against that searchpath.
 
 =cut
 
@@ -682,7 +890,14 @@ Parrot_lib_add_path(PARROT_INTERP,
     PMC * const lib_paths = VTABLE_get_pmc_keyed_int(interp, iglobals,
         IGLOBALS_LIB_PATHS);
     PMC * const paths = VTABLE_get_pmc_keyed_int(interp, lib_paths, which);
+    PMC * const cache = VTABLE_get_pmc_keyed_int(interp, iglobals,
+        IGLOBALS_LIB_PATH_CACHE);
+
     VTABLE_unshift_string(interp, paths, path_str);
+
+    /* names resolved so far may now resolve to a file in the new path */
+    if (!PMC_IS_NULL(cache))
+        VTABLE_set_pmc_keyed_int(interp, cache, which, PMCNULL);
 }
 
 /*
@@ -717,6 +932,11 @@ Locate the full path for C<file_name> and the given file type(s).
 The C<enum_runtime_ft type> is one or more of the types defined in
 F<include/parrot/library.h>.
 
+Names that were found as absolute paths with the extension asked for are
+remembered for each searchpath, so loading the same module again costs one
+stat of the remembered file instead of a search of every path with every
+extension. Other names are searched again every time.
+
 =cut
 
 */
@@ -729,58 +949,42 @@ Parrot_locate_runtime_file_str(PARROT_INTERP, ARGIN(STRING *file),
         enum_runtime_ft type)
 {
     ASSERT_ARGS(Parrot_locate_runtime_file_str)
-    STRING *prefix;
-    STRING *full_name;
-    PMC    *paths;
-    INTVAL  i, n;
+    STRING        *prefix;
+    STRING        *full_name;
+    PMC           *paths;
+    Hash          *resolved = NULL;
+    enum_lib_paths which;
 
     /* if this is an absolute path return it as is */
     if (is_abs_path(interp, file))
         return file;
 
     if (type & PARROT_RUNTIME_FT_LANG)
-        paths = get_search_paths(interp, PARROT_LIB_PATH_LANG);
+        which = PARROT_LIB_PATH_LANG;
     else if (type & PARROT_RUNTIME_FT_DYNEXT)
-        paths = get_search_paths(interp, PARROT_LIB_PATH_DYNEXT);
+        which = PARROT_LIB_PATH_DYNEXT;
     else if (type & (PARROT_RUNTIME_FT_PBC | PARROT_RUNTIME_FT_SOURCE))
-        paths = get_search_paths(interp, PARROT_LIB_PATH_LIBRARY);
+        which = PARROT_LIB_PATH_LIBRARY;
     else
-        paths = get_search_paths(interp, PARROT_LIB_PATH_INCLUDE);
+        which = PARROT_LIB_PATH_INCLUDE;
 
+    paths  = get_search_paths(interp, which);
     prefix = Parrot_get_runtime_path(interp);
-    n = VTABLE_elements(interp, paths);
-
-    for (i = 0; i < n; ++i) {
-        STRING * const path = VTABLE_get_string_keyed_int(interp, paths, i);
-        STRING *found_name;
 
-        full_name = path_concat(interp, path, file);
+    /* each searchpath is only ever searched one way, except for the rare
+     * combination of FT_LANG and FT_DYNEXT, which is not cached */
+    if (!!(type & PARROT_RUNTIME_FT_DYNEXT) == (which == PARROT_LIB_PATH_DYNEXT)) {
+        resolved = get_resolved_paths(interp, which, paths, prefix);
+        full_name = (STRING *)Parrot_hash_get(interp, resolved, file);
 
-        found_name =
-            (type & PARROT_RUNTIME_FT_DYNEXT)
-                ? try_load_path(interp, full_name)
-                : try_bytecode_extensions(interp, full_name);
-
-        if (found_name)
-            return found_name;
-
-        if (STRING_length(prefix) && !is_abs_path(interp, path)) {
-            full_name = path_concat(interp, prefix, full_name);
-
-            found_name =
-                (type & PARROT_RUNTIME_FT_DYNEXT)
-                    ? try_load_path(interp, full_name)
-                    : try_bytecode_extensions(interp, full_name);
-
-            if (found_name)
-                return found_name;
-        }
+        if (full_name && Parrot_file_stat_intval(interp, full_name, STAT_EXISTS))
+            return full_name;
     }
 
-    full_name =
-        (type & PARROT_RUNTIME_FT_DYNEXT)
-            ? try_load_path(interp, file)
-            : try_bytecode_extensions(interp, file);
+    full_name = search_runtime_file(interp, file, paths, prefix, type);
+
+    if (full_name && resolved && is_stable_resolution(interp, file, full_name))
+        Parrot_hash_put(interp, resolved, file, full_name);
 
     return full_name;
 }
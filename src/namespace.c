@@ -17,11 +17,21 @@ Common routines for storing and finding elements in namespaces
 #include "namespace.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_callcontext.h"
+#include "pmc/pmc_namespace.h"
 
 /* HEADERIZER HFILE: include/parrot/namespace.h */
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * find_global_cached(PARROT_INTERP,
+    ARGIN(PMC *ns),
+    ARGIN(STRING *globalname))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 PARROT_WARN_UNUSED_RESULT
 PARROT_CANNOT_RETURN_NULL
 static PMC * get_namespace_pmc(PARROT_INTERP, ARGIN(PMC *sub_pmc))
@@ -75,6 +85,10 @@ static void store_sub_in_multi(PARROT_INTERP,
         __attribute__nonnull__(2)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_find_global_cached __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(ns) \
+    , PARROT_ASSERT_ARG(globalname))
 #define ASSERT_ARGS_get_namespace_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sub_pmc))
@@ -262,7 +276,7 @@ internal_ns_maybe_create(PARROT_INTERP, ARGIN(PMC *ns), ARGIN(STRING *key), int
         if (PMC_IS_NULL(sub_ns))
             return PMCNULL;
 
-        VTABLE_set_pmc_keyed_str(interp, ns, key, sub_ns);
+        VTABLE_set_pmc_keyed_str(interp, ns, Parrot_str_intern(interp, key), sub_ns);
         return sub_ns;
     }
 }
@@ -541,10 +555,45 @@ Parrot_ns_set_global(PARROT_INTERP, ARGIN(PMC *ns),
         ARGIN_NULLOK(STRING *globalname), ARGIN_NULLOK(PMC *val))
 {
     ASSERT_ARGS(Parrot_ns_set_global)
-    VTABLE_set_pmc_keyed_str(interp, ns, globalname, val);
+    VTABLE_set_pmc_keyed_str(interp, ns, Parrot_str_intern(interp, globalname), val);
 }
 
 
+/*
+
+=item C<static PMC * find_global_cached(PARROT_INTERP, PMC *ns, STRING
+*globalname)>
+
+Look up the interned name C<globalname> in the plain NameSpace C<ns> through
+the global cache, refilling the entry if C<ns> has changed since it was filled.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+find_global_cached(PARROT_INTERP, ARGIN(PMC *ns), ARGIN(STRING *globalname))
+{
+    ASSERT_ARGS(find_global_cached)
+    const UINTVAL       version = PARROT_NAMESPACE(ns)->version;
+    const UINTVAL       bits    = (PTR2UINTVAL(ns) >> 4) ^ (PTR2UINTVAL(globalname) >> 4);
+    Global_cache_entry * const e =
+        &interp->caches->globals[bits & (GLOBAL_CACHE_SIZE - 1)];
+
+    if (e->ns != ns || e->name != globalname || e->version != version) {
+        PMC * const res = (PMC *)VTABLE_get_pointer_keyed_str(interp, ns, globalname);
+
+        e->ns      = ns;
+        e->name    = globalname;
+        e->version = version;
+        e->value   = PMC_IS_NULL(res) ? PMCNULL : res;
+    }
+
+    return e->value;
+}
+
 /*
 
 =item C<PMC * Parrot_ns_find_namespace_global(PARROT_INTERP, PMC *ns, STRING
@@ -553,6 +602,9 @@ Parrot_ns_set_global(PARROT_INTERP, ARGIN(PMC *ns),
 Search the namespace PMC C<ns> for an object with name C<globalname>.
 Return the object, or PMCNULL if not found.
 
+Lookups of interned names in a plain NameSpace go through the global cache of
+the interpreter, whose entries stay valid until the NameSpace changes.
+
 TT #1222 - For now this function prefers non-namespaces, it will eventually
 entirely use the untyped interface.
 
@@ -572,6 +624,9 @@ Parrot_ns_find_namespace_global(PARROT_INTERP,
 
     if (PMC_IS_NULL(ns))
         res = PMCNULL;
+    else if (ns->vtable->base_type == enum_class_NameSpace
+         &&  !STRING_IS_NULL(globalname) && STRING_interned_TEST(globalname))
+        res = find_global_cached(interp, ns, globalname);
     else {
         /*
          * TT #1219 - we should be able to use 'get_pmc_keyed' here,
@@ -630,7 +685,8 @@ Parrot_ns_store_global(PARROT_INTERP, ARGIN_NULLOK(PMC *ns),
     if (PMC_IS_NULL(ns))
         return;
 
-    VTABLE_set_pmc_keyed_str(interp, ns, globalname, val);
+    /* interned keys let lookups by constant names match on pointer */
+    VTABLE_set_pmc_keyed_str(interp, ns, Parrot_str_intern(interp, globalname), val);
 }
 
 /*
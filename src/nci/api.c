@@ -76,6 +76,10 @@ build_call_func(PARROT_INTERP, ARGIN(PMC *sig))
                 PMC * const nci_fb_ud =
                     VTABLE_get_pmc_keyed_int(interp, iglobals, IGLOBALS_NCI_FB_UD);
                 thunk = cb(interp, nci_fb_ud, sig);
+
+                /* keep it, so the frame builder runs once per signature */
+                if (!PMC_IS_NULL(thunk))
+                    VTABLE_set_pmc_keyed(interp, nci_funcs, VTABLE_clone(interp, sig), thunk);
             }
         }
     }
@@ -56,16 +56,6 @@ This file implements a native call frame (thunk) factory using libffi.
 #  endif
 #endif
 
-typedef struct ffi_thunk_t {
-    ffi_cif    cif;
-    ffi_type **arg_types;
-
-    ffi_cif    pcc_arg_cif;
-    ffi_type **pcc_arg_types;
-
-    ffi_cif    pcc_ret_cif;
-    ffi_type **pcc_ret_types;
-} ffi_thunk_t;
 
 typedef union parrot_var_t {
     INTVAL    i;
@@ -88,6 +78,46 @@ typedef union nci_var_t {
     INTVAL  I; FLOATVAL N; STRING *S; PMC *P;
 } nci_var_t;
 
+/* Scratch buffers for one call through a thunk */
+typedef struct ffi_thunk_slab_t {
+    parrot_var_t        *pcc_arg;      /* values of pcc arguments */
+    void               **pcc_arg_ptr;  /* pointers to pcc_arg for the PCC call */
+    void               **pcc_call_arg; /* arguments to the PCC calls */
+    parrot_var_t        *pcc_retv;     /* values of pcc returns */
+    nci_var_t           *nci_val;      /* values of nci arguments */
+    void               **nci_arg;      /* pointers for pass-by-ref arguments */
+    void               **nci_arg_ptr;  /* pointers to arguments for libffi */
+    void                *return_data;  /* holds return data from FFI call */
+} ffi_thunk_slab_t;
+
+typedef struct ffi_thunk_t {
+    ffi_cif    cif;
+    ffi_type **arg_types;
+
+    ffi_cif    pcc_arg_cif;
+    ffi_type **pcc_arg_types;
+
+    ffi_cif    pcc_ret_cif;
+    ffi_type **pcc_ret_types;
+
+    /* everything below depends on the signature alone, so it is computed
+     * once when the thunk is built */
+    INTVAL            arity;
+    PARROT_DATA_TYPE *nci_types;      /* return type, then argument types */
+    char             *pcc_params_sig;
+    char             *pcc_ret_sig;
+    INTVAL            pcc_argc;
+    INTVAL            pcc_retc;
+
+    /* no pass-by-reference arguments; plain positional calls need no PCC */
+    int               direct;
+
+    /* scratch buffers reused across calls, and one more than the runloop
+     * level of the call using them, or 0 if they are free */
+    ffi_thunk_slab_t *slab;
+    int               slab_level;
+} ffi_thunk_t;
+
 
 /* HEADERIZER HFILE: include/parrot/nci.h */
 /* HEADERIZER BEGIN: static */
@@ -114,11 +144,35 @@ static PMC * clone_ffi_thunk(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+static int fill_direct_args(PARROT_INTERP,
+    ARGIN(const ffi_thunk_t *thunk),
+    ARGMOD(ffi_thunk_slab_t *slab),
+    ARGIN(PMC *call_object))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*slab);
+
+static void fill_pcc_args(PARROT_INTERP,
+    ARGIN(ffi_thunk_t *thunk),
+    ARGMOD(ffi_thunk_slab_t *slab),
+    ARGIN(PMC *call_object))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*slab);
+
 static void free_ffi_thunk(PARROT_INTERP,
     void *thunk_func,
     ARGFREE(void *thunk_data))
         __attribute__nonnull__(1);
 
+static void free_ffi_thunk_slab(PARROT_INTERP,
+    ARGFREE(ffi_thunk_slab_t *slab))
+        __attribute__nonnull__(1);
+
 PARROT_CANNOT_RETURN_NULL
 static PMC * init_thunk_pmc(PARROT_INTERP, ARGMOD(ffi_thunk_t *thunk_data))
         __attribute__nonnull__(1)
@@ -128,6 +182,31 @@ static PMC * init_thunk_pmc(PARROT_INTERP, ARGMOD(ffi_thunk_t *thunk_data))
 PARROT_CAN_RETURN_NULL
 static ffi_type * nci_to_ffi_type(PARROT_INTERP, PARROT_DATA_TYPE nci_t);
 
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static ffi_thunk_slab_t * new_ffi_thunk_slab(PARROT_INTERP,
+    ARGIN(const ffi_thunk_t *thunk))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void prep_nci_args(PARROT_INTERP,
+    ARGIN(const ffi_thunk_t *thunk),
+    ARGMOD(ffi_thunk_slab_t *slab))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*slab);
+
+static void return_pcc_results(PARROT_INTERP,
+    ARGIN(ffi_thunk_t *thunk),
+    ARGMOD(ffi_thunk_slab_t *slab),
+    ARGIN(PMC *call_object))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*slab);
+
 #define ASSERT_ARGS_build_ffi_thunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(sig))
@@ -138,12 +217,36 @@ static ffi_type * nci_to_ffi_type(PARROT_INTERP, PARROT_DATA_TYPE nci_t);
 #define ASSERT_ARGS_clone_ffi_thunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(_thunk_data))
+#define ASSERT_ARGS_fill_direct_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(thunk) \
+    , PARROT_ASSERT_ARG(slab) \
+    , PARROT_ASSERT_ARG(call_object))
+#define ASSERT_ARGS_fill_pcc_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(thunk) \
+    , PARROT_ASSERT_ARG(slab) \
+    , PARROT_ASSERT_ARG(call_object))
 #define ASSERT_ARGS_free_ffi_thunk __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_free_ffi_thunk_slab __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
 #define ASSERT_ARGS_init_thunk_pmc __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(thunk_data))
 #define ASSERT_ARGS_nci_to_ffi_type __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_new_ffi_thunk_slab __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(thunk))
+#define ASSERT_ARGS_prep_nci_args __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(thunk) \
+    , PARROT_ASSERT_ARG(slab))
+#define ASSERT_ARGS_return_pcc_results __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(thunk) \
+    , PARROT_ASSERT_ARG(slab) \
+    , PARROT_ASSERT_ARG(call_object))
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 /* HEADERIZER END: static */
 
@@ -222,8 +325,29 @@ build_ffi_thunk(PARROT_INTERP, SHIM(PMC *user_data), ARGIN(PMC *sig))
     PMC         *thunk      = init_thunk_pmc(interp, thunk_data);
 
     STRING *pcc_ret_sig, *pcc_params_sig;
+
     Parrot_nci_sig_to_pcc(interp, sig, &pcc_params_sig, &pcc_ret_sig);
 
+    /* cache everything call_ffi_thunk would otherwise recompute per call */
+    thunk_data->arity          = VTABLE_elements(interp, sig) - 1;
+    thunk_data->nci_types      = mem_gc_allocate_n_zeroed_typed(interp,
+                                    thunk_data->arity + 1, PARROT_DATA_TYPE);
+    thunk_data->pcc_params_sig = Parrot_str_to_cstring(interp, pcc_params_sig);
+    thunk_data->pcc_ret_sig    = Parrot_str_to_cstring(interp, pcc_ret_sig);
+    thunk_data->pcc_argc       = Parrot_str_length(interp, pcc_params_sig);
+    thunk_data->pcc_retc       = Parrot_str_length(interp, pcc_ret_sig);
+    thunk_data->direct         = 1;
+
+    {
+        INTVAL i;
+        for (i = 0; i <= thunk_data->arity; i++) {
+            thunk_data->nci_types[i] =
+                (PARROT_DATA_TYPE)VTABLE_get_integer_keyed_int(interp, sig, i);
+            if (thunk_data->nci_types[i] & enum_type_ref_flag)
+                thunk_data->direct = 0;
+        }
+    }
+
     /* generate Parrot_pcc_fill_params_from_c_args dynamic call infrastructure */
     {
         INTVAL     argc  = Parrot_str_length(interp, pcc_params_sig) + 3;
@@ -455,239 +579,439 @@ prep_pcc_ret_arg(PARROT_INTERP, PARROT_DATA_TYPE t, parrot_var_t *pv, void **rv,
 
 /*
 
-=item C<static void call_ffi_thunk(PARROT_INTERP, PMC *nci_pmc, PMC *self)>
+=item C<static ffi_thunk_slab_t * new_ffi_thunk_slab(PARROT_INTERP, const
+ffi_thunk_t *thunk)>
 
-Call the native function described in C<nci_pmc> using the precomputed
-thunk contained in C<self>.
+Allocate the scratch buffers needed for one call through C<thunk>.
+
+=cut
+
+*/
+
+PARROT_MALLOC
+PARROT_CANNOT_RETURN_NULL
+static ffi_thunk_slab_t *
+new_ffi_thunk_slab(PARROT_INTERP, ARGIN(const ffi_thunk_t *thunk))
+{
+    ASSERT_ARGS(new_ffi_thunk_slab)
+    ffi_thunk_slab_t * const slab = mem_gc_allocate_zeroed_typed(interp, ffi_thunk_slab_t);
+    const INTVAL pcc_argc  = thunk->pcc_argc ? thunk->pcc_argc : 1;
+    const INTVAL pcc_retc  = thunk->pcc_retc ? thunk->pcc_retc : 1;
+    const INTVAL arity     = thunk->arity    ? thunk->arity    : 1;
+    const INTVAL pcc_callc = (pcc_argc > pcc_retc ? pcc_argc : pcc_retc) + 3;
+
+    /* libffi widens small integral returns to a full ffi_arg */
+    const size_t ret_size  = thunk->cif.rtype->size > sizeof (ffi_arg)
+                           ? thunk->cif.rtype->size
+                           : sizeof (ffi_arg);
+
+    slab->pcc_arg      = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc, parrot_var_t);
+    slab->pcc_arg_ptr  = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc, void *);
+    slab->pcc_call_arg = mem_gc_allocate_n_zeroed_typed(interp, pcc_callc, void *);
+    slab->pcc_retv     = mem_gc_allocate_n_zeroed_typed(interp, pcc_retc, parrot_var_t);
+    slab->nci_val      = mem_gc_allocate_n_zeroed_typed(interp, arity, nci_var_t);
+    slab->nci_arg      = mem_gc_allocate_n_zeroed_typed(interp, arity, void *);
+    slab->nci_arg_ptr  = mem_gc_allocate_n_zeroed_typed(interp, arity, void *);
+    slab->return_data  = mem_gc_allocate_n_zeroed_typed(interp, ret_size, char);
+
+    return slab;
+}
+
+
+/*
+
+=item C<static void free_ffi_thunk_slab(PARROT_INTERP, ffi_thunk_slab_t *slab)>
+
+Free scratch buffers allocated by C<new_ffi_thunk_slab>.
 
 =cut
 
 */
 
 static void
-call_ffi_thunk(PARROT_INTERP, ARGMOD(PMC *nci_pmc), ARGMOD(PMC *self))
+free_ffi_thunk_slab(PARROT_INTERP, ARGFREE(ffi_thunk_slab_t *slab))
 {
-    ASSERT_ARGS(call_ffi_thunk)
-    Parrot_NCI_attributes *nci = PARROT_NCI(nci_pmc);
-    ffi_thunk_t           *thunk;
+    ASSERT_ARGS(free_ffi_thunk_slab)
+
+    if (!slab)
+        return;
+
+    mem_gc_free(interp, slab->pcc_arg);
+    mem_gc_free(interp, slab->pcc_arg_ptr);
+    mem_gc_free(interp, slab->pcc_call_arg);
+    mem_gc_free(interp, slab->pcc_retv);
+    mem_gc_free(interp, slab->nci_val);
+    mem_gc_free(interp, slab->nci_arg);
+    mem_gc_free(interp, slab->nci_arg_ptr);
+    mem_gc_free(interp, slab->return_data);
+    mem_gc_free(interp, slab);
+}
 
-    PMC *call_object = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
 
-    parrot_var_t  *pcc_arg;     /* values of pcc arguments */
-    nci_var_t     *nci_val;     /* values of nci arguments */
-    void         **nci_arg;     /* pointers for pass-by-ref arguments */
-    void         **nci_arg_ptr = NULL; /* pointers to arguments for libffi */
+/*
 
-    void *return_data; /* Holds return data from FFI call */
-    int i;
+=item C<static int fill_direct_args(PARROT_INTERP, const ffi_thunk_t *thunk,
+ffi_thunk_slab_t *slab, PMC *call_object)>
 
-    {
-        void *v;
-        GETATTR_ManagedStruct_custom_free_priv(interp, self, v);
-        thunk = (ffi_thunk_t *)v;
-    }
+Copy the arguments of a plain positional call straight out of the cells of
+C<call_object>. Returns 0, having done nothing useful, if the call has a
+different number of positionals, any named arguments or an argument whose
+type would need coercion; the caller then goes through PCC.
 
-    /* dynamic call to Parrot_pcc_fill_params_from_c_args */
-    {
-        INTVAL  pcc_argc = Parrot_str_length(interp, nci->pcc_params_signature);
-        char   *pcc_sig  = Parrot_str_to_cstring(interp, nci->pcc_params_signature);
-
-        void **pcc_arg_ptr, **call_arg;
-
-        ffi_arg ffi_ret_dummy;
-
-        pcc_arg     = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc, parrot_var_t);
-        pcc_arg_ptr = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc, void *);
-        call_arg    = mem_gc_allocate_n_zeroed_typed(interp, pcc_argc + 3, void*);
-
-        /* setup Parrot_pcc_fill_params_from_c_args required arguments */
-        call_arg[0] = &interp;
-        call_arg[1] = &call_object;
-        call_arg[2] = &pcc_sig;
-
-        /* TODO: eliminate PCC signature parsing somehow */
-        for (i = 0; i < pcc_argc; i++) {
-            switch (pcc_sig[i]) {
-                case 'I':
-                    pcc_arg_ptr[i] = &pcc_arg[i].i;
-                    break;
-                case 'N':
-                    pcc_arg_ptr[i] = &pcc_arg[i].n;
-                    break;
-                case 'S':
-                    pcc_arg_ptr[i] = &pcc_arg[i].s;
-                    break;
-                case 'P':
-                    pcc_arg_ptr[i] = &pcc_arg[i].p;
-                    break;
-                default:
-                    PARROT_ASSERT(!"Impossible PCC signature");
-                    break;
-            }
+=cut
+
+*/
 
-            call_arg[i + 3] = &pcc_arg_ptr[i];
+static int
+fill_direct_args(PARROT_INTERP, ARGIN(const ffi_thunk_t *thunk),
+        ARGMOD(ffi_thunk_slab_t *slab), ARGIN(PMC *call_object))
+{
+    ASSERT_ARGS(fill_direct_args)
+    Pcc_cell *cells;
+    Hash     *named;
+    INTVAL    positional_count, i;
+
+    if (call_object->vtable->base_type != enum_class_CallContext)
+        return 0;
+
+    GETATTR_CallContext_num_positionals(interp, call_object, positional_count);
+    GETATTR_CallContext_hash(interp, call_object, named);
+
+    if (positional_count != thunk->pcc_argc || (named && named->entries))
+        return 0;
+
+    GETATTR_CallContext_positionals(interp, call_object, cells);
+
+    for (i = 0; i < positional_count; i++) {
+        const Pcc_cell * const cell = &cells[i];
+
+        switch (thunk->pcc_params_sig[i]) {
+          case 'I':
+            if (CELL_TYPE_MASK(cell) != INTCELL)
+                return 0;
+            slab->pcc_arg[i].i = CELL_INT(cell);
+            break;
+          case 'N':
+            if (CELL_TYPE_MASK(cell) != FLOATCELL)
+                return 0;
+            slab->pcc_arg[i].n = CELL_FLOAT(cell);
+            break;
+          case 'S':
+            if (CELL_TYPE_MASK(cell) != STRINGCELL)
+                return 0;
+            slab->pcc_arg[i].s = CELL_STRING(cell);
+            break;
+          case 'P':
+            if (CELL_TYPE_MASK(cell) != PMCCELL)
+                return 0;
+            slab->pcc_arg[i].p = CELL_PMC(cell);
+            break;
+          default:
+            return 0;
         }
+    }
 
-        ffi_call(&thunk->pcc_arg_cif, FFI_FN(Parrot_pcc_fill_params_from_c_args),
-                &ffi_ret_dummy, call_arg);
+    return 1;
+}
 
-        mem_gc_free(interp, call_arg);
-        mem_gc_free(interp, pcc_arg_ptr);
-        Parrot_str_free_cstring(pcc_sig);
-    }
 
-    if (nci->arity) {
-        nci_val     = mem_gc_allocate_n_zeroed_typed(interp, nci->arity, nci_var_t);
-        nci_arg     = mem_gc_allocate_n_zeroed_typed(interp, nci->arity, void *);
-        nci_arg_ptr = mem_gc_allocate_n_zeroed_typed(interp, nci->arity, void *);
-
-        for (i = 0; i < nci->arity; i++) {
-            PARROT_DATA_TYPE t = (PARROT_DATA_TYPE)
-                                    VTABLE_get_integer_keyed_int(interp, nci->signature, i + 1);
-            switch (t & ~enum_type_ref_flag) {
-              case enum_type_char:
-                nci_val[i].c   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].c;
-                break;
-              case enum_type_short:
-                nci_val[i].s   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].s;
-                break;
-              case enum_type_int:
-                nci_val[i].i   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i;
-                break;
-              case enum_type_long:
-                nci_val[i].l   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].l;
-                break;
-#if PARROT_HAS_LONGLONG
-              case enum_type_longlong:
-                nci_val[i].ll  = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].ll;
-                break;
-#endif
-              case enum_type_int8:
-                nci_val[i].i8  = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i8;
+/*
+
+=item C<static void fill_pcc_args(PARROT_INTERP, ffi_thunk_t *thunk,
+ffi_thunk_slab_t *slab, PMC *call_object)>
+
+Bind the arguments of C<call_object> through
+C<Parrot_pcc_fill_params_from_c_args>, which handles coercion, flattening and
+arity errors.
+
+=cut
+
+*/
+
+static void
+fill_pcc_args(PARROT_INTERP, ARGIN(ffi_thunk_t *thunk),
+        ARGMOD(ffi_thunk_slab_t *slab), ARGIN(PMC *call_object))
+{
+    ASSERT_ARGS(fill_pcc_args)
+    const char *pcc_sig  = thunk->pcc_params_sig;
+    void      **call_arg = slab->pcc_call_arg;
+    ffi_arg     ffi_ret_dummy;
+    INTVAL      i;
+
+    /* setup Parrot_pcc_fill_params_from_c_args required arguments */
+    call_arg[0] = &interp;
+    call_arg[1] = &call_object;
+    call_arg[2] = &pcc_sig;
+
+    for (i = 0; i < thunk->pcc_argc; i++) {
+        switch (pcc_sig[i]) {
+            case 'I':
+                slab->pcc_arg_ptr[i] = &slab->pcc_arg[i].i;
                 break;
-              case enum_type_int16:
-                nci_val[i].i16 = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i16;
+            case 'N':
+                slab->pcc_arg_ptr[i] = &slab->pcc_arg[i].n;
                 break;
-              case enum_type_int32:
-                nci_val[i].i32 = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i32;
+            case 'S':
+                slab->pcc_arg_ptr[i] = &slab->pcc_arg[i].s;
                 break;
-#if PARROT_HAS_INT64
-              case enum_type_int64:
-                nci_val[i].i64 = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].i64;
+            case 'P':
+                slab->pcc_arg_ptr[i] = &slab->pcc_arg[i].p;
                 break;
-#endif
-              case enum_type_INTVAL:
-                nci_val[i].I   = pcc_arg[i].i;
-                nci_arg_ptr[i] = &nci_val[i].I;
+            default:
+                PARROT_ASSERT(!"Impossible PCC signature");
                 break;
+        }
 
-              case enum_type_float:
-                nci_val[i].f   = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].f;
-                break;
-              case enum_type_double:
-                nci_val[i].d   = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].d;
-                break;
-              case enum_type_longdouble:
-                nci_val[i].ld  = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].ld;
-                break;
-              case enum_type_FLOATVAL:
-                nci_val[i].N   = pcc_arg[i].n;
-                nci_arg_ptr[i] = &nci_val[i].N;
-                break;
+        call_arg[i + 3] = &slab->pcc_arg_ptr[i];
+    }
 
-              case enum_type_STRING:
-                nci_val[i].S   = pcc_arg[i].s;
-                nci_arg_ptr[i] = &nci_val[i].S;
-                break;
-              case enum_type_PMC:
-                nci_val[i].P   = pcc_arg[i].p;
-                nci_arg_ptr[i] = &nci_val[i].P;
-                break;
-              case enum_type_ptr:
-                nci_val[i].p   = PMC_IS_NULL(pcc_arg[i].p) ?
-                                    NULL :
-                                    VTABLE_get_pointer(interp, pcc_arg[i].p);
-                nci_arg_ptr[i] = &nci_val[i].p;
-                break;
+    ffi_call(&thunk->pcc_arg_cif, FFI_FN(Parrot_pcc_fill_params_from_c_args),
+            &ffi_ret_dummy, call_arg);
+}
 
-              default:
-                PARROT_ASSERT("Unhandled NCI signature");
-                break;
-            }
 
-            if (t & enum_type_ref_flag) {
-                nci_arg[i]     = nci_arg_ptr[i];
-                nci_arg_ptr[i] = &nci_arg[i];
-            }
+/*
+
+=item C<static void prep_nci_args(PARROT_INTERP, const ffi_thunk_t *thunk,
+ffi_thunk_slab_t *slab)>
+
+Convert the bound PCC arguments into the C types the native function expects
+and point libffi at them.
+
+=cut
+
+*/
+
+static void
+prep_nci_args(PARROT_INTERP, ARGIN(const ffi_thunk_t *thunk), ARGMOD(ffi_thunk_slab_t *slab))
+{
+    ASSERT_ARGS(prep_nci_args)
+    parrot_var_t * const pcc_arg     = slab->pcc_arg;
+    nci_var_t    * const nci_val     = slab->nci_val;
+    void        ** const nci_arg     = slab->nci_arg;
+    void        ** const nci_arg_ptr = slab->nci_arg_ptr;
+    INTVAL i;
+
+    for (i = 0; i < thunk->arity; i++) {
+        const PARROT_DATA_TYPE t = thunk->nci_types[i + 1];
+        switch (t & ~enum_type_ref_flag) {
+          case enum_type_char:
+            nci_val[i].c   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].c;
+            break;
+          case enum_type_short:
+            nci_val[i].s   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].s;
+            break;
+          case enum_type_int:
+            nci_val[i].i   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i;
+            break;
+          case enum_type_long:
+            nci_val[i].l   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].l;
+            break;
+#if PARROT_HAS_LONGLONG
+          case enum_type_longlong:
+            nci_val[i].ll  = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].ll;
+            break;
+#endif
+          case enum_type_int8:
+            nci_val[i].i8  = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i8;
+            break;
+          case enum_type_int16:
+            nci_val[i].i16 = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i16;
+            break;
+          case enum_type_int32:
+            nci_val[i].i32 = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i32;
+            break;
+#if PARROT_HAS_INT64
+          case enum_type_int64:
+            nci_val[i].i64 = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].i64;
+            break;
+#endif
+          case enum_type_INTVAL:
+            nci_val[i].I   = pcc_arg[i].i;
+            nci_arg_ptr[i] = &nci_val[i].I;
+            break;
+
+          case enum_type_float:
+            nci_val[i].f   = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].f;
+            break;
+          case enum_type_double:
+            nci_val[i].d   = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].d;
+            break;
+          case enum_type_longdouble:
+            nci_val[i].ld  = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].ld;
+            break;
+          case enum_type_FLOATVAL:
+            nci_val[i].N   = pcc_arg[i].n;
+            nci_arg_ptr[i] = &nci_val[i].N;
+            break;
+
+          case enum_type_STRING:
+            nci_val[i].S   = pcc_arg[i].s;
+            nci_arg_ptr[i] = &nci_val[i].S;
+            break;
+          case enum_type_PMC:
+            nci_val[i].P   = pcc_arg[i].p;
+            nci_arg_ptr[i] = &nci_val[i].P;
+            break;
+          case enum_type_ptr:
+            nci_val[i].p   = PMC_IS_NULL(pcc_arg[i].p) ?
+                                NULL :
+                                VTABLE_get_pointer(interp, pcc_arg[i].p);
+            nci_arg_ptr[i] = &nci_val[i].p;
+            break;
+
+          default:
+            PARROT_ASSERT("Unhandled NCI signature");
+            break;
+        }
+
+        if (t & enum_type_ref_flag) {
+            nci_arg[i]     = nci_arg_ptr[i];
+            nci_arg_ptr[i] = &nci_arg[i];
         }
     }
+}
+
 
-    mem_gc_free(interp, pcc_arg);
+/*
 
-    return_data = mem_sys_allocate(thunk->cif.rtype->size);
+=item C<static void return_pcc_results(PARROT_INTERP, ffi_thunk_t *thunk,
+ffi_thunk_slab_t *slab, PMC *call_object)>
 
-    ffi_call(&thunk->cif, FFI_FN(nci->orig_func), return_data, nci_arg_ptr);
+Pass the return value and any pass-by-reference arguments back to the caller.
+A single result is handed to C<Parrot_pcc_build_call_from_c_args> directly;
+only several results need a dynamic call.
 
-    /* dynamic call to Parrot_pcc_build_call_from_c_args */
-    if (thunk->pcc_ret_cif.nargs > 3) {
-        PMC           *ffi_ret_unused;
-        INTVAL         pcc_retc    = Parrot_str_length(interp, nci->pcc_return_signature);
-        char          *pcc_ret_sig = Parrot_str_to_cstring(interp, nci->pcc_return_signature);
-        void         **call_arg    = mem_gc_allocate_n_zeroed_typed(interp, pcc_retc + 3, void *);
-        parrot_var_t  *pcc_retv    = mem_gc_allocate_n_zeroed_typed(interp, pcc_retc, parrot_var_t);
+=cut
 
-        PARROT_DATA_TYPE arg_t;
-        int              j;
-        i = 0;
+*/
 
-        call_arg[0] = &interp;
-        call_arg[1] = &call_object;
-        call_arg[2] = &pcc_ret_sig;
+static void
+return_pcc_results(PARROT_INTERP, ARGIN(ffi_thunk_t *thunk),
+        ARGMOD(ffi_thunk_slab_t *slab), ARGIN(PMC *call_object))
+{
+    ASSERT_ARGS(return_pcc_results)
+    void       **call_arg    = slab->pcc_call_arg;
+    const char  *pcc_ret_sig = thunk->pcc_ret_sig;
+    PMC         *ffi_ret_unused;
+    INTVAL       i = 0, j;
+
+    /* populate return slot (non-existent if void) */
+    if (enum_type_void != thunk->nci_types[0]) {
+        prep_pcc_ret_arg(interp, thunk->nci_types[0], &slab->pcc_retv[i],
+                            &call_arg[i + 3], slab->return_data);
+        i++;
+    }
 
-        /* populate return slot (non-existent if void) */
-        if (enum_type_void !=
-            (arg_t = (PARROT_DATA_TYPE)VTABLE_get_integer_keyed_int(interp, nci->signature, 0))) {
-            prep_pcc_ret_arg(interp, arg_t, &pcc_retv[i], &call_arg[i + 3], return_data);
+    /* also return call-by-reference arguments (if any) */
+    for (j = 1; i < thunk->pcc_retc; j++) {
+        const PARROT_DATA_TYPE t = thunk->nci_types[j];
+        if (t & enum_type_ref_flag) {
+            prep_pcc_ret_arg(interp, (PARROT_DATA_TYPE)(t & ~enum_type_ref_flag),
+                                &slab->pcc_retv[i], &call_arg[i + 3], slab->nci_arg[j - 1]);
             i++;
         }
+    }
 
-        /* also return call-by-reference arguments (if any) */
-        for (j = 1; i < pcc_retc; j++) {
-            arg_t = (PARROT_DATA_TYPE)VTABLE_get_integer_keyed_int(interp, nci->signature, j);
-            if (arg_t & enum_type_ref_flag) {
-                prep_pcc_ret_arg(interp, (PARROT_DATA_TYPE)(arg_t & ~enum_type_ref_flag),
-                                    &pcc_retv[i], &call_arg[i + 3], nci_arg[j - 1]);
-                i++;
-            }
+    if (thunk->pcc_retc == 1) {
+        const parrot_var_t * const v = &slab->pcc_retv[0];
+        switch (pcc_ret_sig[0]) {
+          case 'I':
+            call_object = Parrot_pcc_build_call_from_c_args(interp, call_object,
+                    pcc_ret_sig, v->i);
+            break;
+          case 'N':
+            call_object = Parrot_pcc_build_call_from_c_args(interp, call_object,
+                    pcc_ret_sig, v->n);
+            break;
+          case 'S':
+            call_object = Parrot_pcc_build_call_from_c_args(interp, call_object,
+                    pcc_ret_sig, v->s);
+            break;
+          default:
+            call_object = Parrot_pcc_build_call_from_c_args(interp, call_object,
+                    pcc_ret_sig, v->p);
+            break;
         }
+        return;
+    }
+
+    call_arg[0] = &interp;
+    call_arg[1] = &call_object;
+    call_arg[2] = &pcc_ret_sig;
+
+    ffi_call(&thunk->pcc_ret_cif, FFI_FN(Parrot_pcc_build_call_from_c_args),
+            &ffi_ret_unused, call_arg);
+}
+
+
+/*
+
+=item C<static void call_ffi_thunk(PARROT_INTERP, PMC *nci_pmc, PMC *self)>
+
+Call the native function described in C<nci_pmc> using the precomputed
+thunk contained in C<self>.
+
+=cut
+
+*/
 
-        ffi_call(&thunk->pcc_ret_cif, FFI_FN(Parrot_pcc_build_call_from_c_args),
-                &ffi_ret_unused, call_arg);
+static void
+call_ffi_thunk(PARROT_INTERP, ARGMOD(PMC *nci_pmc), ARGMOD(PMC *self))
+{
+    ASSERT_ARGS(call_ffi_thunk)
+    Parrot_NCI_attributes * const nci = PARROT_NCI(nci_pmc);
+    PMC * const call_object = Parrot_pcc_get_signature(interp, CURRENT_CONTEXT(interp));
+    const int         level = interp->current_runloop_level + 1;
+    ffi_thunk_t      *thunk;
+    ffi_thunk_slab_t *slab;
 
-        Parrot_str_free_cstring(pcc_ret_sig);
-        mem_gc_free(interp, call_arg);
-        mem_gc_free(interp, pcc_retv);
+    {
+        void *v;
+        GETATTR_ManagedStruct_custom_free_priv(interp, self, v);
+        thunk = (ffi_thunk_t *)v;
     }
 
-    if (nci->arity) {
-        mem_gc_free(interp, nci_val);
-        mem_gc_free(interp, nci_arg);
-        mem_gc_free(interp, nci_arg_ptr);
+    if (!thunk->slab)
+        thunk->slab = new_ffi_thunk_slab(interp, thunk);
+
+    /* Callbacks from C run in a deeper runloop, so a holder at a deeper or
+     * the same level has already left, by throwing. Its buffers are
+     * reclaimed here; a reentrant call makes its own. */
+    if (!thunk->slab_level || thunk->slab_level >= level) {
+        slab              = thunk->slab;
+        thunk->slab_level = level;
     }
+    else
+        slab = new_ffi_thunk_slab(interp, thunk);
 
-    mem_gc_free(interp, return_data);
+    if (!thunk->direct || !fill_direct_args(interp, thunk, slab, call_object))
+        fill_pcc_args(interp, thunk, slab, call_object);
+
+    prep_nci_args(interp, thunk, slab);
+
+    ffi_call(&thunk->cif, FFI_FN(nci->orig_func), slab->return_data,
+            thunk->arity ? slab->nci_arg_ptr : NULL);
+
+    if (thunk->pcc_retc)
+        return_pcc_results(interp, thunk, slab, call_object);
+
+    if (slab == thunk->slab)
+        thunk->slab_level = 0;
+    else
+        free_ffi_thunk_slab(interp, slab);
 }
 
 
@@ -726,6 +1050,20 @@ clone_ffi_thunk(PARROT_INTERP, SHIM(PMC *thunk), ARGIN(void *_thunk_data))
     mem_copy_n_typed(clone_data->arg_types, thunk_data->arg_types,
                         thunk_data->cif.nargs, ffi_type *);
 
+    /* the copied cifs must not point into the original's type arrays */
+    clone_data->pcc_arg_cif.arg_types = clone_data->pcc_arg_types;
+    clone_data->cif.arg_types         = clone_data->arg_types;
+
+    clone_data->nci_types      = mem_gc_allocate_n_zeroed_typed(interp,
+                                    thunk_data->arity + 1, PARROT_DATA_TYPE);
+    mem_copy_n_typed(clone_data->nci_types, thunk_data->nci_types,
+                        thunk_data->arity + 1, PARROT_DATA_TYPE);
+
+    clone_data->pcc_params_sig = mem_sys_strdup(thunk_data->pcc_params_sig);
+    clone_data->pcc_ret_sig    = mem_sys_strdup(thunk_data->pcc_ret_sig);
+    clone_data->slab           = NULL;
+    clone_data->slab_level     = 0;
+
     return clone;
 }
 
@@ -753,6 +1091,17 @@ free_ffi_thunk(PARROT_INTERP, SHIM(void *thunk_func), ARGFREE(void *thunk_data))
     if (thunk->pcc_arg_types)
         mem_gc_free(interp, thunk->pcc_arg_types);
 
+    if (thunk->nci_types)
+        mem_gc_free(interp, thunk->nci_types);
+
+    if (thunk->pcc_params_sig)
+        mem_sys_free(thunk->pcc_params_sig);
+
+    if (thunk->pcc_ret_sig)
+        mem_sys_free(thunk->pcc_ret_sig);
+
+    free_ffi_thunk_slab(interp, thunk->slab);
+
     mem_gc_free(interp, thunk);
 }
 
@@ -735,7 +735,8 @@ Parrot_oo_register_type(PARROT_INTERP, ARGIN(PMC *name), ARGIN(PMC *_namespace))
 
 =item C<void mark_object_cache(PARROT_INTERP)>
 
-Marks all PMCs in the object method cache as live.  This shouldn't strictly be
+Marks all PMCs in the object method cache and the global lookup cache as
+live.  This shouldn't strictly be
 necessary, as they're likely all reachable from namespaces and classes, but
 it's unlikely to hurt anything except mark phase performance.
 
@@ -756,6 +757,16 @@ mark_object_cache(PARROT_INTERP)
     if (!mc)
         return;
 
+    if (mc->globals) {
+        for (entry = 0; entry < GLOBAL_CACHE_SIZE; ++entry) {
+            Global_cache_entry * const g = &mc->globals[entry];
+            if (g->ns) {
+                Parrot_gc_mark_PMC_alive(interp, g->ns);
+                Parrot_gc_mark_PMC_alive(interp, g->value);
+            }
+        }
+    }
+
     for (type = 0; type < mc->mc_size; ++type) {
         if (!mc->idx[type])
             continue;
@@ -786,7 +797,9 @@ init_object_cache(PARROT_INTERP)
 {
     ASSERT_ARGS(init_object_cache)
     Caches * const mc = interp->caches = mem_gc_allocate_zeroed_typed(interp, Caches);
-    mc->idx = NULL;
+    mc->idx     = NULL;
+    mc->globals = mem_gc_allocate_n_zeroed_typed(interp, GLOBAL_CACHE_SIZE,
+                    Global_cache_entry);
 }
 
 
@@ -815,6 +828,7 @@ destroy_object_cache(PARROT_INTERP)
     }
 
     mem_gc_free(interp, mc->idx);
+    mem_gc_free(interp, mc->globals);
     mem_gc_free(interp, mc);
 }
 
@@ -1010,6 +1024,9 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
     Meth_cache_entry *e;
     UINTVAL type, bits;
 
+    /* equal names share one cache entry once they're interned */
+    method_name = Parrot_str_intern(interp, method_name);
+
     if (! PObj_constant_TEST(method_name))
         return Parrot_find_method_direct(interp, _class, method_name);
 
@@ -1042,11 +1059,11 @@ Parrot_find_method_with_cache(PARROT_INTERP, ARGIN(PMC *_class), ARGIN(STRING *m
         /* Use zeroed allocation because find_method_direct can trigger GC */
         e = mem_gc_allocate_zeroed_typed(interp, Meth_cache_entry);
 
-        mc->idx[type][bits] = e;
-
         e->pmc      = Parrot_find_method_direct(interp, _class, method_name);
-        e->next     = NULL;
+        e->next     = mc->idx[type][bits];
         e->strstart = Buffer_bufstart(method_name);
+
+        mc->idx[type][bits] = e;
     }
 
     return e->pmc;
@@ -78,13 +78,13 @@ extern op_lib_t core_op_lib;
 
 
 
-INTVAL core_numops = 1130;
+INTVAL core_numops = 1154;
 
 /*
 ** Op Function Table:
 */
 
-static op_func_t core_op_func_table[1130] = {
+static op_func_t core_op_func_table[1154] = {
   Parrot_end,                                        /*      0 */
   Parrot_noop,                                       /*      1 */
   Parrot_check_events,                               /*      2 */
@@ -762,458 +762,482 @@ static op_func_t core_op_func_table[1130] = {
   Parrot_freeze_s_p,                                 /*    674 */
   Parrot_thaw_p_s,                                   /*    675 */
   Parrot_thaw_p_sc,                                  /*    676 */
-  Parrot_add_multi_s_s_p,                            /*    677 */
-  Parrot_add_multi_sc_s_p,                           /*    678 */
-  Parrot_add_multi_s_sc_p,                           /*    679 */
-  Parrot_add_multi_sc_sc_p,                          /*    680 */
-  Parrot_find_multi_p_s_s,                           /*    681 */
-  Parrot_find_multi_p_sc_s,                          /*    682 */
-  Parrot_find_multi_p_s_sc,                          /*    683 */
-  Parrot_find_multi_p_sc_sc,                         /*    684 */
-  Parrot_register_p,                                 /*    685 */
-  Parrot_unregister_p,                               /*    686 */
-  Parrot_box_p_i,                                    /*    687 */
-  Parrot_box_p_ic,                                   /*    688 */
-  Parrot_box_p_n,                                    /*    689 */
-  Parrot_box_p_nc,                                   /*    690 */
-  Parrot_box_p_s,                                    /*    691 */
-  Parrot_box_p_sc,                                   /*    692 */
-  Parrot_iter_p_p,                                   /*    693 */
-  Parrot_morph_p_p,                                  /*    694 */
-  Parrot_morph_p_pc,                                 /*    695 */
-  Parrot_clone_s_s,                                  /*    696 */
-  Parrot_clone_s_sc,                                 /*    697 */
-  Parrot_set_i_i,                                    /*    698 */
-  Parrot_set_i_ic,                                   /*    699 */
-  Parrot_set_i_n,                                    /*    700 */
-  Parrot_set_i_nc,                                   /*    701 */
-  Parrot_set_i_s,                                    /*    702 */
-  Parrot_set_i_sc,                                   /*    703 */
-  Parrot_set_n_n,                                    /*    704 */
-  Parrot_set_n_nc,                                   /*    705 */
-  Parrot_set_n_i,                                    /*    706 */
-  Parrot_set_n_ic,                                   /*    707 */
-  Parrot_set_n_s,                                    /*    708 */
-  Parrot_set_n_sc,                                   /*    709 */
-  Parrot_set_n_p,                                    /*    710 */
-  Parrot_set_s_p,                                    /*    711 */
-  Parrot_set_s_s,                                    /*    712 */
-  Parrot_set_s_sc,                                   /*    713 */
-  Parrot_set_s_i,                                    /*    714 */
-  Parrot_set_s_ic,                                   /*    715 */
-  Parrot_set_s_n,                                    /*    716 */
-  Parrot_set_s_nc,                                   /*    717 */
-  Parrot_set_p_pc,                                   /*    718 */
-  Parrot_set_p_p,                                    /*    719 */
-  Parrot_set_p_i,                                    /*    720 */
-  Parrot_set_p_ic,                                   /*    721 */
-  Parrot_set_p_n,                                    /*    722 */
-  Parrot_set_p_nc,                                   /*    723 */
-  Parrot_set_p_s,                                    /*    724 */
-  Parrot_set_p_sc,                                   /*    725 */
-  Parrot_set_i_p,                                    /*    726 */
-  Parrot_assign_p_p,                                 /*    727 */
-  Parrot_assign_p_i,                                 /*    728 */
-  Parrot_assign_p_ic,                                /*    729 */
-  Parrot_assign_p_n,                                 /*    730 */
-  Parrot_assign_p_nc,                                /*    731 */
-  Parrot_assign_p_s,                                 /*    732 */
-  Parrot_assign_p_sc,                                /*    733 */
-  Parrot_assign_s_s,                                 /*    734 */
-  Parrot_assign_s_sc,                                /*    735 */
-  Parrot_setref_p_p,                                 /*    736 */
-  Parrot_deref_p_p,                                  /*    737 */
-  Parrot_set_p_ki_i,                                 /*    738 */
-  Parrot_set_p_kic_i,                                /*    739 */
-  Parrot_set_p_ki_ic,                                /*    740 */
-  Parrot_set_p_kic_ic,                               /*    741 */
-  Parrot_set_p_ki_n,                                 /*    742 */
-  Parrot_set_p_kic_n,                                /*    743 */
-  Parrot_set_p_ki_nc,                                /*    744 */
-  Parrot_set_p_kic_nc,                               /*    745 */
-  Parrot_set_p_ki_s,                                 /*    746 */
-  Parrot_set_p_kic_s,                                /*    747 */
-  Parrot_set_p_ki_sc,                                /*    748 */
-  Parrot_set_p_kic_sc,                               /*    749 */
-  Parrot_set_p_ki_p,                                 /*    750 */
-  Parrot_set_p_kic_p,                                /*    751 */
-  Parrot_set_i_p_ki,                                 /*    752 */
-  Parrot_set_i_p_kic,                                /*    753 */
-  Parrot_set_n_p_ki,                                 /*    754 */
-  Parrot_set_n_p_kic,                                /*    755 */
-  Parrot_set_s_p_ki,                                 /*    756 */
-  Parrot_set_s_p_kic,                                /*    757 */
-  Parrot_set_p_p_ki,                                 /*    758 */
-  Parrot_set_p_p_kic,                                /*    759 */
-  Parrot_set_p_k_i,                                  /*    760 */
-  Parrot_set_p_kc_i,                                 /*    761 */
-  Parrot_set_p_k_ic,                                 /*    762 */
-  Parrot_set_p_kc_ic,                                /*    763 */
-  Parrot_set_p_k_n,                                  /*    764 */
-  Parrot_set_p_kc_n,                                 /*    765 */
-  Parrot_set_p_k_nc,                                 /*    766 */
-  Parrot_set_p_kc_nc,                                /*    767 */
-  Parrot_set_p_k_s,                                  /*    768 */
-  Parrot_set_p_kc_s,                                 /*    769 */
-  Parrot_set_p_k_sc,                                 /*    770 */
-  Parrot_set_p_kc_sc,                                /*    771 */
-  Parrot_set_p_k_p,                                  /*    772 */
-  Parrot_set_p_kc_p,                                 /*    773 */
-  Parrot_set_i_p_k,                                  /*    774 */
-  Parrot_set_i_p_kc,                                 /*    775 */
-  Parrot_set_n_p_k,                                  /*    776 */
-  Parrot_set_n_p_kc,                                 /*    777 */
-  Parrot_set_s_p_k,                                  /*    778 */
-  Parrot_set_s_p_kc,                                 /*    779 */
-  Parrot_set_p_p_k,                                  /*    780 */
-  Parrot_set_p_p_kc,                                 /*    781 */
-  Parrot_clone_p_p,                                  /*    782 */
-  Parrot_clone_p_p_p,                                /*    783 */
-  Parrot_clone_p_p_pc,                               /*    784 */
-  Parrot_copy_p_p,                                   /*    785 */
-  Parrot_null_s,                                     /*    786 */
-  Parrot_null_i,                                     /*    787 */
-  Parrot_null_p,                                     /*    788 */
-  Parrot_null_n,                                     /*    789 */
-  Parrot_ord_i_s,                                    /*    790 */
-  Parrot_ord_i_sc,                                   /*    791 */
-  Parrot_ord_i_s_i,                                  /*    792 */
-  Parrot_ord_i_sc_i,                                 /*    793 */
-  Parrot_ord_i_s_ic,                                 /*    794 */
-  Parrot_ord_i_sc_ic,                                /*    795 */
-  Parrot_chr_s_i,                                    /*    796 */
-  Parrot_chr_s_ic,                                   /*    797 */
-  Parrot_chopn_s_s_i,                                /*    798 */
-  Parrot_chopn_s_sc_i,                               /*    799 */
-  Parrot_chopn_s_s_ic,                               /*    800 */
-  Parrot_chopn_s_sc_ic,                              /*    801 */
-  Parrot_concat_p_p,                                 /*    802 */
-  Parrot_concat_p_s,                                 /*    803 */
-  Parrot_concat_p_sc,                                /*    804 */
-  Parrot_concat_s_s_s,                               /*    805 */
-  Parrot_concat_s_sc_s,                              /*    806 */
-  Parrot_concat_s_s_sc,                              /*    807 */
-  Parrot_concat_p_p_s,                               /*    808 */
-  Parrot_concat_p_p_sc,                              /*    809 */
-  Parrot_concat_p_p_p,                               /*    810 */
-  Parrot_repeat_s_s_i,                               /*    811 */
-  Parrot_repeat_s_sc_i,                              /*    812 */
-  Parrot_repeat_s_s_ic,                              /*    813 */
-  Parrot_repeat_s_sc_ic,                             /*    814 */
-  Parrot_repeat_p_p_i,                               /*    815 */
-  Parrot_repeat_p_p_ic,                              /*    816 */
-  Parrot_repeat_p_p_p,                               /*    817 */
-  Parrot_repeat_p_i,                                 /*    818 */
-  Parrot_repeat_p_ic,                                /*    819 */
-  Parrot_repeat_p_p,                                 /*    820 */
-  Parrot_length_i_s,                                 /*    821 */
-  Parrot_length_i_sc,                                /*    822 */
-  Parrot_bytelength_i_s,                             /*    823 */
-  Parrot_bytelength_i_sc,                            /*    824 */
-  Parrot_pin_s,                                      /*    825 */
-  Parrot_unpin_s,                                    /*    826 */
-  Parrot_substr_s_s_i,                               /*    827 */
-  Parrot_substr_s_sc_i,                              /*    828 */
-  Parrot_substr_s_s_ic,                              /*    829 */
-  Parrot_substr_s_sc_ic,                             /*    830 */
-  Parrot_substr_s_s_i_i,                             /*    831 */
-  Parrot_substr_s_sc_i_i,                            /*    832 */
-  Parrot_substr_s_s_ic_i,                            /*    833 */
-  Parrot_substr_s_sc_ic_i,                           /*    834 */
-  Parrot_substr_s_s_i_ic,                            /*    835 */
-  Parrot_substr_s_sc_i_ic,                           /*    836 */
-  Parrot_substr_s_s_ic_ic,                           /*    837 */
-  Parrot_substr_s_sc_ic_ic,                          /*    838 */
-  Parrot_substr_s_p_i_i,                             /*    839 */
-  Parrot_substr_s_p_ic_i,                            /*    840 */
-  Parrot_substr_s_p_i_ic,                            /*    841 */
-  Parrot_substr_s_p_ic_ic,                           /*    842 */
-  Parrot_replace_s_s_i_i_s,                          /*    843 */
-  Parrot_replace_s_sc_i_i_s,                         /*    844 */
-  Parrot_replace_s_s_ic_i_s,                         /*    845 */
-  Parrot_replace_s_sc_ic_i_s,                        /*    846 */
-  Parrot_replace_s_s_i_ic_s,                         /*    847 */
-  Parrot_replace_s_sc_i_ic_s,                        /*    848 */
-  Parrot_replace_s_s_ic_ic_s,                        /*    849 */
-  Parrot_replace_s_sc_ic_ic_s,                       /*    850 */
-  Parrot_replace_s_s_i_i_sc,                         /*    851 */
-  Parrot_replace_s_sc_i_i_sc,                        /*    852 */
-  Parrot_replace_s_s_ic_i_sc,                        /*    853 */
-  Parrot_replace_s_sc_ic_i_sc,                       /*    854 */
-  Parrot_replace_s_s_i_ic_sc,                        /*    855 */
-  Parrot_replace_s_sc_i_ic_sc,                       /*    856 */
-  Parrot_replace_s_s_ic_ic_sc,                       /*    857 */
-  Parrot_replace_s_sc_ic_ic_sc,                      /*    858 */
-  Parrot_index_i_s_s,                                /*    859 */
-  Parrot_index_i_sc_s,                               /*    860 */
-  Parrot_index_i_s_sc,                               /*    861 */
-  Parrot_index_i_sc_sc,                              /*    862 */
-  Parrot_index_i_s_s_i,                              /*    863 */
-  Parrot_index_i_sc_s_i,                             /*    864 */
-  Parrot_index_i_s_sc_i,                             /*    865 */
-  Parrot_index_i_sc_sc_i,                            /*    866 */
-  Parrot_index_i_s_s_ic,                             /*    867 */
-  Parrot_index_i_sc_s_ic,                            /*    868 */
-  Parrot_index_i_s_sc_ic,                            /*    869 */
-  Parrot_index_i_sc_sc_ic,                           /*    870 */
-  Parrot_rindex_i_s_s,                               /*    871 */
-  Parrot_rindex_i_sc_s,                              /*    872 */
-  Parrot_rindex_i_s_sc,                              /*    873 */
-  Parrot_rindex_i_sc_sc,                             /*    874 */
-  Parrot_rindex_i_s_s_i,                             /*    875 */
-  Parrot_rindex_i_sc_s_i,                            /*    876 */
-  Parrot_rindex_i_s_sc_i,                            /*    877 */
-  Parrot_rindex_i_sc_sc_i,                           /*    878 */
-  Parrot_rindex_i_s_s_ic,                            /*    879 */
-  Parrot_rindex_i_sc_s_ic,                           /*    880 */
-  Parrot_rindex_i_s_sc_ic,                           /*    881 */
-  Parrot_rindex_i_sc_sc_ic,                          /*    882 */
-  Parrot_sprintf_s_s_p,                              /*    883 */
-  Parrot_sprintf_s_sc_p,                             /*    884 */
-  Parrot_sprintf_p_p_p,                              /*    885 */
-  Parrot_new_s,                                      /*    886 */
-  Parrot_stringinfo_i_s_i,                           /*    887 */
-  Parrot_stringinfo_i_sc_i,                          /*    888 */
-  Parrot_stringinfo_i_s_ic,                          /*    889 */
-  Parrot_stringinfo_i_sc_ic,                         /*    890 */
-  Parrot_upcase_s_s,                                 /*    891 */
-  Parrot_upcase_s_sc,                                /*    892 */
-  Parrot_downcase_s_s,                               /*    893 */
-  Parrot_downcase_s_sc,                              /*    894 */
-  Parrot_titlecase_s_s,                              /*    895 */
-  Parrot_titlecase_s_sc,                             /*    896 */
-  Parrot_join_s_s_p,                                 /*    897 */
-  Parrot_join_s_sc_p,                                /*    898 */
-  Parrot_split_p_s_s,                                /*    899 */
-  Parrot_split_p_sc_s,                               /*    900 */
-  Parrot_split_p_s_sc,                               /*    901 */
-  Parrot_split_p_sc_sc,                              /*    902 */
-  Parrot_encoding_i_s,                               /*    903 */
-  Parrot_encoding_i_sc,                              /*    904 */
-  Parrot_encodingname_s_i,                           /*    905 */
-  Parrot_encodingname_s_ic,                          /*    906 */
-  Parrot_find_encoding_i_s,                          /*    907 */
-  Parrot_find_encoding_i_sc,                         /*    908 */
-  Parrot_trans_encoding_s_s_i,                       /*    909 */
-  Parrot_trans_encoding_s_sc_i,                      /*    910 */
-  Parrot_trans_encoding_s_s_ic,                      /*    911 */
-  Parrot_trans_encoding_s_sc_ic,                     /*    912 */
-  Parrot_is_cclass_i_i_s_i,                          /*    913 */
-  Parrot_is_cclass_i_ic_s_i,                         /*    914 */
-  Parrot_is_cclass_i_i_sc_i,                         /*    915 */
-  Parrot_is_cclass_i_ic_sc_i,                        /*    916 */
-  Parrot_is_cclass_i_i_s_ic,                         /*    917 */
-  Parrot_is_cclass_i_ic_s_ic,                        /*    918 */
-  Parrot_is_cclass_i_i_sc_ic,                        /*    919 */
-  Parrot_is_cclass_i_ic_sc_ic,                       /*    920 */
-  Parrot_find_cclass_i_i_s_i_i,                      /*    921 */
-  Parrot_find_cclass_i_ic_s_i_i,                     /*    922 */
-  Parrot_find_cclass_i_i_sc_i_i,                     /*    923 */
-  Parrot_find_cclass_i_ic_sc_i_i,                    /*    924 */
-  Parrot_find_cclass_i_i_s_ic_i,                     /*    925 */
-  Parrot_find_cclass_i_ic_s_ic_i,                    /*    926 */
-  Parrot_find_cclass_i_i_sc_ic_i,                    /*    927 */
-  Parrot_find_cclass_i_ic_sc_ic_i,                   /*    928 */
-  Parrot_find_cclass_i_i_s_i_ic,                     /*    929 */
-  Parrot_find_cclass_i_ic_s_i_ic,                    /*    930 */
-  Parrot_find_cclass_i_i_sc_i_ic,                    /*    931 */
-  Parrot_find_cclass_i_ic_sc_i_ic,                   /*    932 */
-  Parrot_find_cclass_i_i_s_ic_ic,                    /*    933 */
-  Parrot_find_cclass_i_ic_s_ic_ic,                   /*    934 */
-  Parrot_find_cclass_i_i_sc_ic_ic,                   /*    935 */
-  Parrot_find_cclass_i_ic_sc_ic_ic,                  /*    936 */
-  Parrot_find_not_cclass_i_i_s_i_i,                  /*    937 */
-  Parrot_find_not_cclass_i_ic_s_i_i,                 /*    938 */
-  Parrot_find_not_cclass_i_i_sc_i_i,                 /*    939 */
-  Parrot_find_not_cclass_i_ic_sc_i_i,                /*    940 */
-  Parrot_find_not_cclass_i_i_s_ic_i,                 /*    941 */
-  Parrot_find_not_cclass_i_ic_s_ic_i,                /*    942 */
-  Parrot_find_not_cclass_i_i_sc_ic_i,                /*    943 */
-  Parrot_find_not_cclass_i_ic_sc_ic_i,               /*    944 */
-  Parrot_find_not_cclass_i_i_s_i_ic,                 /*    945 */
-  Parrot_find_not_cclass_i_ic_s_i_ic,                /*    946 */
-  Parrot_find_not_cclass_i_i_sc_i_ic,                /*    947 */
-  Parrot_find_not_cclass_i_ic_sc_i_ic,               /*    948 */
-  Parrot_find_not_cclass_i_i_s_ic_ic,                /*    949 */
-  Parrot_find_not_cclass_i_ic_s_ic_ic,               /*    950 */
-  Parrot_find_not_cclass_i_i_sc_ic_ic,               /*    951 */
-  Parrot_find_not_cclass_i_ic_sc_ic_ic,              /*    952 */
-  Parrot_escape_s_s,                                 /*    953 */
-  Parrot_compose_s_s,                                /*    954 */
-  Parrot_compose_s_sc,                               /*    955 */
-  Parrot_find_codepoint_i_s,                         /*    956 */
-  Parrot_find_codepoint_i_sc,                        /*    957 */
-  Parrot_spawnw_i_s,                                 /*    958 */
-  Parrot_spawnw_i_sc,                                /*    959 */
-  Parrot_spawnw_i_p,                                 /*    960 */
-  Parrot_err_i,                                      /*    961 */
-  Parrot_err_s,                                      /*    962 */
-  Parrot_err_s_i,                                    /*    963 */
-  Parrot_err_s_ic,                                   /*    964 */
-  Parrot_time_i,                                     /*    965 */
-  Parrot_time_n,                                     /*    966 */
-  Parrot_sleep_i,                                    /*    967 */
-  Parrot_sleep_ic,                                   /*    968 */
-  Parrot_sleep_n,                                    /*    969 */
-  Parrot_sleep_nc,                                   /*    970 */
-  Parrot_store_lex_s_p,                              /*    971 */
-  Parrot_store_lex_sc_p,                             /*    972 */
-  Parrot_store_lex_s_s,                              /*    973 */
-  Parrot_store_lex_sc_s,                             /*    974 */
-  Parrot_store_lex_s_sc,                             /*    975 */
-  Parrot_store_lex_sc_sc,                            /*    976 */
-  Parrot_store_lex_s_i,                              /*    977 */
-  Parrot_store_lex_sc_i,                             /*    978 */
-  Parrot_store_lex_s_ic,                             /*    979 */
-  Parrot_store_lex_sc_ic,                            /*    980 */
-  Parrot_store_lex_s_n,                              /*    981 */
-  Parrot_store_lex_sc_n,                             /*    982 */
-  Parrot_store_lex_s_nc,                             /*    983 */
-  Parrot_store_lex_sc_nc,                            /*    984 */
-  Parrot_store_dynamic_lex_s_p,                      /*    985 */
-  Parrot_store_dynamic_lex_sc_p,                     /*    986 */
-  Parrot_find_lex_p_s,                               /*    987 */
-  Parrot_find_lex_p_sc,                              /*    988 */
-  Parrot_find_lex_s_s,                               /*    989 */
-  Parrot_find_lex_s_sc,                              /*    990 */
-  Parrot_find_lex_i_s,                               /*    991 */
-  Parrot_find_lex_i_sc,                              /*    992 */
-  Parrot_find_lex_n_s,                               /*    993 */
-  Parrot_find_lex_n_sc,                              /*    994 */
-  Parrot_find_dynamic_lex_p_s,                       /*    995 */
-  Parrot_find_dynamic_lex_p_sc,                      /*    996 */
-  Parrot_find_caller_lex_p_s,                        /*    997 */
-  Parrot_find_caller_lex_p_sc,                       /*    998 */
-  Parrot_get_namespace_p,                            /*    999 */
-  Parrot_get_namespace_p_p,                          /*   1000 */
-  Parrot_get_namespace_p_pc,                         /*   1001 */
-  Parrot_get_hll_namespace_p,                        /*   1002 */
-  Parrot_get_hll_namespace_p_p,                      /*   1003 */
-  Parrot_get_hll_namespace_p_pc,                     /*   1004 */
-  Parrot_get_root_namespace_p,                       /*   1005 */
-  Parrot_get_root_namespace_p_p,                     /*   1006 */
-  Parrot_get_root_namespace_p_pc,                    /*   1007 */
-  Parrot_get_global_p_s,                             /*   1008 */
-  Parrot_get_global_p_sc,                            /*   1009 */
-  Parrot_get_global_p_p_s,                           /*   1010 */
-  Parrot_get_global_p_pc_s,                          /*   1011 */
-  Parrot_get_global_p_p_sc,                          /*   1012 */
-  Parrot_get_global_p_pc_sc,                         /*   1013 */
-  Parrot_get_hll_global_p_s,                         /*   1014 */
-  Parrot_get_hll_global_p_sc,                        /*   1015 */
-  Parrot_get_hll_global_p_p_s,                       /*   1016 */
-  Parrot_get_hll_global_p_pc_s,                      /*   1017 */
-  Parrot_get_hll_global_p_p_sc,                      /*   1018 */
-  Parrot_get_hll_global_p_pc_sc,                     /*   1019 */
-  Parrot_get_root_global_p_s,                        /*   1020 */
-  Parrot_get_root_global_p_sc,                       /*   1021 */
-  Parrot_get_root_global_p_p_s,                      /*   1022 */
-  Parrot_get_root_global_p_pc_s,                     /*   1023 */
-  Parrot_get_root_global_p_p_sc,                     /*   1024 */
-  Parrot_get_root_global_p_pc_sc,                    /*   1025 */
-  Parrot_set_global_s_p,                             /*   1026 */
-  Parrot_set_global_sc_p,                            /*   1027 */
-  Parrot_set_global_p_s_p,                           /*   1028 */
-  Parrot_set_global_pc_s_p,                          /*   1029 */
-  Parrot_set_global_p_sc_p,                          /*   1030 */
-  Parrot_set_global_pc_sc_p,                         /*   1031 */
-  Parrot_set_hll_global_s_p,                         /*   1032 */
-  Parrot_set_hll_global_sc_p,                        /*   1033 */
-  Parrot_set_hll_global_p_s_p,                       /*   1034 */
-  Parrot_set_hll_global_pc_s_p,                      /*   1035 */
-  Parrot_set_hll_global_p_sc_p,                      /*   1036 */
-  Parrot_set_hll_global_pc_sc_p,                     /*   1037 */
-  Parrot_set_root_global_s_p,                        /*   1038 */
-  Parrot_set_root_global_sc_p,                       /*   1039 */
-  Parrot_set_root_global_p_s_p,                      /*   1040 */
-  Parrot_set_root_global_pc_s_p,                     /*   1041 */
-  Parrot_set_root_global_p_sc_p,                     /*   1042 */
-  Parrot_set_root_global_pc_sc_p,                    /*   1043 */
-  Parrot_find_name_p_s,                              /*   1044 */
-  Parrot_find_name_p_sc,                             /*   1045 */
-  Parrot_find_sub_not_null_p_s,                      /*   1046 */
-  Parrot_find_sub_not_null_p_sc,                     /*   1047 */
-  Parrot_trap,                                       /*   1048 */
-  Parrot_set_label_p_ic,                             /*   1049 */
-  Parrot_get_label_i_p,                              /*   1050 */
-  Parrot_get_id_i_p,                                 /*   1051 */
-  Parrot_get_id_i_pc,                                /*   1052 */
-  Parrot_fetch_p_p_p_p,                              /*   1053 */
-  Parrot_fetch_p_pc_p_p,                             /*   1054 */
-  Parrot_fetch_p_p_pc_p,                             /*   1055 */
-  Parrot_fetch_p_pc_pc_p,                            /*   1056 */
-  Parrot_fetch_p_p_p_pc,                             /*   1057 */
-  Parrot_fetch_p_pc_p_pc,                            /*   1058 */
-  Parrot_fetch_p_p_pc_pc,                            /*   1059 */
-  Parrot_fetch_p_pc_pc_pc,                           /*   1060 */
-  Parrot_fetch_p_p_i_p,                              /*   1061 */
-  Parrot_fetch_p_pc_i_p,                             /*   1062 */
-  Parrot_fetch_p_p_ic_p,                             /*   1063 */
-  Parrot_fetch_p_pc_ic_p,                            /*   1064 */
-  Parrot_fetch_p_p_i_pc,                             /*   1065 */
-  Parrot_fetch_p_pc_i_pc,                            /*   1066 */
-  Parrot_fetch_p_p_ic_pc,                            /*   1067 */
-  Parrot_fetch_p_pc_ic_pc,                           /*   1068 */
-  Parrot_fetch_p_p_s_p,                              /*   1069 */
-  Parrot_fetch_p_pc_s_p,                             /*   1070 */
-  Parrot_fetch_p_p_sc_p,                             /*   1071 */
-  Parrot_fetch_p_pc_sc_p,                            /*   1072 */
-  Parrot_fetch_p_p_s_pc,                             /*   1073 */
-  Parrot_fetch_p_pc_s_pc,                            /*   1074 */
-  Parrot_fetch_p_p_sc_pc,                            /*   1075 */
-  Parrot_fetch_p_pc_sc_pc,                           /*   1076 */
-  Parrot_vivify_p_p_p_p,                             /*   1077 */
-  Parrot_vivify_p_pc_p_p,                            /*   1078 */
-  Parrot_vivify_p_p_pc_p,                            /*   1079 */
-  Parrot_vivify_p_pc_pc_p,                           /*   1080 */
-  Parrot_vivify_p_p_p_pc,                            /*   1081 */
-  Parrot_vivify_p_pc_p_pc,                           /*   1082 */
-  Parrot_vivify_p_p_pc_pc,                           /*   1083 */
-  Parrot_vivify_p_pc_pc_pc,                          /*   1084 */
-  Parrot_vivify_p_p_i_p,                             /*   1085 */
-  Parrot_vivify_p_pc_i_p,                            /*   1086 */
-  Parrot_vivify_p_p_ic_p,                            /*   1087 */
-  Parrot_vivify_p_pc_ic_p,                           /*   1088 */
-  Parrot_vivify_p_p_i_pc,                            /*   1089 */
-  Parrot_vivify_p_pc_i_pc,                           /*   1090 */
-  Parrot_vivify_p_p_ic_pc,                           /*   1091 */
-  Parrot_vivify_p_pc_ic_pc,                          /*   1092 */
-  Parrot_vivify_p_p_s_p,                             /*   1093 */
-  Parrot_vivify_p_pc_s_p,                            /*   1094 */
-  Parrot_vivify_p_p_sc_p,                            /*   1095 */
-  Parrot_vivify_p_pc_sc_p,                           /*   1096 */
-  Parrot_vivify_p_p_s_pc,                            /*   1097 */
-  Parrot_vivify_p_pc_s_pc,                           /*   1098 */
-  Parrot_vivify_p_p_sc_pc,                           /*   1099 */
-  Parrot_vivify_p_pc_sc_pc,                          /*   1100 */
-  Parrot_new_p_s_i,                                  /*   1101 */
-  Parrot_new_p_sc_i,                                 /*   1102 */
-  Parrot_new_p_s_ic,                                 /*   1103 */
-  Parrot_new_p_sc_ic,                                /*   1104 */
-  Parrot_new_p_p_i,                                  /*   1105 */
-  Parrot_new_p_pc_i,                                 /*   1106 */
-  Parrot_new_p_p_ic,                                 /*   1107 */
-  Parrot_new_p_pc_ic,                                /*   1108 */
-  Parrot_root_new_p_p_i,                             /*   1109 */
-  Parrot_root_new_p_pc_i,                            /*   1110 */
-  Parrot_root_new_p_p_ic,                            /*   1111 */
-  Parrot_root_new_p_pc_ic,                           /*   1112 */
-  Parrot_get_context_p,                              /*   1113 */
-  Parrot_new_call_context_p,                         /*   1114 */
-  Parrot_invokecc_p_p,                               /*   1115 */
-  Parrot_flatten_array_into_p_p_i,                   /*   1116 */
-  Parrot_flatten_array_into_p_p_ic,                  /*   1117 */
-  Parrot_flatten_hash_into_p_p_i,                    /*   1118 */
-  Parrot_flatten_hash_into_p_p_ic,                   /*   1119 */
-  Parrot_slurp_array_from_p_p_i,                     /*   1120 */
-  Parrot_slurp_array_from_p_p_ic,                    /*   1121 */
-  Parrot_receive_p,                                  /*   1122 */
-  Parrot_wait_p,                                     /*   1123 */
-  Parrot_wait_pc,                                    /*   1124 */
-  Parrot_pass,                                       /*   1125 */
-  Parrot_disable_preemption,                         /*   1126 */
-  Parrot_enable_preemption,                          /*   1127 */
-  Parrot_terminate,                                  /*   1128 */
+  Parrot_freeze_p_p,                                 /*    677 */
+  Parrot_thaw_p_p,                                   /*    678 */
+  Parrot_add_multi_s_s_p,                            /*    679 */
+  Parrot_add_multi_sc_s_p,                           /*    680 */
+  Parrot_add_multi_s_sc_p,                           /*    681 */
+  Parrot_add_multi_sc_sc_p,                          /*    682 */
+  Parrot_find_multi_p_s_s,                           /*    683 */
+  Parrot_find_multi_p_sc_s,                          /*    684 */
+  Parrot_find_multi_p_s_sc,                          /*    685 */
+  Parrot_find_multi_p_sc_sc,                         /*    686 */
+  Parrot_register_p,                                 /*    687 */
+  Parrot_unregister_p,                               /*    688 */
+  Parrot_box_p_i,                                    /*    689 */
+  Parrot_box_p_ic,                                   /*    690 */
+  Parrot_box_p_n,                                    /*    691 */
+  Parrot_box_p_nc,                                   /*    692 */
+  Parrot_box_p_s,                                    /*    693 */
+  Parrot_box_p_sc,                                   /*    694 */
+  Parrot_iter_p_p,                                   /*    695 */
+  Parrot_morph_p_p,                                  /*    696 */
+  Parrot_morph_p_pc,                                 /*    697 */
+  Parrot_clone_s_s,                                  /*    698 */
+  Parrot_clone_s_sc,                                 /*    699 */
+  Parrot_set_i_i,                                    /*    700 */
+  Parrot_set_i_ic,                                   /*    701 */
+  Parrot_set_i_n,                                    /*    702 */
+  Parrot_set_i_nc,                                   /*    703 */
+  Parrot_set_i_s,                                    /*    704 */
+  Parrot_set_i_sc,                                   /*    705 */
+  Parrot_set_n_n,                                    /*    706 */
+  Parrot_set_n_nc,                                   /*    707 */
+  Parrot_set_n_i,                                    /*    708 */
+  Parrot_set_n_ic,                                   /*    709 */
+  Parrot_set_n_s,                                    /*    710 */
+  Parrot_set_n_sc,                                   /*    711 */
+  Parrot_set_n_p,                                    /*    712 */
+  Parrot_set_s_p,                                    /*    713 */
+  Parrot_set_s_s,                                    /*    714 */
+  Parrot_set_s_sc,                                   /*    715 */
+  Parrot_set_s_i,                                    /*    716 */
+  Parrot_set_s_ic,                                   /*    717 */
+  Parrot_set_s_n,                                    /*    718 */
+  Parrot_set_s_nc,                                   /*    719 */
+  Parrot_set_p_pc,                                   /*    720 */
+  Parrot_set_p_p,                                    /*    721 */
+  Parrot_set_p_i,                                    /*    722 */
+  Parrot_set_p_ic,                                   /*    723 */
+  Parrot_set_p_n,                                    /*    724 */
+  Parrot_set_p_nc,                                   /*    725 */
+  Parrot_set_p_s,                                    /*    726 */
+  Parrot_set_p_sc,                                   /*    727 */
+  Parrot_set_i_p,                                    /*    728 */
+  Parrot_assign_p_p,                                 /*    729 */
+  Parrot_assign_p_i,                                 /*    730 */
+  Parrot_assign_p_ic,                                /*    731 */
+  Parrot_assign_p_n,                                 /*    732 */
+  Parrot_assign_p_nc,                                /*    733 */
+  Parrot_assign_p_s,                                 /*    734 */
+  Parrot_assign_p_sc,                                /*    735 */
+  Parrot_assign_s_s,                                 /*    736 */
+  Parrot_assign_s_sc,                                /*    737 */
+  Parrot_setref_p_p,                                 /*    738 */
+  Parrot_deref_p_p,                                  /*    739 */
+  Parrot_set_p_ki_i,                                 /*    740 */
+  Parrot_set_p_kic_i,                                /*    741 */
+  Parrot_set_p_ki_ic,                                /*    742 */
+  Parrot_set_p_kic_ic,                               /*    743 */
+  Parrot_set_p_ki_n,                                 /*    744 */
+  Parrot_set_p_kic_n,                                /*    745 */
+  Parrot_set_p_ki_nc,                                /*    746 */
+  Parrot_set_p_kic_nc,                               /*    747 */
+  Parrot_set_p_ki_s,                                 /*    748 */
+  Parrot_set_p_kic_s,                                /*    749 */
+  Parrot_set_p_ki_sc,                                /*    750 */
+  Parrot_set_p_kic_sc,                               /*    751 */
+  Parrot_set_p_ki_p,                                 /*    752 */
+  Parrot_set_p_kic_p,                                /*    753 */
+  Parrot_set_i_p_ki,                                 /*    754 */
+  Parrot_set_i_p_kic,                                /*    755 */
+  Parrot_set_n_p_ki,                                 /*    756 */
+  Parrot_set_n_p_kic,                                /*    757 */
+  Parrot_set_s_p_ki,                                 /*    758 */
+  Parrot_set_s_p_kic,                                /*    759 */
+  Parrot_set_p_p_ki,                                 /*    760 */
+  Parrot_set_p_p_kic,                                /*    761 */
+  Parrot_set_p_k_i,                                  /*    762 */
+  Parrot_set_p_kc_i,                                 /*    763 */
+  Parrot_set_p_k_ic,                                 /*    764 */
+  Parrot_set_p_kc_ic,                                /*    765 */
+  Parrot_set_p_k_n,                                  /*    766 */
+  Parrot_set_p_kc_n,                                 /*    767 */
+  Parrot_set_p_k_nc,                                 /*    768 */
+  Parrot_set_p_kc_nc,                                /*    769 */
+  Parrot_set_p_k_s,                                  /*    770 */
+  Parrot_set_p_kc_s,                                 /*    771 */
+  Parrot_set_p_k_sc,                                 /*    772 */
+  Parrot_set_p_kc_sc,                                /*    773 */
+  Parrot_set_p_k_p,                                  /*    774 */
+  Parrot_set_p_kc_p,                                 /*    775 */
+  Parrot_set_i_p_k,                                  /*    776 */
+  Parrot_set_i_p_kc,                                 /*    777 */
+  Parrot_set_n_p_k,                                  /*    778 */
+  Parrot_set_n_p_kc,                                 /*    779 */
+  Parrot_set_s_p_k,                                  /*    780 */
+  Parrot_set_s_p_kc,                                 /*    781 */
+  Parrot_set_p_p_k,                                  /*    782 */
+  Parrot_set_p_p_kc,                                 /*    783 */
+  Parrot_clone_p_p,                                  /*    784 */
+  Parrot_clone_p_p_p,                                /*    785 */
+  Parrot_clone_p_p_pc,                               /*    786 */
+  Parrot_copy_p_p,                                   /*    787 */
+  Parrot_null_s,                                     /*    788 */
+  Parrot_null_i,                                     /*    789 */
+  Parrot_null_p,                                     /*    790 */
+  Parrot_null_n,                                     /*    791 */
+  Parrot_ord_i_s,                                    /*    792 */
+  Parrot_ord_i_sc,                                   /*    793 */
+  Parrot_ord_i_s_i,                                  /*    794 */
+  Parrot_ord_i_sc_i,                                 /*    795 */
+  Parrot_ord_i_s_ic,                                 /*    796 */
+  Parrot_ord_i_sc_ic,                                /*    797 */
+  Parrot_chr_s_i,                                    /*    798 */
+  Parrot_chr_s_ic,                                   /*    799 */
+  Parrot_chopn_s_s_i,                                /*    800 */
+  Parrot_chopn_s_sc_i,                               /*    801 */
+  Parrot_chopn_s_s_ic,                               /*    802 */
+  Parrot_chopn_s_sc_ic,                              /*    803 */
+  Parrot_concat_p_p,                                 /*    804 */
+  Parrot_concat_p_s,                                 /*    805 */
+  Parrot_concat_p_sc,                                /*    806 */
+  Parrot_concat_s_s_s,                               /*    807 */
+  Parrot_concat_s_sc_s,                              /*    808 */
+  Parrot_concat_s_s_sc,                              /*    809 */
+  Parrot_concat_p_p_s,                               /*    810 */
+  Parrot_concat_p_p_sc,                              /*    811 */
+  Parrot_concat_p_p_p,                               /*    812 */
+  Parrot_repeat_s_s_i,                               /*    813 */
+  Parrot_repeat_s_sc_i,                              /*    814 */
+  Parrot_repeat_s_s_ic,                              /*    815 */
+  Parrot_repeat_s_sc_ic,                             /*    816 */
+  Parrot_repeat_p_p_i,                               /*    817 */
+  Parrot_repeat_p_p_ic,                              /*    818 */
+  Parrot_repeat_p_p_p,                               /*    819 */
+  Parrot_repeat_p_i,                                 /*    820 */
+  Parrot_repeat_p_ic,                                /*    821 */
+  Parrot_repeat_p_p,                                 /*    822 */
+  Parrot_length_i_s,                                 /*    823 */
+  Parrot_length_i_sc,                                /*    824 */
+  Parrot_bytelength_i_s,                             /*    825 */
+  Parrot_bytelength_i_sc,                            /*    826 */
+  Parrot_pin_s,                                      /*    827 */
+  Parrot_unpin_s,                                    /*    828 */
+  Parrot_substr_s_s_i,                               /*    829 */
+  Parrot_substr_s_sc_i,                              /*    830 */
+  Parrot_substr_s_s_ic,                              /*    831 */
+  Parrot_substr_s_sc_ic,                             /*    832 */
+  Parrot_substr_s_s_i_i,                             /*    833 */
+  Parrot_substr_s_sc_i_i,                            /*    834 */
+  Parrot_substr_s_s_ic_i,                            /*    835 */
+  Parrot_substr_s_sc_ic_i,                           /*    836 */
+  Parrot_substr_s_s_i_ic,                            /*    837 */
+  Parrot_substr_s_sc_i_ic,                           /*    838 */
+  Parrot_substr_s_s_ic_ic,                           /*    839 */
+  Parrot_substr_s_sc_ic_ic,                          /*    840 */
+  Parrot_substr_s_p_i_i,                             /*    841 */
+  Parrot_substr_s_p_ic_i,                            /*    842 */
+  Parrot_substr_s_p_i_ic,                            /*    843 */
+  Parrot_substr_s_p_ic_ic,                           /*    844 */
+  Parrot_replace_s_s_i_i_s,                          /*    845 */
+  Parrot_replace_s_sc_i_i_s,                         /*    846 */
+  Parrot_replace_s_s_ic_i_s,                         /*    847 */
+  Parrot_replace_s_sc_ic_i_s,                        /*    848 */
+  Parrot_replace_s_s_i_ic_s,                         /*    849 */
+  Parrot_replace_s_sc_i_ic_s,                        /*    850 */
+  Parrot_replace_s_s_ic_ic_s,                        /*    851 */
+  Parrot_replace_s_sc_ic_ic_s,                       /*    852 */
+  Parrot_replace_s_s_i_i_sc,                         /*    853 */
+  Parrot_replace_s_sc_i_i_sc,                        /*    854 */
+  Parrot_replace_s_s_ic_i_sc,                        /*    855 */
+  Parrot_replace_s_sc_ic_i_sc,                       /*    856 */
+  Parrot_replace_s_s_i_ic_sc,                        /*    857 */
+  Parrot_replace_s_sc_i_ic_sc,                       /*    858 */
+  Parrot_replace_s_s_ic_ic_sc,                       /*    859 */
+  Parrot_replace_s_sc_ic_ic_sc,                      /*    860 */
+  Parrot_index_i_s_s,                                /*    861 */
+  Parrot_index_i_sc_s,                               /*    862 */
+  Parrot_index_i_s_sc,                               /*    863 */
+  Parrot_index_i_sc_sc,                              /*    864 */
+  Parrot_index_i_s_s_i,                              /*    865 */
+  Parrot_index_i_sc_s_i,                             /*    866 */
+  Parrot_index_i_s_sc_i,                             /*    867 */
+  Parrot_index_i_sc_sc_i,                            /*    868 */
+  Parrot_index_i_s_s_ic,                             /*    869 */
+  Parrot_index_i_sc_s_ic,                            /*    870 */
+  Parrot_index_i_s_sc_ic,                            /*    871 */
+  Parrot_index_i_sc_sc_ic,                           /*    872 */
+  Parrot_rindex_i_s_s,                               /*    873 */
+  Parrot_rindex_i_sc_s,                              /*    874 */
+  Parrot_rindex_i_s_sc,                              /*    875 */
+  Parrot_rindex_i_sc_sc,                             /*    876 */
+  Parrot_rindex_i_s_s_i,                             /*    877 */
+  Parrot_rindex_i_sc_s_i,                            /*    878 */
+  Parrot_rindex_i_s_sc_i,                            /*    879 */
+  Parrot_rindex_i_sc_sc_i,                           /*    880 */
+  Parrot_rindex_i_s_s_ic,                            /*    881 */
+  Parrot_rindex_i_sc_s_ic,                           /*    882 */
+  Parrot_rindex_i_s_sc_ic,                           /*    883 */
+  Parrot_rindex_i_sc_sc_ic,                          /*    884 */
+  Parrot_sprintf_s_s_p,                              /*    885 */
+  Parrot_sprintf_s_sc_p,                             /*    886 */
+  Parrot_sprintf_p_p_p,                              /*    887 */
+  Parrot_new_s,                                      /*    888 */
+  Parrot_stringinfo_i_s_i,                           /*    889 */
+  Parrot_stringinfo_i_sc_i,                          /*    890 */
+  Parrot_stringinfo_i_s_ic,                          /*    891 */
+  Parrot_stringinfo_i_sc_ic,                         /*    892 */
+  Parrot_upcase_s_s,                                 /*    893 */
+  Parrot_upcase_s_sc,                                /*    894 */
+  Parrot_downcase_s_s,                               /*    895 */
+  Parrot_downcase_s_sc,                              /*    896 */
+  Parrot_titlecase_s_s,                              /*    897 */
+  Parrot_titlecase_s_sc,                             /*    898 */
+  Parrot_join_s_s_p,                                 /*    899 */
+  Parrot_join_s_sc_p,                                /*    900 */
+  Parrot_split_p_s_s,                                /*    901 */
+  Parrot_split_p_sc_s,                               /*    902 */
+  Parrot_split_p_s_sc,                               /*    903 */
+  Parrot_split_p_sc_sc,                              /*    904 */
+  Parrot_encoding_i_s,                               /*    905 */
+  Parrot_encoding_i_sc,                              /*    906 */
+  Parrot_encodingname_s_i,                           /*    907 */
+  Parrot_encodingname_s_ic,                          /*    908 */
+  Parrot_find_encoding_i_s,                          /*    909 */
+  Parrot_find_encoding_i_sc,                         /*    910 */
+  Parrot_trans_encoding_s_s_i,                       /*    911 */
+  Parrot_trans_encoding_s_sc_i,                      /*    912 */
+  Parrot_trans_encoding_s_s_ic,                      /*    913 */
+  Parrot_trans_encoding_s_sc_ic,                     /*    914 */
+  Parrot_is_cclass_i_i_s_i,                          /*    915 */
+  Parrot_is_cclass_i_ic_s_i,                         /*    916 */
+  Parrot_is_cclass_i_i_sc_i,                         /*    917 */
+  Parrot_is_cclass_i_ic_sc_i,                        /*    918 */
+  Parrot_is_cclass_i_i_s_ic,                         /*    919 */
+  Parrot_is_cclass_i_ic_s_ic,                        /*    920 */
+  Parrot_is_cclass_i_i_sc_ic,                        /*    921 */
+  Parrot_is_cclass_i_ic_sc_ic,                       /*    922 */
+  Parrot_find_cclass_i_i_s_i_i,                      /*    923 */
+  Parrot_find_cclass_i_ic_s_i_i,                     /*    924 */
+  Parrot_find_cclass_i_i_sc_i_i,                     /*    925 */
+  Parrot_find_cclass_i_ic_sc_i_i,                    /*    926 */
+  Parrot_find_cclass_i_i_s_ic_i,                     /*    927 */
+  Parrot_find_cclass_i_ic_s_ic_i,                    /*    928 */
+  Parrot_find_cclass_i_i_sc_ic_i,                    /*    929 */
+  Parrot_find_cclass_i_ic_sc_ic_i,                   /*    930 */
+  Parrot_find_cclass_i_i_s_i_ic,                     /*    931 */
+  Parrot_find_cclass_i_ic_s_i_ic,                    /*    932 */
+  Parrot_find_cclass_i_i_sc_i_ic,                    /*    933 */
+  Parrot_find_cclass_i_ic_sc_i_ic,                   /*    934 */
+  Parrot_find_cclass_i_i_s_ic_ic,                    /*    935 */
+  Parrot_find_cclass_i_ic_s_ic_ic,                   /*    936 */
+  Parrot_find_cclass_i_i_sc_ic_ic,                   /*    937 */
+  Parrot_find_cclass_i_ic_sc_ic_ic,                  /*    938 */
+  Parrot_find_not_cclass_i_i_s_i_i,                  /*    939 */
+  Parrot_find_not_cclass_i_ic_s_i_i,                 /*    940 */
+  Parrot_find_not_cclass_i_i_sc_i_i,                 /*    941 */
+  Parrot_find_not_cclass_i_ic_sc_i_i,                /*    942 */
+  Parrot_find_not_cclass_i_i_s_ic_i,                 /*    943 */
+  Parrot_find_not_cclass_i_ic_s_ic_i,                /*    944 */
+  Parrot_find_not_cclass_i_i_sc_ic_i,                /*    945 */
+  Parrot_find_not_cclass_i_ic_sc_ic_i,               /*    946 */
+  Parrot_find_not_cclass_i_i_s_i_ic,                 /*    947 */
+  Parrot_find_not_cclass_i_ic_s_i_ic,                /*    948 */
+  Parrot_find_not_cclass_i_i_sc_i_ic,                /*    949 */
+  Parrot_find_not_cclass_i_ic_sc_i_ic,               /*    950 */
+  Parrot_find_not_cclass_i_i_s_ic_ic,                /*    951 */
+  Parrot_find_not_cclass_i_ic_s_ic_ic,               /*    952 */
+  Parrot_find_not_cclass_i_i_sc_ic_ic,               /*    953 */
+  Parrot_find_not_cclass_i_ic_sc_ic_ic,              /*    954 */
+  Parrot_escape_s_s,                                 /*    955 */
+  Parrot_compose_s_s,                                /*    956 */
+  Parrot_compose_s_sc,                               /*    957 */
+  Parrot_find_codepoint_i_s,                         /*    958 */
+  Parrot_find_codepoint_i_sc,                        /*    959 */
+  Parrot_spawnw_i_s,                                 /*    960 */
+  Parrot_spawnw_i_sc,                                /*    961 */
+  Parrot_spawnw_i_p,                                 /*    962 */
+  Parrot_err_i,                                      /*    963 */
+  Parrot_err_s,                                      /*    964 */
+  Parrot_err_s_i,                                    /*    965 */
+  Parrot_err_s_ic,                                   /*    966 */
+  Parrot_time_i,                                     /*    967 */
+  Parrot_time_n,                                     /*    968 */
+  Parrot_sleep_i,                                    /*    969 */
+  Parrot_sleep_ic,                                   /*    970 */
+  Parrot_sleep_n,                                    /*    971 */
+  Parrot_sleep_nc,                                   /*    972 */
+  Parrot_store_lex_s_p,                              /*    973 */
+  Parrot_store_lex_sc_p,                             /*    974 */
+  Parrot_store_lex_s_s,                              /*    975 */
+  Parrot_store_lex_sc_s,                             /*    976 */
+  Parrot_store_lex_s_sc,                             /*    977 */
+  Parrot_store_lex_sc_sc,                            /*    978 */
+  Parrot_store_lex_s_i,                              /*    979 */
+  Parrot_store_lex_sc_i,                             /*    980 */
+  Parrot_store_lex_s_ic,                             /*    981 */
+  Parrot_store_lex_sc_ic,                            /*    982 */
+  Parrot_store_lex_s_n,                              /*    983 */
+  Parrot_store_lex_sc_n,                             /*    984 */
+  Parrot_store_lex_s_nc,                             /*    985 */
+  Parrot_store_lex_sc_nc,                            /*    986 */
+  Parrot_store_dynamic_lex_s_p,                      /*    987 */
+  Parrot_store_dynamic_lex_sc_p,                     /*    988 */
+  Parrot_find_lex_p_s,                               /*    989 */
+  Parrot_find_lex_p_sc,                              /*    990 */
+  Parrot_find_lex_s_s,                               /*    991 */
+  Parrot_find_lex_s_sc,                              /*    992 */
+  Parrot_find_lex_i_s,                               /*    993 */
+  Parrot_find_lex_i_sc,                              /*    994 */
+  Parrot_find_lex_n_s,                               /*    995 */
+  Parrot_find_lex_n_sc,                              /*    996 */
+  Parrot_find_lex_slot_p_s_ic_ic,                    /*    997 */
+  Parrot_find_lex_slot_p_sc_ic_ic,                   /*    998 */
+  Parrot_find_lex_slot_s_s_ic_ic,                    /*    999 */
+  Parrot_find_lex_slot_s_sc_ic_ic,                   /*   1000 */
+  Parrot_find_lex_slot_i_s_ic_ic,                    /*   1001 */
+  Parrot_find_lex_slot_i_sc_ic_ic,                   /*   1002 */
+  Parrot_find_lex_slot_n_s_ic_ic,                    /*   1003 */
+  Parrot_find_lex_slot_n_sc_ic_ic,                   /*   1004 */
+  Parrot_store_lex_slot_s_p_ic_ic,                   /*   1005 */
+  Parrot_store_lex_slot_sc_p_ic_ic,                  /*   1006 */
+  Parrot_store_lex_slot_s_s_ic_ic,                   /*   1007 */
+  Parrot_store_lex_slot_sc_s_ic_ic,                  /*   1008 */
+  Parrot_store_lex_slot_s_sc_ic_ic,                  /*   1009 */
+  Parrot_store_lex_slot_sc_sc_ic_ic,                 /*   1010 */
+  Parrot_store_lex_slot_s_i_ic_ic,                   /*   1011 */
+  Parrot_store_lex_slot_sc_i_ic_ic,                  /*   1012 */
+  Parrot_store_lex_slot_s_ic_ic_ic,                  /*   1013 */
+  Parrot_store_lex_slot_sc_ic_ic_ic,                 /*   1014 */
+  Parrot_store_lex_slot_s_n_ic_ic,                   /*   1015 */
+  Parrot_store_lex_slot_sc_n_ic_ic,                  /*   1016 */
+  Parrot_store_lex_slot_s_nc_ic_ic,                  /*   1017 */
+  Parrot_store_lex_slot_sc_nc_ic_ic,                 /*   1018 */
+  Parrot_find_dynamic_lex_p_s,                       /*   1019 */
+  Parrot_find_dynamic_lex_p_sc,                      /*   1020 */
+  Parrot_find_caller_lex_p_s,                        /*   1021 */
+  Parrot_find_caller_lex_p_sc,                       /*   1022 */
+  Parrot_get_namespace_p,                            /*   1023 */
+  Parrot_get_namespace_p_p,                          /*   1024 */
+  Parrot_get_namespace_p_pc,                         /*   1025 */
+  Parrot_get_hll_namespace_p,                        /*   1026 */
+  Parrot_get_hll_namespace_p_p,                      /*   1027 */
+  Parrot_get_hll_namespace_p_pc,                     /*   1028 */
+  Parrot_get_root_namespace_p,                       /*   1029 */
+  Parrot_get_root_namespace_p_p,                     /*   1030 */
+  Parrot_get_root_namespace_p_pc,                    /*   1031 */
+  Parrot_get_global_p_s,                             /*   1032 */
+  Parrot_get_global_p_sc,                            /*   1033 */
+  Parrot_get_global_p_p_s,                           /*   1034 */
+  Parrot_get_global_p_pc_s,                          /*   1035 */
+  Parrot_get_global_p_p_sc,                          /*   1036 */
+  Parrot_get_global_p_pc_sc,                         /*   1037 */
+  Parrot_get_hll_global_p_s,                         /*   1038 */
+  Parrot_get_hll_global_p_sc,                        /*   1039 */
+  Parrot_get_hll_global_p_p_s,                       /*   1040 */
+  Parrot_get_hll_global_p_pc_s,                      /*   1041 */
+  Parrot_get_hll_global_p_p_sc,                      /*   1042 */
+  Parrot_get_hll_global_p_pc_sc,                     /*   1043 */
+  Parrot_get_root_global_p_s,                        /*   1044 */
+  Parrot_get_root_global_p_sc,                       /*   1045 */
+  Parrot_get_root_global_p_p_s,                      /*   1046 */
+  Parrot_get_root_global_p_pc_s,                     /*   1047 */
+  Parrot_get_root_global_p_p_sc,                     /*   1048 */
+  Parrot_get_root_global_p_pc_sc,                    /*   1049 */
+  Parrot_set_global_s_p,                             /*   1050 */
+  Parrot_set_global_sc_p,                            /*   1051 */
+  Parrot_set_global_p_s_p,                           /*   1052 */
+  Parrot_set_global_pc_s_p,                          /*   1053 */
+  Parrot_set_global_p_sc_p,                          /*   1054 */
+  Parrot_set_global_pc_sc_p,                         /*   1055 */
+  Parrot_set_hll_global_s_p,                         /*   1056 */
+  Parrot_set_hll_global_sc_p,                        /*   1057 */
+  Parrot_set_hll_global_p_s_p,                       /*   1058 */
+  Parrot_set_hll_global_pc_s_p,                      /*   1059 */
+  Parrot_set_hll_global_p_sc_p,                      /*   1060 */
+  Parrot_set_hll_global_pc_sc_p,                     /*   1061 */
+  Parrot_set_root_global_s_p,                        /*   1062 */
+  Parrot_set_root_global_sc_p,                       /*   1063 */
+  Parrot_set_root_global_p_s_p,                      /*   1064 */
+  Parrot_set_root_global_pc_s_p,                     /*   1065 */
+  Parrot_set_root_global_p_sc_p,                     /*   1066 */
+  Parrot_set_root_global_pc_sc_p,                    /*   1067 */
+  Parrot_find_name_p_s,                              /*   1068 */
+  Parrot_find_name_p_sc,                             /*   1069 */
+  Parrot_find_sub_not_null_p_s,                      /*   1070 */
+  Parrot_find_sub_not_null_p_sc,                     /*   1071 */
+  Parrot_trap,                                       /*   1072 */
+  Parrot_set_label_p_ic,                             /*   1073 */
+  Parrot_get_label_i_p,                              /*   1074 */
+  Parrot_get_id_i_p,                                 /*   1075 */
+  Parrot_get_id_i_pc,                                /*   1076 */
+  Parrot_fetch_p_p_p_p,                              /*   1077 */
+  Parrot_fetch_p_pc_p_p,                             /*   1078 */
+  Parrot_fetch_p_p_pc_p,                             /*   1079 */
+  Parrot_fetch_p_pc_pc_p,                            /*   1080 */
+  Parrot_fetch_p_p_p_pc,                             /*   1081 */
+  Parrot_fetch_p_pc_p_pc,                            /*   1082 */
+  Parrot_fetch_p_p_pc_pc,                            /*   1083 */
+  Parrot_fetch_p_pc_pc_pc,                           /*   1084 */
+  Parrot_fetch_p_p_i_p,                              /*   1085 */
+  Parrot_fetch_p_pc_i_p,                             /*   1086 */
+  Parrot_fetch_p_p_ic_p,                             /*   1087 */
+  Parrot_fetch_p_pc_ic_p,                            /*   1088 */
+  Parrot_fetch_p_p_i_pc,                             /*   1089 */
+  Parrot_fetch_p_pc_i_pc,                            /*   1090 */
+  Parrot_fetch_p_p_ic_pc,                            /*   1091 */
+  Parrot_fetch_p_pc_ic_pc,                           /*   1092 */
+  Parrot_fetch_p_p_s_p,                              /*   1093 */
+  Parrot_fetch_p_pc_s_p,                             /*   1094 */
+  Parrot_fetch_p_p_sc_p,                             /*   1095 */
+  Parrot_fetch_p_pc_sc_p,                            /*   1096 */
+  Parrot_fetch_p_p_s_pc,                             /*   1097 */
+  Parrot_fetch_p_pc_s_pc,                            /*   1098 */
+  Parrot_fetch_p_p_sc_pc,                            /*   1099 */
+  Parrot_fetch_p_pc_sc_pc,                           /*   1100 */
+  Parrot_vivify_p_p_p_p,                             /*   1101 */
+  Parrot_vivify_p_pc_p_p,                            /*   1102 */
+  Parrot_vivify_p_p_pc_p,                            /*   1103 */
+  Parrot_vivify_p_pc_pc_p,                           /*   1104 */
+  Parrot_vivify_p_p_p_pc,                            /*   1105 */
+  Parrot_vivify_p_pc_p_pc,                           /*   1106 */
+  Parrot_vivify_p_p_pc_pc,                           /*   1107 */
+  Parrot_vivify_p_pc_pc_pc,                          /*   1108 */
+  Parrot_vivify_p_p_i_p,                             /*   1109 */
+  Parrot_vivify_p_pc_i_p,                            /*   1110 */
+  Parrot_vivify_p_p_ic_p,                            /*   1111 */
+  Parrot_vivify_p_pc_ic_p,                           /*   1112 */
+  Parrot_vivify_p_p_i_pc,                            /*   1113 */
+  Parrot_vivify_p_pc_i_pc,                           /*   1114 */
+  Parrot_vivify_p_p_ic_pc,                           /*   1115 */
+  Parrot_vivify_p_pc_ic_pc,                          /*   1116 */
+  Parrot_vivify_p_p_s_p,                             /*   1117 */
+  Parrot_vivify_p_pc_s_p,                            /*   1118 */
+  Parrot_vivify_p_p_sc_p,                            /*   1119 */
+  Parrot_vivify_p_pc_sc_p,                           /*   1120 */
+  Parrot_vivify_p_p_s_pc,                            /*   1121 */
+  Parrot_vivify_p_pc_s_pc,                           /*   1122 */
+  Parrot_vivify_p_p_sc_pc,                           /*   1123 */
+  Parrot_vivify_p_pc_sc_pc,                          /*   1124 */
+  Parrot_new_p_s_i,                                  /*   1125 */
+  Parrot_new_p_sc_i,                                 /*   1126 */
+  Parrot_new_p_s_ic,                                 /*   1127 */
+  Parrot_new_p_sc_ic,                                /*   1128 */
+  Parrot_new_p_p_i,                                  /*   1129 */
+  Parrot_new_p_pc_i,                                 /*   1130 */
+  Parrot_new_p_p_ic,                                 /*   1131 */
+  Parrot_new_p_pc_ic,                                /*   1132 */
+  Parrot_root_new_p_p_i,                             /*   1133 */
+  Parrot_root_new_p_pc_i,                            /*   1134 */
+  Parrot_root_new_p_p_ic,                            /*   1135 */
+  Parrot_root_new_p_pc_ic,                           /*   1136 */
+  Parrot_get_context_p,                              /*   1137 */
+  Parrot_new_call_context_p,                         /*   1138 */
+  Parrot_invokecc_p_p,                               /*   1139 */
+  Parrot_flatten_array_into_p_p_i,                   /*   1140 */
+  Parrot_flatten_array_into_p_p_ic,                  /*   1141 */
+  Parrot_flatten_hash_into_p_p_i,                    /*   1142 */
+  Parrot_flatten_hash_into_p_p_ic,                   /*   1143 */
+  Parrot_slurp_array_from_p_p_i,                     /*   1144 */
+  Parrot_slurp_array_from_p_p_ic,                    /*   1145 */
+  Parrot_receive_p,                                  /*   1146 */
+  Parrot_wait_p,                                     /*   1147 */
+  Parrot_wait_pc,                                    /*   1148 */
+  Parrot_pass,                                       /*   1149 */
+  Parrot_disable_preemption,                         /*   1150 */
+  Parrot_enable_preemption,                          /*   1151 */
+  Parrot_terminate,                                  /*   1152 */
 
   NULL /* NULL function pointer */
 };
@@ -1224,7 +1248,7 @@ static op_func_t core_op_func_table[1130] = {
 ** Op Info Table:
 */
 
-static op_info_t core_op_info_table[1130] = {
+static op_info_t core_op_info_table[1154] = {
   { /* 0 */
     "end",
     "end",
@@ -8673,6 +8697,28 @@ static op_info_t core_op_info_table[1130] = {
     &core_op_lib
   },
   { /* 677 */
+    "freeze",
+    "freeze_p_p",
+    "Parrot_freeze_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 678 */
+    "thaw",
+    "thaw_p_p",
+    "Parrot_thaw_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 679 */
     "add_multi",
     "add_multi_s_s_p",
     "Parrot_add_multi_s_s_p",
@@ -8683,7 +8729,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 678 */
+  { /* 680 */
     "add_multi",
     "add_multi_sc_s_p",
     "Parrot_add_multi_sc_s_p",
@@ -8694,7 +8740,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 679 */
+  { /* 681 */
     "add_multi",
     "add_multi_s_sc_p",
     "Parrot_add_multi_s_sc_p",
@@ -8705,7 +8751,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 680 */
+  { /* 682 */
     "add_multi",
     "add_multi_sc_sc_p",
     "Parrot_add_multi_sc_sc_p",
@@ -8716,7 +8762,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 681 */
+  { /* 683 */
     "find_multi",
     "find_multi_p_s_s",
     "Parrot_find_multi_p_s_s",
@@ -8727,7 +8773,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 682 */
+  { /* 684 */
     "find_multi",
     "find_multi_p_sc_s",
     "Parrot_find_multi_p_sc_s",
@@ -8738,7 +8784,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 683 */
+  { /* 685 */
     "find_multi",
     "find_multi_p_s_sc",
     "Parrot_find_multi_p_s_sc",
@@ -8749,7 +8795,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 684 */
+  { /* 686 */
     "find_multi",
     "find_multi_p_sc_sc",
     "Parrot_find_multi_p_sc_sc",
@@ -8760,7 +8806,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 685 */
+  { /* 687 */
     "register",
     "register_p",
     "Parrot_register_p",
@@ -8771,7 +8817,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 686 */
+  { /* 688 */
     "unregister",
     "unregister_p",
     "Parrot_unregister_p",
@@ -8782,7 +8828,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 687 */
+  { /* 689 */
     "box",
     "box_p_i",
     "Parrot_box_p_i",
@@ -8793,7 +8839,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 688 */
+  { /* 690 */
     "box",
     "box_p_ic",
     "Parrot_box_p_ic",
@@ -8804,7 +8850,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 689 */
+  { /* 691 */
     "box",
     "box_p_n",
     "Parrot_box_p_n",
@@ -8815,7 +8861,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 690 */
+  { /* 692 */
     "box",
     "box_p_nc",
     "Parrot_box_p_nc",
@@ -8826,7 +8872,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 691 */
+  { /* 693 */
     "box",
     "box_p_s",
     "Parrot_box_p_s",
@@ -8837,7 +8883,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 692 */
+  { /* 694 */
     "box",
     "box_p_sc",
     "Parrot_box_p_sc",
@@ -8848,7 +8894,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 693 */
+  { /* 695 */
     "iter",
     "iter_p_p",
     "Parrot_iter_p_p",
@@ -8859,7 +8905,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 694 */
+  { /* 696 */
     "morph",
     "morph_p_p",
     "Parrot_morph_p_p",
@@ -8870,7 +8916,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 695 */
+  { /* 697 */
     "morph",
     "morph_p_pc",
     "Parrot_morph_p_pc",
@@ -8881,7 +8927,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 696 */
+  { /* 698 */
     "clone",
     "clone_s_s",
     "Parrot_clone_s_s",
@@ -8892,7 +8938,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 697 */
+  { /* 699 */
     "clone",
     "clone_s_sc",
     "Parrot_clone_s_sc",
@@ -8903,7 +8949,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 698 */
+  { /* 700 */
     "set",
     "set_i_i",
     "Parrot_set_i_i",
@@ -8914,7 +8960,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 699 */
+  { /* 701 */
     "set",
     "set_i_ic",
     "Parrot_set_i_ic",
@@ -8925,7 +8971,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 700 */
+  { /* 702 */
     "set",
     "set_i_n",
     "Parrot_set_i_n",
@@ -8936,7 +8982,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 701 */
+  { /* 703 */
     "set",
     "set_i_nc",
     "Parrot_set_i_nc",
@@ -8947,7 +8993,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 702 */
+  { /* 704 */
     "set",
     "set_i_s",
     "Parrot_set_i_s",
@@ -8958,7 +9004,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 703 */
+  { /* 705 */
     "set",
     "set_i_sc",
     "Parrot_set_i_sc",
@@ -8969,7 +9015,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 704 */
+  { /* 706 */
     "set",
     "set_n_n",
     "Parrot_set_n_n",
@@ -8980,7 +9026,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 705 */
+  { /* 707 */
     "set",
     "set_n_nc",
     "Parrot_set_n_nc",
@@ -8991,7 +9037,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 706 */
+  { /* 708 */
     "set",
     "set_n_i",
     "Parrot_set_n_i",
@@ -9002,7 +9048,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 707 */
+  { /* 709 */
     "set",
     "set_n_ic",
     "Parrot_set_n_ic",
@@ -9013,7 +9059,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 708 */
+  { /* 710 */
     "set",
     "set_n_s",
     "Parrot_set_n_s",
@@ -9024,7 +9070,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 709 */
+  { /* 711 */
     "set",
     "set_n_sc",
     "Parrot_set_n_sc",
@@ -9035,7 +9081,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 710 */
+  { /* 712 */
     "set",
     "set_n_p",
     "Parrot_set_n_p",
@@ -9046,7 +9092,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 711 */
+  { /* 713 */
     "set",
     "set_s_p",
     "Parrot_set_s_p",
@@ -9057,7 +9103,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 712 */
+  { /* 714 */
     "set",
     "set_s_s",
     "Parrot_set_s_s",
@@ -9068,7 +9114,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 713 */
+  { /* 715 */
     "set",
     "set_s_sc",
     "Parrot_set_s_sc",
@@ -9079,7 +9125,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 714 */
+  { /* 716 */
     "set",
     "set_s_i",
     "Parrot_set_s_i",
@@ -9090,7 +9136,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 715 */
+  { /* 717 */
     "set",
     "set_s_ic",
     "Parrot_set_s_ic",
@@ -9101,7 +9147,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 716 */
+  { /* 718 */
     "set",
     "set_s_n",
     "Parrot_set_s_n",
@@ -9112,7 +9158,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 717 */
+  { /* 719 */
     "set",
     "set_s_nc",
     "Parrot_set_s_nc",
@@ -9123,7 +9169,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 718 */
+  { /* 720 */
     "set",
     "set_p_pc",
     "Parrot_set_p_pc",
@@ -9134,7 +9180,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 719 */
+  { /* 721 */
     "set",
     "set_p_p",
     "Parrot_set_p_p",
@@ -9145,7 +9191,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 720 */
+  { /* 722 */
     "set",
     "set_p_i",
     "Parrot_set_p_i",
@@ -9156,7 +9202,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 721 */
+  { /* 723 */
     "set",
     "set_p_ic",
     "Parrot_set_p_ic",
@@ -9167,7 +9213,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 722 */
+  { /* 724 */
     "set",
     "set_p_n",
     "Parrot_set_p_n",
@@ -9178,7 +9224,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 723 */
+  { /* 725 */
     "set",
     "set_p_nc",
     "Parrot_set_p_nc",
@@ -9189,7 +9235,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 724 */
+  { /* 726 */
     "set",
     "set_p_s",
     "Parrot_set_p_s",
@@ -9200,7 +9246,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 725 */
+  { /* 727 */
     "set",
     "set_p_sc",
     "Parrot_set_p_sc",
@@ -9211,7 +9257,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 726 */
+  { /* 728 */
     "set",
     "set_i_p",
     "Parrot_set_i_p",
@@ -9222,7 +9268,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 727 */
+  { /* 729 */
     "assign",
     "assign_p_p",
     "Parrot_assign_p_p",
@@ -9233,7 +9279,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 728 */
+  { /* 730 */
     "assign",
     "assign_p_i",
     "Parrot_assign_p_i",
@@ -9244,7 +9290,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 729 */
+  { /* 731 */
     "assign",
     "assign_p_ic",
     "Parrot_assign_p_ic",
@@ -9255,7 +9301,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 730 */
+  { /* 732 */
     "assign",
     "assign_p_n",
     "Parrot_assign_p_n",
@@ -9266,7 +9312,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 731 */
+  { /* 733 */
     "assign",
     "assign_p_nc",
     "Parrot_assign_p_nc",
@@ -9277,7 +9323,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 732 */
+  { /* 734 */
     "assign",
     "assign_p_s",
     "Parrot_assign_p_s",
@@ -9288,7 +9334,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 733 */
+  { /* 735 */
     "assign",
     "assign_p_sc",
     "Parrot_assign_p_sc",
@@ -9299,7 +9345,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 734 */
+  { /* 736 */
     "assign",
     "assign_s_s",
     "Parrot_assign_s_s",
@@ -9310,7 +9356,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 735 */
+  { /* 737 */
     "assign",
     "assign_s_sc",
     "Parrot_assign_s_sc",
@@ -9321,7 +9367,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 736 */
+  { /* 738 */
     "setref",
     "setref_p_p",
     "Parrot_setref_p_p",
@@ -9332,7 +9378,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 737 */
+  { /* 739 */
     "deref",
     "deref_p_p",
     "Parrot_deref_p_p",
@@ -9343,7 +9389,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 738 */
+  { /* 740 */
     "set",
     "set_p_ki_i",
     "Parrot_set_p_ki_i",
@@ -9354,7 +9400,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 739 */
+  { /* 741 */
     "set",
     "set_p_kic_i",
     "Parrot_set_p_kic_i",
@@ -9365,7 +9411,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 740 */
+  { /* 742 */
     "set",
     "set_p_ki_ic",
     "Parrot_set_p_ki_ic",
@@ -9376,7 +9422,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 741 */
+  { /* 743 */
     "set",
     "set_p_kic_ic",
     "Parrot_set_p_kic_ic",
@@ -9387,7 +9433,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 742 */
+  { /* 744 */
     "set",
     "set_p_ki_n",
     "Parrot_set_p_ki_n",
@@ -9398,7 +9444,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 743 */
+  { /* 745 */
     "set",
     "set_p_kic_n",
     "Parrot_set_p_kic_n",
@@ -9409,7 +9455,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 744 */
+  { /* 746 */
     "set",
     "set_p_ki_nc",
     "Parrot_set_p_ki_nc",
@@ -9420,7 +9466,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 745 */
+  { /* 747 */
     "set",
     "set_p_kic_nc",
     "Parrot_set_p_kic_nc",
@@ -9431,7 +9477,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 746 */
+  { /* 748 */
     "set",
     "set_p_ki_s",
     "Parrot_set_p_ki_s",
@@ -9442,7 +9488,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 747 */
+  { /* 749 */
     "set",
     "set_p_kic_s",
     "Parrot_set_p_kic_s",
@@ -9453,7 +9499,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 748 */
+  { /* 750 */
     "set",
     "set_p_ki_sc",
     "Parrot_set_p_ki_sc",
@@ -9464,7 +9510,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 749 */
+  { /* 751 */
     "set",
     "set_p_kic_sc",
     "Parrot_set_p_kic_sc",
@@ -9475,7 +9521,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 750 */
+  { /* 752 */
     "set",
     "set_p_ki_p",
     "Parrot_set_p_ki_p",
@@ -9486,7 +9532,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 751 */
+  { /* 753 */
     "set",
     "set_p_kic_p",
     "Parrot_set_p_kic_p",
@@ -9497,7 +9543,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 752 */
+  { /* 754 */
     "set",
     "set_i_p_ki",
     "Parrot_set_i_p_ki",
@@ -9508,7 +9554,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 753 */
+  { /* 755 */
     "set",
     "set_i_p_kic",
     "Parrot_set_i_p_kic",
@@ -9519,7 +9565,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 754 */
+  { /* 756 */
     "set",
     "set_n_p_ki",
     "Parrot_set_n_p_ki",
@@ -9530,7 +9576,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 755 */
+  { /* 757 */
     "set",
     "set_n_p_kic",
     "Parrot_set_n_p_kic",
@@ -9541,7 +9587,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 756 */
+  { /* 758 */
     "set",
     "set_s_p_ki",
     "Parrot_set_s_p_ki",
@@ -9552,7 +9598,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 757 */
+  { /* 759 */
     "set",
     "set_s_p_kic",
     "Parrot_set_s_p_kic",
@@ -9563,7 +9609,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 758 */
+  { /* 760 */
     "set",
     "set_p_p_ki",
     "Parrot_set_p_p_ki",
@@ -9574,7 +9620,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 759 */
+  { /* 761 */
     "set",
     "set_p_p_kic",
     "Parrot_set_p_p_kic",
@@ -9585,7 +9631,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 760 */
+  { /* 762 */
     "set",
     "set_p_k_i",
     "Parrot_set_p_k_i",
@@ -9596,7 +9642,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 761 */
+  { /* 763 */
     "set",
     "set_p_kc_i",
     "Parrot_set_p_kc_i",
@@ -9607,7 +9653,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 762 */
+  { /* 764 */
     "set",
     "set_p_k_ic",
     "Parrot_set_p_k_ic",
@@ -9618,7 +9664,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 763 */
+  { /* 765 */
     "set",
     "set_p_kc_ic",
     "Parrot_set_p_kc_ic",
@@ -9629,7 +9675,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 764 */
+  { /* 766 */
     "set",
     "set_p_k_n",
     "Parrot_set_p_k_n",
@@ -9640,7 +9686,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 765 */
+  { /* 767 */
     "set",
     "set_p_kc_n",
     "Parrot_set_p_kc_n",
@@ -9651,7 +9697,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 766 */
+  { /* 768 */
     "set",
     "set_p_k_nc",
     "Parrot_set_p_k_nc",
@@ -9662,7 +9708,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 767 */
+  { /* 769 */
     "set",
     "set_p_kc_nc",
     "Parrot_set_p_kc_nc",
@@ -9673,7 +9719,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 768 */
+  { /* 770 */
     "set",
     "set_p_k_s",
     "Parrot_set_p_k_s",
@@ -9684,7 +9730,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 769 */
+  { /* 771 */
     "set",
     "set_p_kc_s",
     "Parrot_set_p_kc_s",
@@ -9695,7 +9741,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 770 */
+  { /* 772 */
     "set",
     "set_p_k_sc",
     "Parrot_set_p_k_sc",
@@ -9706,7 +9752,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 771 */
+  { /* 773 */
     "set",
     "set_p_kc_sc",
     "Parrot_set_p_kc_sc",
@@ -9717,7 +9763,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 772 */
+  { /* 774 */
     "set",
     "set_p_k_p",
     "Parrot_set_p_k_p",
@@ -9728,7 +9774,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 773 */
+  { /* 775 */
     "set",
     "set_p_kc_p",
     "Parrot_set_p_kc_p",
@@ -9739,7 +9785,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 774 */
+  { /* 776 */
     "set",
     "set_i_p_k",
     "Parrot_set_i_p_k",
@@ -9750,7 +9796,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 775 */
+  { /* 777 */
     "set",
     "set_i_p_kc",
     "Parrot_set_i_p_kc",
@@ -9761,7 +9807,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 776 */
+  { /* 778 */
     "set",
     "set_n_p_k",
     "Parrot_set_n_p_k",
@@ -9772,7 +9818,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 777 */
+  { /* 779 */
     "set",
     "set_n_p_kc",
     "Parrot_set_n_p_kc",
@@ -9783,7 +9829,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 778 */
+  { /* 780 */
     "set",
     "set_s_p_k",
     "Parrot_set_s_p_k",
@@ -9794,7 +9840,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 779 */
+  { /* 781 */
     "set",
     "set_s_p_kc",
     "Parrot_set_s_p_kc",
@@ -9805,7 +9851,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 780 */
+  { /* 782 */
     "set",
     "set_p_p_k",
     "Parrot_set_p_p_k",
@@ -9816,7 +9862,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 781 */
+  { /* 783 */
     "set",
     "set_p_p_kc",
     "Parrot_set_p_p_kc",
@@ -9827,7 +9873,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 782 */
+  { /* 784 */
     "clone",
     "clone_p_p",
     "Parrot_clone_p_p",
@@ -9838,7 +9884,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 783 */
+  { /* 785 */
     "clone",
     "clone_p_p_p",
     "Parrot_clone_p_p_p",
@@ -9849,7 +9895,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 784 */
+  { /* 786 */
     "clone",
     "clone_p_p_pc",
     "Parrot_clone_p_p_pc",
@@ -9860,7 +9906,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 785 */
+  { /* 787 */
     "copy",
     "copy_p_p",
     "Parrot_copy_p_p",
@@ -9871,7 +9917,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 786 */
+  { /* 788 */
     "null",
     "null_s",
     "Parrot_null_s",
@@ -9882,7 +9928,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 787 */
+  { /* 789 */
     "null",
     "null_i",
     "Parrot_null_i",
@@ -9893,7 +9939,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 788 */
+  { /* 790 */
     "null",
     "null_p",
     "Parrot_null_p",
@@ -9904,7 +9950,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 789 */
+  { /* 791 */
     "null",
     "null_n",
     "Parrot_null_n",
@@ -9915,7 +9961,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 790 */
+  { /* 792 */
     "ord",
     "ord_i_s",
     "Parrot_ord_i_s",
@@ -9926,7 +9972,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 791 */
+  { /* 793 */
     "ord",
     "ord_i_sc",
     "Parrot_ord_i_sc",
@@ -9937,7 +9983,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 792 */
+  { /* 794 */
     "ord",
     "ord_i_s_i",
     "Parrot_ord_i_s_i",
@@ -9948,7 +9994,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 793 */
+  { /* 795 */
     "ord",
     "ord_i_sc_i",
     "Parrot_ord_i_sc_i",
@@ -9959,7 +10005,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 794 */
+  { /* 796 */
     "ord",
     "ord_i_s_ic",
     "Parrot_ord_i_s_ic",
@@ -9970,7 +10016,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 795 */
+  { /* 797 */
     "ord",
     "ord_i_sc_ic",
     "Parrot_ord_i_sc_ic",
@@ -9981,7 +10027,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 796 */
+  { /* 798 */
     "chr",
     "chr_s_i",
     "Parrot_chr_s_i",
@@ -9992,7 +10038,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 797 */
+  { /* 799 */
     "chr",
     "chr_s_ic",
     "Parrot_chr_s_ic",
@@ -10003,7 +10049,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 798 */
+  { /* 800 */
     "chopn",
     "chopn_s_s_i",
     "Parrot_chopn_s_s_i",
@@ -10014,7 +10060,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 799 */
+  { /* 801 */
     "chopn",
     "chopn_s_sc_i",
     "Parrot_chopn_s_sc_i",
@@ -10025,7 +10071,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 800 */
+  { /* 802 */
     "chopn",
     "chopn_s_s_ic",
     "Parrot_chopn_s_s_ic",
@@ -10036,7 +10082,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 801 */
+  { /* 803 */
     "chopn",
     "chopn_s_sc_ic",
     "Parrot_chopn_s_sc_ic",
@@ -10047,7 +10093,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 802 */
+  { /* 804 */
     "concat",
     "concat_p_p",
     "Parrot_concat_p_p",
@@ -10058,7 +10104,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 803 */
+  { /* 805 */
     "concat",
     "concat_p_s",
     "Parrot_concat_p_s",
@@ -10069,7 +10115,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 804 */
+  { /* 806 */
     "concat",
     "concat_p_sc",
     "Parrot_concat_p_sc",
@@ -10080,7 +10126,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 805 */
+  { /* 807 */
     "concat",
     "concat_s_s_s",
     "Parrot_concat_s_s_s",
@@ -10091,7 +10137,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 806 */
+  { /* 808 */
     "concat",
     "concat_s_sc_s",
     "Parrot_concat_s_sc_s",
@@ -10102,7 +10148,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 807 */
+  { /* 809 */
     "concat",
     "concat_s_s_sc",
     "Parrot_concat_s_s_sc",
@@ -10113,7 +10159,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 808 */
+  { /* 810 */
     "concat",
     "concat_p_p_s",
     "Parrot_concat_p_p_s",
@@ -10124,7 +10170,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 809 */
+  { /* 811 */
     "concat",
     "concat_p_p_sc",
     "Parrot_concat_p_p_sc",
@@ -10135,7 +10181,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 810 */
+  { /* 812 */
     "concat",
     "concat_p_p_p",
     "Parrot_concat_p_p_p",
@@ -10146,7 +10192,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 811 */
+  { /* 813 */
     "repeat",
     "repeat_s_s_i",
     "Parrot_repeat_s_s_i",
@@ -10157,7 +10203,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 812 */
+  { /* 814 */
     "repeat",
     "repeat_s_sc_i",
     "Parrot_repeat_s_sc_i",
@@ -10168,7 +10214,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 813 */
+  { /* 815 */
     "repeat",
     "repeat_s_s_ic",
     "Parrot_repeat_s_s_ic",
@@ -10179,7 +10225,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 814 */
+  { /* 816 */
     "repeat",
     "repeat_s_sc_ic",
     "Parrot_repeat_s_sc_ic",
@@ -10190,7 +10236,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 815 */
+  { /* 817 */
     "repeat",
     "repeat_p_p_i",
     "Parrot_repeat_p_p_i",
@@ -10201,7 +10247,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 816 */
+  { /* 818 */
     "repeat",
     "repeat_p_p_ic",
     "Parrot_repeat_p_p_ic",
@@ -10212,7 +10258,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 817 */
+  { /* 819 */
     "repeat",
     "repeat_p_p_p",
     "Parrot_repeat_p_p_p",
@@ -10223,7 +10269,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 818 */
+  { /* 820 */
     "repeat",
     "repeat_p_i",
     "Parrot_repeat_p_i",
@@ -10234,7 +10280,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 819 */
+  { /* 821 */
     "repeat",
     "repeat_p_ic",
     "Parrot_repeat_p_ic",
@@ -10245,7 +10291,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 820 */
+  { /* 822 */
     "repeat",
     "repeat_p_p",
     "Parrot_repeat_p_p",
@@ -10256,7 +10302,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 821 */
+  { /* 823 */
     "length",
     "length_i_s",
     "Parrot_length_i_s",
@@ -10267,7 +10313,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 822 */
+  { /* 824 */
     "length",
     "length_i_sc",
     "Parrot_length_i_sc",
@@ -10278,7 +10324,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 823 */
+  { /* 825 */
     "bytelength",
     "bytelength_i_s",
     "Parrot_bytelength_i_s",
@@ -10289,7 +10335,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 824 */
+  { /* 826 */
     "bytelength",
     "bytelength_i_sc",
     "Parrot_bytelength_i_sc",
@@ -10300,7 +10346,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 825 */
+  { /* 827 */
     "pin",
     "pin_s",
     "Parrot_pin_s",
@@ -10311,7 +10357,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 826 */
+  { /* 828 */
     "unpin",
     "unpin_s",
     "Parrot_unpin_s",
@@ -10322,7 +10368,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 827 */
+  { /* 829 */
     "substr",
     "substr_s_s_i",
     "Parrot_substr_s_s_i",
@@ -10333,7 +10379,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 828 */
+  { /* 830 */
     "substr",
     "substr_s_sc_i",
     "Parrot_substr_s_sc_i",
@@ -10344,7 +10390,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 829 */
+  { /* 831 */
     "substr",
     "substr_s_s_ic",
     "Parrot_substr_s_s_ic",
@@ -10355,7 +10401,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 830 */
+  { /* 832 */
     "substr",
     "substr_s_sc_ic",
     "Parrot_substr_s_sc_ic",
@@ -10366,7 +10412,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 831 */
+  { /* 833 */
     "substr",
     "substr_s_s_i_i",
     "Parrot_substr_s_s_i_i",
@@ -10377,7 +10423,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 832 */
+  { /* 834 */
     "substr",
     "substr_s_sc_i_i",
     "Parrot_substr_s_sc_i_i",
@@ -10388,7 +10434,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 833 */
+  { /* 835 */
     "substr",
     "substr_s_s_ic_i",
     "Parrot_substr_s_s_ic_i",
@@ -10399,7 +10445,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 834 */
+  { /* 836 */
     "substr",
     "substr_s_sc_ic_i",
     "Parrot_substr_s_sc_ic_i",
@@ -10410,7 +10456,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 835 */
+  { /* 837 */
     "substr",
     "substr_s_s_i_ic",
     "Parrot_substr_s_s_i_ic",
@@ -10421,7 +10467,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 836 */
+  { /* 838 */
     "substr",
     "substr_s_sc_i_ic",
     "Parrot_substr_s_sc_i_ic",
@@ -10432,7 +10478,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 837 */
+  { /* 839 */
     "substr",
     "substr_s_s_ic_ic",
     "Parrot_substr_s_s_ic_ic",
@@ -10443,7 +10489,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 838 */
+  { /* 840 */
     "substr",
     "substr_s_sc_ic_ic",
     "Parrot_substr_s_sc_ic_ic",
@@ -10454,7 +10500,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 839 */
+  { /* 841 */
     "substr",
     "substr_s_p_i_i",
     "Parrot_substr_s_p_i_i",
@@ -10465,7 +10511,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 840 */
+  { /* 842 */
     "substr",
     "substr_s_p_ic_i",
     "Parrot_substr_s_p_ic_i",
@@ -10476,7 +10522,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 841 */
+  { /* 843 */
     "substr",
     "substr_s_p_i_ic",
     "Parrot_substr_s_p_i_ic",
@@ -10487,7 +10533,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 842 */
+  { /* 844 */
     "substr",
     "substr_s_p_ic_ic",
     "Parrot_substr_s_p_ic_ic",
@@ -10498,7 +10544,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 843 */
+  { /* 845 */
     "replace",
     "replace_s_s_i_i_s",
     "Parrot_replace_s_s_i_i_s",
@@ -10509,7 +10555,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 844 */
+  { /* 846 */
     "replace",
     "replace_s_sc_i_i_s",
     "Parrot_replace_s_sc_i_i_s",
@@ -10520,7 +10566,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 845 */
+  { /* 847 */
     "replace",
     "replace_s_s_ic_i_s",
     "Parrot_replace_s_s_ic_i_s",
@@ -10531,7 +10577,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 846 */
+  { /* 848 */
     "replace",
     "replace_s_sc_ic_i_s",
     "Parrot_replace_s_sc_ic_i_s",
@@ -10542,7 +10588,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 847 */
+  { /* 849 */
     "replace",
     "replace_s_s_i_ic_s",
     "Parrot_replace_s_s_i_ic_s",
@@ -10553,7 +10599,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 848 */
+  { /* 850 */
     "replace",
     "replace_s_sc_i_ic_s",
     "Parrot_replace_s_sc_i_ic_s",
@@ -10564,7 +10610,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 849 */
+  { /* 851 */
     "replace",
     "replace_s_s_ic_ic_s",
     "Parrot_replace_s_s_ic_ic_s",
@@ -10575,7 +10621,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 850 */
+  { /* 852 */
     "replace",
     "replace_s_sc_ic_ic_s",
     "Parrot_replace_s_sc_ic_ic_s",
@@ -10586,7 +10632,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 851 */
+  { /* 853 */
     "replace",
     "replace_s_s_i_i_sc",
     "Parrot_replace_s_s_i_i_sc",
@@ -10597,7 +10643,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 852 */
+  { /* 854 */
     "replace",
     "replace_s_sc_i_i_sc",
     "Parrot_replace_s_sc_i_i_sc",
@@ -10608,7 +10654,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 853 */
+  { /* 855 */
     "replace",
     "replace_s_s_ic_i_sc",
     "Parrot_replace_s_s_ic_i_sc",
@@ -10619,7 +10665,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 854 */
+  { /* 856 */
     "replace",
     "replace_s_sc_ic_i_sc",
     "Parrot_replace_s_sc_ic_i_sc",
@@ -10630,7 +10676,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 855 */
+  { /* 857 */
     "replace",
     "replace_s_s_i_ic_sc",
     "Parrot_replace_s_s_i_ic_sc",
@@ -10641,7 +10687,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 856 */
+  { /* 858 */
     "replace",
     "replace_s_sc_i_ic_sc",
     "Parrot_replace_s_sc_i_ic_sc",
@@ -10652,7 +10698,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 857 */
+  { /* 859 */
     "replace",
     "replace_s_s_ic_ic_sc",
     "Parrot_replace_s_s_ic_ic_sc",
@@ -10663,7 +10709,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 858 */
+  { /* 860 */
     "replace",
     "replace_s_sc_ic_ic_sc",
     "Parrot_replace_s_sc_ic_ic_sc",
@@ -10674,7 +10720,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 859 */
+  { /* 861 */
     "index",
     "index_i_s_s",
     "Parrot_index_i_s_s",
@@ -10685,7 +10731,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 860 */
+  { /* 862 */
     "index",
     "index_i_sc_s",
     "Parrot_index_i_sc_s",
@@ -10696,7 +10742,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 861 */
+  { /* 863 */
     "index",
     "index_i_s_sc",
     "Parrot_index_i_s_sc",
@@ -10707,7 +10753,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 862 */
+  { /* 864 */
     "index",
     "index_i_sc_sc",
     "Parrot_index_i_sc_sc",
@@ -10718,7 +10764,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 863 */
+  { /* 865 */
     "index",
     "index_i_s_s_i",
     "Parrot_index_i_s_s_i",
@@ -10729,7 +10775,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 864 */
+  { /* 866 */
     "index",
     "index_i_sc_s_i",
     "Parrot_index_i_sc_s_i",
@@ -10740,7 +10786,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 865 */
+  { /* 867 */
     "index",
     "index_i_s_sc_i",
     "Parrot_index_i_s_sc_i",
@@ -10751,7 +10797,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 866 */
+  { /* 868 */
     "index",
     "index_i_sc_sc_i",
     "Parrot_index_i_sc_sc_i",
@@ -10762,7 +10808,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 867 */
+  { /* 869 */
     "index",
     "index_i_s_s_ic",
     "Parrot_index_i_s_s_ic",
@@ -10773,7 +10819,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 868 */
+  { /* 870 */
     "index",
     "index_i_sc_s_ic",
     "Parrot_index_i_sc_s_ic",
@@ -10784,7 +10830,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 869 */
+  { /* 871 */
     "index",
     "index_i_s_sc_ic",
     "Parrot_index_i_s_sc_ic",
@@ -10795,7 +10841,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 870 */
+  { /* 872 */
     "index",
     "index_i_sc_sc_ic",
     "Parrot_index_i_sc_sc_ic",
@@ -10806,7 +10852,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 871 */
+  { /* 873 */
     "rindex",
     "rindex_i_s_s",
     "Parrot_rindex_i_s_s",
@@ -10817,7 +10863,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 872 */
+  { /* 874 */
     "rindex",
     "rindex_i_sc_s",
     "Parrot_rindex_i_sc_s",
@@ -10828,7 +10874,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 873 */
+  { /* 875 */
     "rindex",
     "rindex_i_s_sc",
     "Parrot_rindex_i_s_sc",
@@ -10839,7 +10885,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 874 */
+  { /* 876 */
     "rindex",
     "rindex_i_sc_sc",
     "Parrot_rindex_i_sc_sc",
@@ -10850,7 +10896,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 875 */
+  { /* 877 */
     "rindex",
     "rindex_i_s_s_i",
     "Parrot_rindex_i_s_s_i",
@@ -10861,7 +10907,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 876 */
+  { /* 878 */
     "rindex",
     "rindex_i_sc_s_i",
     "Parrot_rindex_i_sc_s_i",
@@ -10872,7 +10918,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 877 */
+  { /* 879 */
     "rindex",
     "rindex_i_s_sc_i",
     "Parrot_rindex_i_s_sc_i",
@@ -10883,7 +10929,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 878 */
+  { /* 880 */
     "rindex",
     "rindex_i_sc_sc_i",
     "Parrot_rindex_i_sc_sc_i",
@@ -10894,7 +10940,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 879 */
+  { /* 881 */
     "rindex",
     "rindex_i_s_s_ic",
     "Parrot_rindex_i_s_s_ic",
@@ -10905,7 +10951,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 880 */
+  { /* 882 */
     "rindex",
     "rindex_i_sc_s_ic",
     "Parrot_rindex_i_sc_s_ic",
@@ -10916,7 +10962,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 881 */
+  { /* 883 */
     "rindex",
     "rindex_i_s_sc_ic",
     "Parrot_rindex_i_s_sc_ic",
@@ -10927,7 +10973,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 882 */
+  { /* 884 */
     "rindex",
     "rindex_i_sc_sc_ic",
     "Parrot_rindex_i_sc_sc_ic",
@@ -10938,7 +10984,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 883 */
+  { /* 885 */
     "sprintf",
     "sprintf_s_s_p",
     "Parrot_sprintf_s_s_p",
@@ -10949,7 +10995,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 884 */
+  { /* 886 */
     "sprintf",
     "sprintf_s_sc_p",
     "Parrot_sprintf_s_sc_p",
@@ -10960,7 +11006,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 885 */
+  { /* 887 */
     "sprintf",
     "sprintf_p_p_p",
     "Parrot_sprintf_p_p_p",
@@ -10971,7 +11017,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 886 */
+  { /* 888 */
     "new",
     "new_s",
     "Parrot_new_s",
@@ -10982,7 +11028,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 887 */
+  { /* 889 */
     "stringinfo",
     "stringinfo_i_s_i",
     "Parrot_stringinfo_i_s_i",
@@ -10993,7 +11039,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 888 */
+  { /* 890 */
     "stringinfo",
     "stringinfo_i_sc_i",
     "Parrot_stringinfo_i_sc_i",
@@ -11004,7 +11050,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 889 */
+  { /* 891 */
     "stringinfo",
     "stringinfo_i_s_ic",
     "Parrot_stringinfo_i_s_ic",
@@ -11015,7 +11061,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 890 */
+  { /* 892 */
     "stringinfo",
     "stringinfo_i_sc_ic",
     "Parrot_stringinfo_i_sc_ic",
@@ -11026,7 +11072,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 891 */
+  { /* 893 */
     "upcase",
     "upcase_s_s",
     "Parrot_upcase_s_s",
@@ -11037,7 +11083,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 892 */
+  { /* 894 */
     "upcase",
     "upcase_s_sc",
     "Parrot_upcase_s_sc",
@@ -11048,7 +11094,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 893 */
+  { /* 895 */
     "downcase",
     "downcase_s_s",
     "Parrot_downcase_s_s",
@@ -11059,7 +11105,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 894 */
+  { /* 896 */
     "downcase",
     "downcase_s_sc",
     "Parrot_downcase_s_sc",
@@ -11070,7 +11116,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 895 */
+  { /* 897 */
     "titlecase",
     "titlecase_s_s",
     "Parrot_titlecase_s_s",
@@ -11081,7 +11127,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 896 */
+  { /* 898 */
     "titlecase",
     "titlecase_s_sc",
     "Parrot_titlecase_s_sc",
@@ -11092,7 +11138,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 897 */
+  { /* 899 */
     "join",
     "join_s_s_p",
     "Parrot_join_s_s_p",
@@ -11103,7 +11149,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 898 */
+  { /* 900 */
     "join",
     "join_s_sc_p",
     "Parrot_join_s_sc_p",
@@ -11114,7 +11160,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 899 */
+  { /* 901 */
     "split",
     "split_p_s_s",
     "Parrot_split_p_s_s",
@@ -11125,7 +11171,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 900 */
+  { /* 902 */
     "split",
     "split_p_sc_s",
     "Parrot_split_p_sc_s",
@@ -11136,7 +11182,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 901 */
+  { /* 903 */
     "split",
     "split_p_s_sc",
     "Parrot_split_p_s_sc",
@@ -11147,7 +11193,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 902 */
+  { /* 904 */
     "split",
     "split_p_sc_sc",
     "Parrot_split_p_sc_sc",
@@ -11158,7 +11204,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 903 */
+  { /* 905 */
     "encoding",
     "encoding_i_s",
     "Parrot_encoding_i_s",
@@ -11169,7 +11215,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 904 */
+  { /* 906 */
     "encoding",
     "encoding_i_sc",
     "Parrot_encoding_i_sc",
@@ -11180,7 +11226,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 905 */
+  { /* 907 */
     "encodingname",
     "encodingname_s_i",
     "Parrot_encodingname_s_i",
@@ -11191,7 +11237,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 906 */
+  { /* 908 */
     "encodingname",
     "encodingname_s_ic",
     "Parrot_encodingname_s_ic",
@@ -11202,7 +11248,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 907 */
+  { /* 909 */
     "find_encoding",
     "find_encoding_i_s",
     "Parrot_find_encoding_i_s",
@@ -11213,7 +11259,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 908 */
+  { /* 910 */
     "find_encoding",
     "find_encoding_i_sc",
     "Parrot_find_encoding_i_sc",
@@ -11224,7 +11270,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 909 */
+  { /* 911 */
     "trans_encoding",
     "trans_encoding_s_s_i",
     "Parrot_trans_encoding_s_s_i",
@@ -11235,7 +11281,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 910 */
+  { /* 912 */
     "trans_encoding",
     "trans_encoding_s_sc_i",
     "Parrot_trans_encoding_s_sc_i",
@@ -11246,7 +11292,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 911 */
+  { /* 913 */
     "trans_encoding",
     "trans_encoding_s_s_ic",
     "Parrot_trans_encoding_s_s_ic",
@@ -11257,7 +11303,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 912 */
+  { /* 914 */
     "trans_encoding",
     "trans_encoding_s_sc_ic",
     "Parrot_trans_encoding_s_sc_ic",
@@ -11268,7 +11314,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 913 */
+  { /* 915 */
     "is_cclass",
     "is_cclass_i_i_s_i",
     "Parrot_is_cclass_i_i_s_i",
@@ -11279,7 +11325,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 914 */
+  { /* 916 */
     "is_cclass",
     "is_cclass_i_ic_s_i",
     "Parrot_is_cclass_i_ic_s_i",
@@ -11290,7 +11336,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 915 */
+  { /* 917 */
     "is_cclass",
     "is_cclass_i_i_sc_i",
     "Parrot_is_cclass_i_i_sc_i",
@@ -11301,7 +11347,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 916 */
+  { /* 918 */
     "is_cclass",
     "is_cclass_i_ic_sc_i",
     "Parrot_is_cclass_i_ic_sc_i",
@@ -11312,7 +11358,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 917 */
+  { /* 919 */
     "is_cclass",
     "is_cclass_i_i_s_ic",
     "Parrot_is_cclass_i_i_s_ic",
@@ -11323,7 +11369,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 918 */
+  { /* 920 */
     "is_cclass",
     "is_cclass_i_ic_s_ic",
     "Parrot_is_cclass_i_ic_s_ic",
@@ -11334,7 +11380,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 919 */
+  { /* 921 */
     "is_cclass",
     "is_cclass_i_i_sc_ic",
     "Parrot_is_cclass_i_i_sc_ic",
@@ -11345,7 +11391,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 920 */
+  { /* 922 */
     "is_cclass",
     "is_cclass_i_ic_sc_ic",
     "Parrot_is_cclass_i_ic_sc_ic",
@@ -11356,7 +11402,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 921 */
+  { /* 923 */
     "find_cclass",
     "find_cclass_i_i_s_i_i",
     "Parrot_find_cclass_i_i_s_i_i",
@@ -11367,7 +11413,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 922 */
+  { /* 924 */
     "find_cclass",
     "find_cclass_i_ic_s_i_i",
     "Parrot_find_cclass_i_ic_s_i_i",
@@ -11378,7 +11424,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 923 */
+  { /* 925 */
     "find_cclass",
     "find_cclass_i_i_sc_i_i",
     "Parrot_find_cclass_i_i_sc_i_i",
@@ -11389,7 +11435,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 924 */
+  { /* 926 */
     "find_cclass",
     "find_cclass_i_ic_sc_i_i",
     "Parrot_find_cclass_i_ic_sc_i_i",
@@ -11400,7 +11446,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 925 */
+  { /* 927 */
     "find_cclass",
     "find_cclass_i_i_s_ic_i",
     "Parrot_find_cclass_i_i_s_ic_i",
@@ -11411,7 +11457,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 926 */
+  { /* 928 */
     "find_cclass",
     "find_cclass_i_ic_s_ic_i",
     "Parrot_find_cclass_i_ic_s_ic_i",
@@ -11422,7 +11468,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 927 */
+  { /* 929 */
     "find_cclass",
     "find_cclass_i_i_sc_ic_i",
     "Parrot_find_cclass_i_i_sc_ic_i",
@@ -11433,7 +11479,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 928 */
+  { /* 930 */
     "find_cclass",
     "find_cclass_i_ic_sc_ic_i",
     "Parrot_find_cclass_i_ic_sc_ic_i",
@@ -11444,7 +11490,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 929 */
+  { /* 931 */
     "find_cclass",
     "find_cclass_i_i_s_i_ic",
     "Parrot_find_cclass_i_i_s_i_ic",
@@ -11455,7 +11501,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 930 */
+  { /* 932 */
     "find_cclass",
     "find_cclass_i_ic_s_i_ic",
     "Parrot_find_cclass_i_ic_s_i_ic",
@@ -11466,7 +11512,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 931 */
+  { /* 933 */
     "find_cclass",
     "find_cclass_i_i_sc_i_ic",
     "Parrot_find_cclass_i_i_sc_i_ic",
@@ -11477,7 +11523,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 932 */
+  { /* 934 */
     "find_cclass",
     "find_cclass_i_ic_sc_i_ic",
     "Parrot_find_cclass_i_ic_sc_i_ic",
@@ -11488,7 +11534,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 933 */
+  { /* 935 */
     "find_cclass",
     "find_cclass_i_i_s_ic_ic",
     "Parrot_find_cclass_i_i_s_ic_ic",
@@ -11499,7 +11545,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 934 */
+  { /* 936 */
     "find_cclass",
     "find_cclass_i_ic_s_ic_ic",
     "Parrot_find_cclass_i_ic_s_ic_ic",
@@ -11510,7 +11556,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 935 */
+  { /* 937 */
     "find_cclass",
     "find_cclass_i_i_sc_ic_ic",
     "Parrot_find_cclass_i_i_sc_ic_ic",
@@ -11521,7 +11567,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 936 */
+  { /* 938 */
     "find_cclass",
     "find_cclass_i_ic_sc_ic_ic",
     "Parrot_find_cclass_i_ic_sc_ic_ic",
@@ -11532,7 +11578,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 937 */
+  { /* 939 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_i_i",
     "Parrot_find_not_cclass_i_i_s_i_i",
@@ -11543,7 +11589,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 938 */
+  { /* 940 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_i_i",
     "Parrot_find_not_cclass_i_ic_s_i_i",
@@ -11554,7 +11600,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 939 */
+  { /* 941 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_i_i",
     "Parrot_find_not_cclass_i_i_sc_i_i",
@@ -11565,7 +11611,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 940 */
+  { /* 942 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_i_i",
     "Parrot_find_not_cclass_i_ic_sc_i_i",
@@ -11576,7 +11622,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 941 */
+  { /* 943 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_ic_i",
     "Parrot_find_not_cclass_i_i_s_ic_i",
@@ -11587,7 +11633,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 942 */
+  { /* 944 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_ic_i",
     "Parrot_find_not_cclass_i_ic_s_ic_i",
@@ -11598,7 +11644,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 943 */
+  { /* 945 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_ic_i",
     "Parrot_find_not_cclass_i_i_sc_ic_i",
@@ -11609,7 +11655,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 944 */
+  { /* 946 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_ic_i",
     "Parrot_find_not_cclass_i_ic_sc_ic_i",
@@ -11620,7 +11666,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 945 */
+  { /* 947 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_i_ic",
     "Parrot_find_not_cclass_i_i_s_i_ic",
@@ -11631,7 +11677,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 946 */
+  { /* 948 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_i_ic",
     "Parrot_find_not_cclass_i_ic_s_i_ic",
@@ -11642,7 +11688,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 947 */
+  { /* 949 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_i_ic",
     "Parrot_find_not_cclass_i_i_sc_i_ic",
@@ -11653,7 +11699,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 948 */
+  { /* 950 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_i_ic",
     "Parrot_find_not_cclass_i_ic_sc_i_ic",
@@ -11664,7 +11710,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 949 */
+  { /* 951 */
     "find_not_cclass",
     "find_not_cclass_i_i_s_ic_ic",
     "Parrot_find_not_cclass_i_i_s_ic_ic",
@@ -11675,7 +11721,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 950 */
+  { /* 952 */
     "find_not_cclass",
     "find_not_cclass_i_ic_s_ic_ic",
     "Parrot_find_not_cclass_i_ic_s_ic_ic",
@@ -11686,7 +11732,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 951 */
+  { /* 953 */
     "find_not_cclass",
     "find_not_cclass_i_i_sc_ic_ic",
     "Parrot_find_not_cclass_i_i_sc_ic_ic",
@@ -11697,7 +11743,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 952 */
+  { /* 954 */
     "find_not_cclass",
     "find_not_cclass_i_ic_sc_ic_ic",
     "Parrot_find_not_cclass_i_ic_sc_ic_ic",
@@ -11708,7 +11754,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 953 */
+  { /* 955 */
     "escape",
     "escape_s_s",
     "Parrot_escape_s_s",
@@ -11719,7 +11765,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 954 */
+  { /* 956 */
     "compose",
     "compose_s_s",
     "Parrot_compose_s_s",
@@ -11730,7 +11776,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 955 */
+  { /* 957 */
     "compose",
     "compose_s_sc",
     "Parrot_compose_s_sc",
@@ -11741,7 +11787,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 956 */
+  { /* 958 */
     "find_codepoint",
     "find_codepoint_i_s",
     "Parrot_find_codepoint_i_s",
@@ -11752,7 +11798,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 957 */
+  { /* 959 */
     "find_codepoint",
     "find_codepoint_i_sc",
     "Parrot_find_codepoint_i_sc",
@@ -11763,7 +11809,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 958 */
+  { /* 960 */
     "spawnw",
     "spawnw_i_s",
     "Parrot_spawnw_i_s",
@@ -11774,7 +11820,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 959 */
+  { /* 961 */
     "spawnw",
     "spawnw_i_sc",
     "Parrot_spawnw_i_sc",
@@ -11785,7 +11831,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 960 */
+  { /* 962 */
     "spawnw",
     "spawnw_i_p",
     "Parrot_spawnw_i_p",
@@ -11796,7 +11842,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 961 */
+  { /* 963 */
     "err",
     "err_i",
     "Parrot_err_i",
@@ -11807,7 +11853,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 962 */
+  { /* 964 */
     "err",
     "err_s",
     "Parrot_err_s",
@@ -11818,7 +11864,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 963 */
+  { /* 965 */
     "err",
     "err_s_i",
     "Parrot_err_s_i",
@@ -11829,7 +11875,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 964 */
+  { /* 966 */
     "err",
     "err_s_ic",
     "Parrot_err_s_ic",
@@ -11840,7 +11886,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 965 */
+  { /* 967 */
     "time",
     "time_i",
     "Parrot_time_i",
@@ -11851,7 +11897,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 966 */
+  { /* 968 */
     "time",
     "time_n",
     "Parrot_time_n",
@@ -11862,7 +11908,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 967 */
+  { /* 969 */
     "sleep",
     "sleep_i",
     "Parrot_sleep_i",
@@ -11873,7 +11919,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 968 */
+  { /* 970 */
     "sleep",
     "sleep_ic",
     "Parrot_sleep_ic",
@@ -11884,7 +11930,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 969 */
+  { /* 971 */
     "sleep",
     "sleep_n",
     "Parrot_sleep_n",
@@ -11895,7 +11941,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 970 */
+  { /* 972 */
     "sleep",
     "sleep_nc",
     "Parrot_sleep_nc",
@@ -11906,7 +11952,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 971 */
+  { /* 973 */
     "store_lex",
     "store_lex_s_p",
     "Parrot_store_lex_s_p",
@@ -11917,7 +11963,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 972 */
+  { /* 974 */
     "store_lex",
     "store_lex_sc_p",
     "Parrot_store_lex_sc_p",
@@ -11928,7 +11974,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 973 */
+  { /* 975 */
     "store_lex",
     "store_lex_s_s",
     "Parrot_store_lex_s_s",
@@ -11939,7 +11985,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 974 */
+  { /* 976 */
     "store_lex",
     "store_lex_sc_s",
     "Parrot_store_lex_sc_s",
@@ -11950,7 +11996,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 975 */
+  { /* 977 */
     "store_lex",
     "store_lex_s_sc",
     "Parrot_store_lex_s_sc",
@@ -11961,7 +12007,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 976 */
+  { /* 978 */
     "store_lex",
     "store_lex_sc_sc",
     "Parrot_store_lex_sc_sc",
@@ -11972,7 +12018,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 977 */
+  { /* 979 */
     "store_lex",
     "store_lex_s_i",
     "Parrot_store_lex_s_i",
@@ -11983,7 +12029,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 978 */
+  { /* 980 */
     "store_lex",
     "store_lex_sc_i",
     "Parrot_store_lex_sc_i",
@@ -11994,7 +12040,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 979 */
+  { /* 981 */
     "store_lex",
     "store_lex_s_ic",
     "Parrot_store_lex_s_ic",
@@ -12005,7 +12051,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 980 */
+  { /* 982 */
     "store_lex",
     "store_lex_sc_ic",
     "Parrot_store_lex_sc_ic",
@@ -12016,7 +12062,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 981 */
+  { /* 983 */
     "store_lex",
     "store_lex_s_n",
     "Parrot_store_lex_s_n",
@@ -12027,7 +12073,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 982 */
+  { /* 984 */
     "store_lex",
     "store_lex_sc_n",
     "Parrot_store_lex_sc_n",
@@ -12038,7 +12084,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 983 */
+  { /* 985 */
     "store_lex",
     "store_lex_s_nc",
     "Parrot_store_lex_s_nc",
@@ -12049,7 +12095,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 984 */
+  { /* 986 */
     "store_lex",
     "store_lex_sc_nc",
     "Parrot_store_lex_sc_nc",
@@ -12060,7 +12106,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 985 */
+  { /* 987 */
     "store_dynamic_lex",
     "store_dynamic_lex_s_p",
     "Parrot_store_dynamic_lex_s_p",
@@ -12071,7 +12117,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 986 */
+  { /* 988 */
     "store_dynamic_lex",
     "store_dynamic_lex_sc_p",
     "Parrot_store_dynamic_lex_sc_p",
@@ -12082,7 +12128,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 987 */
+  { /* 989 */
     "find_lex",
     "find_lex_p_s",
     "Parrot_find_lex_p_s",
@@ -12093,7 +12139,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 988 */
+  { /* 990 */
     "find_lex",
     "find_lex_p_sc",
     "Parrot_find_lex_p_sc",
@@ -12104,7 +12150,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 989 */
+  { /* 991 */
     "find_lex",
     "find_lex_s_s",
     "Parrot_find_lex_s_s",
@@ -12115,7 +12161,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 990 */
+  { /* 992 */
     "find_lex",
     "find_lex_s_sc",
     "Parrot_find_lex_s_sc",
@@ -12126,7 +12172,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 991 */
+  { /* 993 */
     "find_lex",
     "find_lex_i_s",
     "Parrot_find_lex_i_s",
@@ -12137,7 +12183,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 992 */
+  { /* 994 */
     "find_lex",
     "find_lex_i_sc",
     "Parrot_find_lex_i_sc",
@@ -12148,7 +12194,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 993 */
+  { /* 995 */
     "find_lex",
     "find_lex_n_s",
     "Parrot_find_lex_n_s",
@@ -12159,7 +12205,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 994 */
+  { /* 996 */
     "find_lex",
     "find_lex_n_sc",
     "Parrot_find_lex_n_sc",
@@ -12170,129 +12216,371 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 995 */
-    "find_dynamic_lex",
-    "find_dynamic_lex_p_s",
-    "Parrot_find_dynamic_lex_p_s",
-    0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_S },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
-    &core_op_lib
-  },
-  { /* 996 */
-    "find_dynamic_lex",
-    "find_dynamic_lex_p_sc",
-    "Parrot_find_dynamic_lex_p_sc",
-    0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_SC },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
-    &core_op_lib
-  },
   { /* 997 */
-    "find_caller_lex",
-    "find_caller_lex_p_s",
-    "Parrot_find_caller_lex_p_s",
+    "find_lex_slot",
+    "find_lex_slot_p_s_ic_ic",
+    "Parrot_find_lex_slot_p_s_ic_ic",
     0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_S },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
+    5,
+    { PARROT_ARG_P, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 998 */
-    "find_caller_lex",
-    "find_caller_lex_p_sc",
-    "Parrot_find_caller_lex_p_sc",
+    "find_lex_slot",
+    "find_lex_slot_p_sc_ic_ic",
+    "Parrot_find_lex_slot_p_sc_ic_ic",
     0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_SC },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
+    5,
+    { PARROT_ARG_P, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 999 */
-    "get_namespace",
-    "get_namespace_p",
-    "Parrot_get_namespace_p",
+    "find_lex_slot",
+    "find_lex_slot_s_s_ic_ic",
+    "Parrot_find_lex_slot_s_s_ic_ic",
     0,
-    2,
-    { PARROT_ARG_P },
-    { PARROT_ARGDIR_OUT },
-    { 0 },
+    5,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1000 */
-    "get_namespace",
-    "get_namespace_p_p",
-    "Parrot_get_namespace_p_p",
+    "find_lex_slot",
+    "find_lex_slot_s_sc_ic_ic",
+    "Parrot_find_lex_slot_s_sc_ic_ic",
     0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_P },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
+    5,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1001 */
-    "get_namespace",
-    "get_namespace_p_pc",
-    "Parrot_get_namespace_p_pc",
+    "find_lex_slot",
+    "find_lex_slot_i_s_ic_ic",
+    "Parrot_find_lex_slot_i_s_ic_ic",
     0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_PC },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
+    5,
+    { PARROT_ARG_I, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1002 */
-    "get_hll_namespace",
-    "get_hll_namespace_p",
-    "Parrot_get_hll_namespace_p",
+    "find_lex_slot",
+    "find_lex_slot_i_sc_ic_ic",
+    "Parrot_find_lex_slot_i_sc_ic_ic",
     0,
-    2,
-    { PARROT_ARG_P },
-    { PARROT_ARGDIR_OUT },
-    { 0 },
+    5,
+    { PARROT_ARG_I, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1003 */
-    "get_hll_namespace",
-    "get_hll_namespace_p_p",
-    "Parrot_get_hll_namespace_p_p",
+    "find_lex_slot",
+    "find_lex_slot_n_s_ic_ic",
+    "Parrot_find_lex_slot_n_s_ic_ic",
     0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_P },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
+    5,
+    { PARROT_ARG_N, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1004 */
-    "get_hll_namespace",
-    "get_hll_namespace_p_pc",
-    "Parrot_get_hll_namespace_p_pc",
+    "find_lex_slot",
+    "find_lex_slot_n_sc_ic_ic",
+    "Parrot_find_lex_slot_n_sc_ic_ic",
     0,
-    3,
-    { PARROT_ARG_P, PARROT_ARG_PC },
-    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
-    { 0, 0 },
+    5,
+    { PARROT_ARG_N, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1005 */
-    "get_root_namespace",
-    "get_root_namespace_p",
-    "Parrot_get_root_namespace_p",
+    "store_lex_slot",
+    "store_lex_slot_s_p_ic_ic",
+    "Parrot_store_lex_slot_s_p_ic_ic",
     0,
-    2,
-    { PARROT_ARG_P },
-    { PARROT_ARGDIR_OUT },
-    { 0 },
+    5,
+    { PARROT_ARG_S, PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
     &core_op_lib
   },
   { /* 1006 */
-    "get_root_namespace",
+    "store_lex_slot",
+    "store_lex_slot_sc_p_ic_ic",
+    "Parrot_store_lex_slot_sc_p_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_P, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1007 */
+    "store_lex_slot",
+    "store_lex_slot_s_s_ic_ic",
+    "Parrot_store_lex_slot_s_s_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_S, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1008 */
+    "store_lex_slot",
+    "store_lex_slot_sc_s_ic_ic",
+    "Parrot_store_lex_slot_sc_s_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1009 */
+    "store_lex_slot",
+    "store_lex_slot_s_sc_ic_ic",
+    "Parrot_store_lex_slot_s_sc_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_S, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1010 */
+    "store_lex_slot",
+    "store_lex_slot_sc_sc_ic_ic",
+    "Parrot_store_lex_slot_sc_sc_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1011 */
+    "store_lex_slot",
+    "store_lex_slot_s_i_ic_ic",
+    "Parrot_store_lex_slot_s_i_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_S, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1012 */
+    "store_lex_slot",
+    "store_lex_slot_sc_i_ic_ic",
+    "Parrot_store_lex_slot_sc_i_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_I, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1013 */
+    "store_lex_slot",
+    "store_lex_slot_s_ic_ic_ic",
+    "Parrot_store_lex_slot_s_ic_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_S, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1014 */
+    "store_lex_slot",
+    "store_lex_slot_sc_ic_ic_ic",
+    "Parrot_store_lex_slot_sc_ic_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_IC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1015 */
+    "store_lex_slot",
+    "store_lex_slot_s_n_ic_ic",
+    "Parrot_store_lex_slot_s_n_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_S, PARROT_ARG_N, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1016 */
+    "store_lex_slot",
+    "store_lex_slot_sc_n_ic_ic",
+    "Parrot_store_lex_slot_sc_n_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_N, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1017 */
+    "store_lex_slot",
+    "store_lex_slot_s_nc_ic_ic",
+    "Parrot_store_lex_slot_s_nc_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_S, PARROT_ARG_NC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1018 */
+    "store_lex_slot",
+    "store_lex_slot_sc_nc_ic_ic",
+    "Parrot_store_lex_slot_sc_nc_ic_ic",
+    0,
+    5,
+    { PARROT_ARG_SC, PARROT_ARG_NC, PARROT_ARG_IC, PARROT_ARG_IC },
+    { PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN, PARROT_ARGDIR_IN },
+    { 0, 0, 0, 0 },
+    &core_op_lib
+  },
+  { /* 1019 */
+    "find_dynamic_lex",
+    "find_dynamic_lex_p_s",
+    "Parrot_find_dynamic_lex_p_s",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1020 */
+    "find_dynamic_lex",
+    "find_dynamic_lex_p_sc",
+    "Parrot_find_dynamic_lex_p_sc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1021 */
+    "find_caller_lex",
+    "find_caller_lex_p_s",
+    "Parrot_find_caller_lex_p_s",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_S },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1022 */
+    "find_caller_lex",
+    "find_caller_lex_p_sc",
+    "Parrot_find_caller_lex_p_sc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_SC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1023 */
+    "get_namespace",
+    "get_namespace_p",
+    "Parrot_get_namespace_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1024 */
+    "get_namespace",
+    "get_namespace_p_p",
+    "Parrot_get_namespace_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1025 */
+    "get_namespace",
+    "get_namespace_p_pc",
+    "Parrot_get_namespace_p_pc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_PC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1026 */
+    "get_hll_namespace",
+    "get_hll_namespace_p",
+    "Parrot_get_hll_namespace_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1027 */
+    "get_hll_namespace",
+    "get_hll_namespace_p_p",
+    "Parrot_get_hll_namespace_p_p",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1028 */
+    "get_hll_namespace",
+    "get_hll_namespace_p_pc",
+    "Parrot_get_hll_namespace_p_pc",
+    0,
+    3,
+    { PARROT_ARG_P, PARROT_ARG_PC },
+    { PARROT_ARGDIR_OUT, PARROT_ARGDIR_IN },
+    { 0, 0 },
+    &core_op_lib
+  },
+  { /* 1029 */
+    "get_root_namespace",
+    "get_root_namespace_p",
+    "Parrot_get_root_namespace_p",
+    0,
+    2,
+    { PARROT_ARG_P },
+    { PARROT_ARGDIR_OUT },
+    { 0 },
+    &core_op_lib
+  },
+  { /* 1030 */
+    "get_root_namespace",
     "get_root_namespace_p_p",
     "Parrot_get_root_namespace_p_p",
     0,
@@ -12302,7 +12590,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1007 */
+  { /* 1031 */
     "get_root_namespace",
     "get_root_namespace_p_pc",
     "Parrot_get_root_namespace_p_pc",
@@ -12313,7 +12601,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1008 */
+  { /* 1032 */
     "get_global",
     "get_global_p_s",
     "Parrot_get_global_p_s",
@@ -12324,7 +12612,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1009 */
+  { /* 1033 */
     "get_global",
     "get_global_p_sc",
     "Parrot_get_global_p_sc",
@@ -12335,7 +12623,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1010 */
+  { /* 1034 */
     "get_global",
     "get_global_p_p_s",
     "Parrot_get_global_p_p_s",
@@ -12346,7 +12634,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1011 */
+  { /* 1035 */
     "get_global",
     "get_global_p_pc_s",
     "Parrot_get_global_p_pc_s",
@@ -12357,7 +12645,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1012 */
+  { /* 1036 */
     "get_global",
     "get_global_p_p_sc",
     "Parrot_get_global_p_p_sc",
@@ -12368,7 +12656,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1013 */
+  { /* 1037 */
     "get_global",
     "get_global_p_pc_sc",
     "Parrot_get_global_p_pc_sc",
@@ -12379,7 +12667,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1014 */
+  { /* 1038 */
     "get_hll_global",
     "get_hll_global_p_s",
     "Parrot_get_hll_global_p_s",
@@ -12390,7 +12678,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1015 */
+  { /* 1039 */
     "get_hll_global",
     "get_hll_global_p_sc",
     "Parrot_get_hll_global_p_sc",
@@ -12401,7 +12689,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1016 */
+  { /* 1040 */
     "get_hll_global",
     "get_hll_global_p_p_s",
     "Parrot_get_hll_global_p_p_s",
@@ -12412,7 +12700,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1017 */
+  { /* 1041 */
     "get_hll_global",
     "get_hll_global_p_pc_s",
     "Parrot_get_hll_global_p_pc_s",
@@ -12423,7 +12711,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1018 */
+  { /* 1042 */
     "get_hll_global",
     "get_hll_global_p_p_sc",
     "Parrot_get_hll_global_p_p_sc",
@@ -12434,7 +12722,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1019 */
+  { /* 1043 */
     "get_hll_global",
     "get_hll_global_p_pc_sc",
     "Parrot_get_hll_global_p_pc_sc",
@@ -12445,7 +12733,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1020 */
+  { /* 1044 */
     "get_root_global",
     "get_root_global_p_s",
     "Parrot_get_root_global_p_s",
@@ -12456,7 +12744,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1021 */
+  { /* 1045 */
     "get_root_global",
     "get_root_global_p_sc",
     "Parrot_get_root_global_p_sc",
@@ -12467,7 +12755,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1022 */
+  { /* 1046 */
     "get_root_global",
     "get_root_global_p_p_s",
     "Parrot_get_root_global_p_p_s",
@@ -12478,7 +12766,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1023 */
+  { /* 1047 */
     "get_root_global",
     "get_root_global_p_pc_s",
     "Parrot_get_root_global_p_pc_s",
@@ -12489,7 +12777,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1024 */
+  { /* 1048 */
     "get_root_global",
     "get_root_global_p_p_sc",
     "Parrot_get_root_global_p_p_sc",
@@ -12500,7 +12788,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1025 */
+  { /* 1049 */
     "get_root_global",
     "get_root_global_p_pc_sc",
     "Parrot_get_root_global_p_pc_sc",
@@ -12511,7 +12799,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1026 */
+  { /* 1050 */
     "set_global",
     "set_global_s_p",
     "Parrot_set_global_s_p",
@@ -12522,7 +12810,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1027 */
+  { /* 1051 */
     "set_global",
     "set_global_sc_p",
     "Parrot_set_global_sc_p",
@@ -12533,7 +12821,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1028 */
+  { /* 1052 */
     "set_global",
     "set_global_p_s_p",
     "Parrot_set_global_p_s_p",
@@ -12544,7 +12832,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1029 */
+  { /* 1053 */
     "set_global",
     "set_global_pc_s_p",
     "Parrot_set_global_pc_s_p",
@@ -12555,7 +12843,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1030 */
+  { /* 1054 */
     "set_global",
     "set_global_p_sc_p",
     "Parrot_set_global_p_sc_p",
@@ -12566,7 +12854,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1031 */
+  { /* 1055 */
     "set_global",
     "set_global_pc_sc_p",
     "Parrot_set_global_pc_sc_p",
@@ -12577,7 +12865,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1032 */
+  { /* 1056 */
     "set_hll_global",
     "set_hll_global_s_p",
     "Parrot_set_hll_global_s_p",
@@ -12588,7 +12876,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1033 */
+  { /* 1057 */
     "set_hll_global",
     "set_hll_global_sc_p",
     "Parrot_set_hll_global_sc_p",
@@ -12599,7 +12887,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1034 */
+  { /* 1058 */
     "set_hll_global",
     "set_hll_global_p_s_p",
     "Parrot_set_hll_global_p_s_p",
@@ -12610,7 +12898,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1035 */
+  { /* 1059 */
     "set_hll_global",
     "set_hll_global_pc_s_p",
     "Parrot_set_hll_global_pc_s_p",
@@ -12621,7 +12909,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1036 */
+  { /* 1060 */
     "set_hll_global",
     "set_hll_global_p_sc_p",
     "Parrot_set_hll_global_p_sc_p",
@@ -12632,7 +12920,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1037 */
+  { /* 1061 */
     "set_hll_global",
     "set_hll_global_pc_sc_p",
     "Parrot_set_hll_global_pc_sc_p",
@@ -12643,7 +12931,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1038 */
+  { /* 1062 */
     "set_root_global",
     "set_root_global_s_p",
     "Parrot_set_root_global_s_p",
@@ -12654,7 +12942,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1039 */
+  { /* 1063 */
     "set_root_global",
     "set_root_global_sc_p",
     "Parrot_set_root_global_sc_p",
@@ -12665,7 +12953,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1040 */
+  { /* 1064 */
     "set_root_global",
     "set_root_global_p_s_p",
     "Parrot_set_root_global_p_s_p",
@@ -12676,7 +12964,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1041 */
+  { /* 1065 */
     "set_root_global",
     "set_root_global_pc_s_p",
     "Parrot_set_root_global_pc_s_p",
@@ -12687,7 +12975,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1042 */
+  { /* 1066 */
     "set_root_global",
     "set_root_global_p_sc_p",
     "Parrot_set_root_global_p_sc_p",
@@ -12698,7 +12986,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1043 */
+  { /* 1067 */
     "set_root_global",
     "set_root_global_pc_sc_p",
     "Parrot_set_root_global_pc_sc_p",
@@ -12709,7 +12997,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1044 */
+  { /* 1068 */
     "find_name",
     "find_name_p_s",
     "Parrot_find_name_p_s",
@@ -12720,7 +13008,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1045 */
+  { /* 1069 */
     "find_name",
     "find_name_p_sc",
     "Parrot_find_name_p_sc",
@@ -12731,7 +13019,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1046 */
+  { /* 1070 */
     "find_sub_not_null",
     "find_sub_not_null_p_s",
     "Parrot_find_sub_not_null_p_s",
@@ -12742,7 +13030,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1047 */
+  { /* 1071 */
     "find_sub_not_null",
     "find_sub_not_null_p_sc",
     "Parrot_find_sub_not_null_p_sc",
@@ -12753,7 +13041,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1048 */
+  { /* 1072 */
     "trap",
     "trap",
     "Parrot_trap",
@@ -12764,7 +13052,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1049 */
+  { /* 1073 */
     "set_label",
     "set_label_p_ic",
     "Parrot_set_label_p_ic",
@@ -12775,7 +13063,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 1 },
     &core_op_lib
   },
-  { /* 1050 */
+  { /* 1074 */
     "get_label",
     "get_label_i_p",
     "Parrot_get_label_i_p",
@@ -12786,7 +13074,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1051 */
+  { /* 1075 */
     "get_id",
     "get_id_i_p",
     "Parrot_get_id_i_p",
@@ -12797,7 +13085,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1052 */
+  { /* 1076 */
     "get_id",
     "get_id_i_pc",
     "Parrot_get_id_i_pc",
@@ -12808,7 +13096,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1053 */
+  { /* 1077 */
     "fetch",
     "fetch_p_p_p_p",
     "Parrot_fetch_p_p_p_p",
@@ -12819,7 +13107,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1054 */
+  { /* 1078 */
     "fetch",
     "fetch_p_pc_p_p",
     "Parrot_fetch_p_pc_p_p",
@@ -12830,7 +13118,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1055 */
+  { /* 1079 */
     "fetch",
     "fetch_p_p_pc_p",
     "Parrot_fetch_p_p_pc_p",
@@ -12841,7 +13129,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1056 */
+  { /* 1080 */
     "fetch",
     "fetch_p_pc_pc_p",
     "Parrot_fetch_p_pc_pc_p",
@@ -12852,7 +13140,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1057 */
+  { /* 1081 */
     "fetch",
     "fetch_p_p_p_pc",
     "Parrot_fetch_p_p_p_pc",
@@ -12863,7 +13151,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1058 */
+  { /* 1082 */
     "fetch",
     "fetch_p_pc_p_pc",
     "Parrot_fetch_p_pc_p_pc",
@@ -12874,7 +13162,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1059 */
+  { /* 1083 */
     "fetch",
     "fetch_p_p_pc_pc",
     "Parrot_fetch_p_p_pc_pc",
@@ -12885,7 +13173,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1060 */
+  { /* 1084 */
     "fetch",
     "fetch_p_pc_pc_pc",
     "Parrot_fetch_p_pc_pc_pc",
@@ -12896,7 +13184,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1061 */
+  { /* 1085 */
     "fetch",
     "fetch_p_p_i_p",
     "Parrot_fetch_p_p_i_p",
@@ -12907,7 +13195,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1062 */
+  { /* 1086 */
     "fetch",
     "fetch_p_pc_i_p",
     "Parrot_fetch_p_pc_i_p",
@@ -12918,7 +13206,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1063 */
+  { /* 1087 */
     "fetch",
     "fetch_p_p_ic_p",
     "Parrot_fetch_p_p_ic_p",
@@ -12929,7 +13217,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1064 */
+  { /* 1088 */
     "fetch",
     "fetch_p_pc_ic_p",
     "Parrot_fetch_p_pc_ic_p",
@@ -12940,7 +13228,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1065 */
+  { /* 1089 */
     "fetch",
     "fetch_p_p_i_pc",
     "Parrot_fetch_p_p_i_pc",
@@ -12951,7 +13239,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1066 */
+  { /* 1090 */
     "fetch",
     "fetch_p_pc_i_pc",
     "Parrot_fetch_p_pc_i_pc",
@@ -12962,7 +13250,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1067 */
+  { /* 1091 */
     "fetch",
     "fetch_p_p_ic_pc",
     "Parrot_fetch_p_p_ic_pc",
@@ -12973,7 +13261,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1068 */
+  { /* 1092 */
     "fetch",
     "fetch_p_pc_ic_pc",
     "Parrot_fetch_p_pc_ic_pc",
@@ -12984,7 +13272,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1069 */
+  { /* 1093 */
     "fetch",
     "fetch_p_p_s_p",
     "Parrot_fetch_p_p_s_p",
@@ -12995,7 +13283,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1070 */
+  { /* 1094 */
     "fetch",
     "fetch_p_pc_s_p",
     "Parrot_fetch_p_pc_s_p",
@@ -13006,7 +13294,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1071 */
+  { /* 1095 */
     "fetch",
     "fetch_p_p_sc_p",
     "Parrot_fetch_p_p_sc_p",
@@ -13017,7 +13305,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1072 */
+  { /* 1096 */
     "fetch",
     "fetch_p_pc_sc_p",
     "Parrot_fetch_p_pc_sc_p",
@@ -13028,7 +13316,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1073 */
+  { /* 1097 */
     "fetch",
     "fetch_p_p_s_pc",
     "Parrot_fetch_p_p_s_pc",
@@ -13039,7 +13327,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1074 */
+  { /* 1098 */
     "fetch",
     "fetch_p_pc_s_pc",
     "Parrot_fetch_p_pc_s_pc",
@@ -13050,7 +13338,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1075 */
+  { /* 1099 */
     "fetch",
     "fetch_p_p_sc_pc",
     "Parrot_fetch_p_p_sc_pc",
@@ -13061,7 +13349,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1076 */
+  { /* 1100 */
     "fetch",
     "fetch_p_pc_sc_pc",
     "Parrot_fetch_p_pc_sc_pc",
@@ -13072,7 +13360,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1077 */
+  { /* 1101 */
     "vivify",
     "vivify_p_p_p_p",
     "Parrot_vivify_p_p_p_p",
@@ -13083,7 +13371,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1078 */
+  { /* 1102 */
     "vivify",
     "vivify_p_pc_p_p",
     "Parrot_vivify_p_pc_p_p",
@@ -13094,7 +13382,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1079 */
+  { /* 1103 */
     "vivify",
     "vivify_p_p_pc_p",
     "Parrot_vivify_p_p_pc_p",
@@ -13105,7 +13393,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1080 */
+  { /* 1104 */
     "vivify",
     "vivify_p_pc_pc_p",
     "Parrot_vivify_p_pc_pc_p",
@@ -13116,7 +13404,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1081 */
+  { /* 1105 */
     "vivify",
     "vivify_p_p_p_pc",
     "Parrot_vivify_p_p_p_pc",
@@ -13127,7 +13415,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1082 */
+  { /* 1106 */
     "vivify",
     "vivify_p_pc_p_pc",
     "Parrot_vivify_p_pc_p_pc",
@@ -13138,7 +13426,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1083 */
+  { /* 1107 */
     "vivify",
     "vivify_p_p_pc_pc",
     "Parrot_vivify_p_p_pc_pc",
@@ -13149,7 +13437,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1084 */
+  { /* 1108 */
     "vivify",
     "vivify_p_pc_pc_pc",
     "Parrot_vivify_p_pc_pc_pc",
@@ -13160,7 +13448,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1085 */
+  { /* 1109 */
     "vivify",
     "vivify_p_p_i_p",
     "Parrot_vivify_p_p_i_p",
@@ -13171,7 +13459,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1086 */
+  { /* 1110 */
     "vivify",
     "vivify_p_pc_i_p",
     "Parrot_vivify_p_pc_i_p",
@@ -13182,7 +13470,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1087 */
+  { /* 1111 */
     "vivify",
     "vivify_p_p_ic_p",
     "Parrot_vivify_p_p_ic_p",
@@ -13193,7 +13481,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1088 */
+  { /* 1112 */
     "vivify",
     "vivify_p_pc_ic_p",
     "Parrot_vivify_p_pc_ic_p",
@@ -13204,7 +13492,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1089 */
+  { /* 1113 */
     "vivify",
     "vivify_p_p_i_pc",
     "Parrot_vivify_p_p_i_pc",
@@ -13215,7 +13503,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1090 */
+  { /* 1114 */
     "vivify",
     "vivify_p_pc_i_pc",
     "Parrot_vivify_p_pc_i_pc",
@@ -13226,7 +13514,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1091 */
+  { /* 1115 */
     "vivify",
     "vivify_p_p_ic_pc",
     "Parrot_vivify_p_p_ic_pc",
@@ -13237,7 +13525,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1092 */
+  { /* 1116 */
     "vivify",
     "vivify_p_pc_ic_pc",
     "Parrot_vivify_p_pc_ic_pc",
@@ -13248,7 +13536,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1093 */
+  { /* 1117 */
     "vivify",
     "vivify_p_p_s_p",
     "Parrot_vivify_p_p_s_p",
@@ -13259,7 +13547,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1094 */
+  { /* 1118 */
     "vivify",
     "vivify_p_pc_s_p",
     "Parrot_vivify_p_pc_s_p",
@@ -13270,7 +13558,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1095 */
+  { /* 1119 */
     "vivify",
     "vivify_p_p_sc_p",
     "Parrot_vivify_p_p_sc_p",
@@ -13281,7 +13569,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1096 */
+  { /* 1120 */
     "vivify",
     "vivify_p_pc_sc_p",
     "Parrot_vivify_p_pc_sc_p",
@@ -13292,7 +13580,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1097 */
+  { /* 1121 */
     "vivify",
     "vivify_p_p_s_pc",
     "Parrot_vivify_p_p_s_pc",
@@ -13303,7 +13591,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1098 */
+  { /* 1122 */
     "vivify",
     "vivify_p_pc_s_pc",
     "Parrot_vivify_p_pc_s_pc",
@@ -13314,7 +13602,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1099 */
+  { /* 1123 */
     "vivify",
     "vivify_p_p_sc_pc",
     "Parrot_vivify_p_p_sc_pc",
@@ -13325,7 +13613,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1100 */
+  { /* 1124 */
     "vivify",
     "vivify_p_pc_sc_pc",
     "Parrot_vivify_p_pc_sc_pc",
@@ -13336,7 +13624,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1101 */
+  { /* 1125 */
     "new",
     "new_p_s_i",
     "Parrot_new_p_s_i",
@@ -13347,7 +13635,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1102 */
+  { /* 1126 */
     "new",
     "new_p_sc_i",
     "Parrot_new_p_sc_i",
@@ -13358,7 +13646,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1103 */
+  { /* 1127 */
     "new",
     "new_p_s_ic",
     "Parrot_new_p_s_ic",
@@ -13369,7 +13657,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1104 */
+  { /* 1128 */
     "new",
     "new_p_sc_ic",
     "Parrot_new_p_sc_ic",
@@ -13380,7 +13668,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1105 */
+  { /* 1129 */
     "new",
     "new_p_p_i",
     "Parrot_new_p_p_i",
@@ -13391,7 +13679,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1106 */
+  { /* 1130 */
     "new",
     "new_p_pc_i",
     "Parrot_new_p_pc_i",
@@ -13402,7 +13690,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1107 */
+  { /* 1131 */
     "new",
     "new_p_p_ic",
     "Parrot_new_p_p_ic",
@@ -13413,7 +13701,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1108 */
+  { /* 1132 */
     "new",
     "new_p_pc_ic",
     "Parrot_new_p_pc_ic",
@@ -13424,7 +13712,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1109 */
+  { /* 1133 */
     "root_new",
     "root_new_p_p_i",
     "Parrot_root_new_p_p_i",
@@ -13435,7 +13723,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1110 */
+  { /* 1134 */
     "root_new",
     "root_new_p_pc_i",
     "Parrot_root_new_p_pc_i",
@@ -13446,7 +13734,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1111 */
+  { /* 1135 */
     "root_new",
     "root_new_p_p_ic",
     "Parrot_root_new_p_p_ic",
@@ -13457,7 +13745,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1112 */
+  { /* 1136 */
     "root_new",
     "root_new_p_pc_ic",
     "Parrot_root_new_p_pc_ic",
@@ -13468,7 +13756,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1113 */
+  { /* 1137 */
     "get_context",
     "get_context_p",
     "Parrot_get_context_p",
@@ -13479,7 +13767,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1114 */
+  { /* 1138 */
     "new_call_context",
     "new_call_context_p",
     "Parrot_new_call_context_p",
@@ -13490,7 +13778,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1115 */
+  { /* 1139 */
     "invokecc",
     "invokecc_p_p",
     "Parrot_invokecc_p_p",
@@ -13501,7 +13789,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0 },
     &core_op_lib
   },
-  { /* 1116 */
+  { /* 1140 */
     "flatten_array_into",
     "flatten_array_into_p_p_i",
     "Parrot_flatten_array_into_p_p_i",
@@ -13512,7 +13800,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1117 */
+  { /* 1141 */
     "flatten_array_into",
     "flatten_array_into_p_p_ic",
     "Parrot_flatten_array_into_p_p_ic",
@@ -13523,7 +13811,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1118 */
+  { /* 1142 */
     "flatten_hash_into",
     "flatten_hash_into_p_p_i",
     "Parrot_flatten_hash_into_p_p_i",
@@ -13534,7 +13822,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1119 */
+  { /* 1143 */
     "flatten_hash_into",
     "flatten_hash_into_p_p_ic",
     "Parrot_flatten_hash_into_p_p_ic",
@@ -13545,7 +13833,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1120 */
+  { /* 1144 */
     "slurp_array_from",
     "slurp_array_from_p_p_i",
     "Parrot_slurp_array_from_p_p_i",
@@ -13556,7 +13844,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1121 */
+  { /* 1145 */
     "slurp_array_from",
     "slurp_array_from_p_p_ic",
     "Parrot_slurp_array_from_p_p_ic",
@@ -13567,7 +13855,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0, 0, 0 },
     &core_op_lib
   },
-  { /* 1122 */
+  { /* 1146 */
     "receive",
     "receive_p",
     "Parrot_receive_p",
@@ -13578,7 +13866,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1123 */
+  { /* 1147 */
     "wait",
     "wait_p",
     "Parrot_wait_p",
@@ -13589,7 +13877,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1124 */
+  { /* 1148 */
     "wait",
     "wait_pc",
     "Parrot_wait_pc",
@@ -13600,7 +13888,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1125 */
+  { /* 1149 */
     "pass",
     "pass",
     "Parrot_pass",
@@ -13611,7 +13899,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1126 */
+  { /* 1150 */
     "disable_preemption",
     "disable_preemption",
     "Parrot_disable_preemption",
@@ -13622,7 +13910,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1127 */
+  { /* 1151 */
     "enable_preemption",
     "enable_preemption",
     "Parrot_enable_preemption",
@@ -13633,7 +13921,7 @@ static op_info_t core_op_info_table[1130] = {
     { 0 },
     &core_op_lib
   },
-  { /* 1128 */
+  { /* 1152 */
     "terminate",
     "terminate",
     "Parrot_terminate",
@@ -13976,8 +14264,7 @@ Parrot_get_params_pc(opcode_t *cur_opcode, PARROT_INTERP) {
     Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_PARAM_COUNT_FLAG);
     if ((PObj_get_FLAGS(ccont) & SUB_FLAG_TAILCALL)) {
         (PObj_get_FLAGS(ccont) &= (~SUB_FLAG_TAILCALL));
-        Parrot_pcc_dec_recursion_depth(interp, ctx);
-        Parrot_pcc_set_caller_ctx(interp, ctx, Parrot_pcc_get_caller_ctx(interp, caller_ctx));
+        Parrot_pcc_finish_tailcall(interp, ctx);
     }
 
     GETATTR_FixedIntegerArray_size(interp, signature, argc);
@@ -14005,6 +14292,10 @@ Parrot_get_results_pc(opcode_t *cur_opcode, PARROT_INTERP) {
     INTVAL   argc;
 
     Parrot_pcc_fill_params_from_op(interp, call_object, signature, raw_params, PARROT_ERRORS_RESULT_COUNT_FLAG);
+    if (((!PMC_IS_NULL(call_object)) && (call_object != ctx))) {
+        Parrot_pcc_recycle_context(interp, call_object);
+    }
+
     GETATTR_FixedIntegerArray_size(interp, signature, argc);
     Parrot_pcc_set_signature(interp, CURRENT_CONTEXT(interp), PMCNULL);
     return cur_opcode + (argc + 2);
@@ -14088,10 +14379,7 @@ Parrot_addhandler_p(opcode_t *cur_opcode, PARROT_INTERP) {
 
 opcode_t *
 Parrot_push_eh_ic(opcode_t *cur_opcode, PARROT_INTERP) {
-    PMC  * const  eh = Parrot_pmc_new(interp, enum_class_ExceptionHandler);
-
-    VTABLE_set_pointer(interp, eh, (CUR_OPCODE + ICONST(1)));
-    Parrot_cx_add_handler_local(interp, eh);
+    Parrot_cx_add_label_handler_local(interp, (CUR_OPCODE + ICONST(1)));
     return cur_opcode + 2;
 }
 
@@ -20063,6 +20351,19 @@ Parrot_thaw_p_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 3;
 }
 
+opcode_t *
+Parrot_freeze_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    Parrot_freeze_to_handle(interp, PREG(2), PREG(1));
+    return cur_opcode + 3;
+}
+
+opcode_t *
+Parrot_thaw_p_p(opcode_t *cur_opcode, PARROT_INTERP) {
+    PREG(1) = Parrot_thaw_from_handle(interp, PREG(2));
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 3;
+}
+
 opcode_t *
 Parrot_add_multi_s_s_p(opcode_t *cur_opcode, PARROT_INTERP) {
     Parrot_mmd_add_multi_from_long_sig(interp, SREG(1), SREG(2), PREG(3));
@@ -22613,6 +22914,504 @@ Parrot_find_lex_n_sc(opcode_t *cur_opcode, PARROT_INTERP) {
     return cur_opcode + 3;
 }
 
+opcode_t *
+Parrot_find_lex_slot_p_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        PREG(1) = CTX_REG_PMC(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SREG(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_p_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        PREG(1) = CTX_REG_PMC(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        PREG(1) = PMC_IS_NULL(lex_pad) ? PMCNULL : VTABLE_get_pmc_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_s_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        SREG(1) = CTX_REG_STR(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SREG(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_s_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        SREG(1) = CTX_REG_STR(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        SREG(1) = PMC_IS_NULL(lex_pad) ? STRINGNULL : VTABLE_get_string_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    PARROT_GC_WRITE_BARRIER(interp, CURRENT_CONTEXT(interp));
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_i_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        IREG(1) = CTX_REG_INT(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SREG(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_i_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        IREG(1) = CTX_REG_INT(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        IREG(1) = PMC_IS_NULL(lex_pad) ? 0 : VTABLE_get_integer_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_n_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        NREG(1) = CTX_REG_NUM(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SREG(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_find_lex_slot_n_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        NREG(1) = CTX_REG_NUM(interp, lex_ctx, ICONST(4));
+    }
+    else {
+        STRING  * const  lex_name = SCONST(2);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        NREG(1) = PMC_IS_NULL(lex_pad) ? 0.0 : VTABLE_get_number_keyed_str(interp, lex_pad, lex_name);
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_PMC(interp, lex_ctx, ICONST(4)) = PREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_p_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_PMC(interp, lex_ctx, ICONST(4)) = PREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_pmc_keyed_str(interp, lex_pad, lex_name, PREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_STR(interp, lex_ctx, ICONST(4)) = SREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_s_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_STR(interp, lex_ctx, ICONST(4)) = SREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_STR(interp, lex_ctx, ICONST(4)) = SCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_sc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_STR(interp, lex_ctx, ICONST(4)) = SCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_string_keyed_str(interp, lex_pad, lex_name, SCONST(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_INT(interp, lex_ctx, ICONST(4)) = IREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_i_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_INT(interp, lex_ctx, ICONST(4)) = IREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, IREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_ic_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_INT(interp, lex_ctx, ICONST(4)) = ICONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_ic_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_INT(interp, lex_ctx, ICONST(4)) = ICONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_integer_keyed_str(interp, lex_pad, lex_name, ICONST(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_n_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_NUM(interp, lex_ctx, ICONST(4)) = NREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_n_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_NUM(interp, lex_ctx, ICONST(4)) = NREG(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NREG(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_s_nc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_NUM(interp, lex_ctx, ICONST(4)) = NCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SREG(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    }
+
+    return cur_opcode + 5;
+}
+
+opcode_t *
+Parrot_store_lex_slot_sc_nc_ic_ic(opcode_t *cur_opcode, PARROT_INTERP) {
+    PMC  * const  ctx = CURRENT_CONTEXT(interp);
+    PMC  * const  lex_ctx = Parrot_sub_find_lex_slot_ctx(interp, ctx, ICONST(3));
+
+    if (lex_ctx) {
+        CTX_REG_NUM(interp, lex_ctx, ICONST(4)) = NCONST(2);
+        PARROT_GC_WRITE_BARRIER(interp, lex_ctx);
+    }
+    else {
+        STRING  * const  lex_name = SCONST(1);
+        PMC     * const  lex_pad = Parrot_sub_find_pad(interp, lex_name, ctx);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            opcode_t  * const  handler = Parrot_ex_throw_from_op_args(interp, NULL, EXCEPTION_LEX_NOT_FOUND, "Lexical '%Ss' not found", lex_name);
+
+            return (opcode_t *)handler;
+        }
+
+        VTABLE_set_number_keyed_str(interp, lex_pad, lex_name, NCONST(2));
+    }
+
+    return cur_opcode + 5;
+}
+
 opcode_t *
 Parrot_find_dynamic_lex_p_s(opcode_t *cur_opcode, PARROT_INTERP) {
     STRING   * const  lex_name = SREG(2);
@@ -24634,7 +25433,7 @@ op_lib_t core_op_lib = {
   0,                                /* flags */
   PARROT_PBC_MAJOR,
   PARROT_PBC_MINOR,
-  1129,             /* op_count */
+  1153,             /* op_count */
   core_op_info_table,       /* op_info_table */
   core_op_func_table,       /* op_func_table */
   get_op          /* op_code() */ 
@@ -27,6 +27,7 @@ format of bytecode.
 */
 
 #include "pf_private.h"
+#include "parrot/oplib/ops.h"
 #include "api.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_packfileview.h"
@@ -36,6 +37,16 @@ format of bytecode.
 /* HEADERIZER BEGIN: static */
 /* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
 
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC * annotation_value_at(PARROT_INTERP,
+    ARGIN(const PackFile_Annotations *self),
+    ARGIN(const PackFile_Annotations_Key *key),
+    opcode_t offset)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
 static void compile_file(PARROT_INTERP, ARGIN(STRING *path), INTVAL is_pasm)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
@@ -72,10 +83,10 @@ static INTVAL find_const_iter(PARROT_INTERP,
 
 PARROT_PURE_FUNCTION
 PARROT_WARN_UNUSED_RESULT
-static INTVAL find_pf_ann_idx(
-    ARGIN(PackFile_Annotations *pfa),
-    ARGIN(PackFile_Annotations_Key *key),
-    UINTVAL offs)
+static UINTVAL find_pf_ann_bound(
+    ARGIN(const PackFile_Annotations *pfa),
+    ARGIN(const PackFile_Annotations_Key *key),
+    opcode_t offs)
         __attribute__nonnull__(1)
         __attribute__nonnull__(2);
 
@@ -161,6 +172,10 @@ static int sub_pragma(PARROT_INTERP,
         __attribute__nonnull__(1)
         __attribute__nonnull__(3);
 
+#define ASSERT_ARGS_annotation_value_at __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(self) \
+    , PARROT_ASSERT_ARG(key))
 #define ASSERT_ARGS_compile_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(path))
@@ -175,7 +190,7 @@ static int sub_pragma(PARROT_INTERP,
 #define ASSERT_ARGS_find_const_iter __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(interp) \
     , PARROT_ASSERT_ARG(seg))
-#define ASSERT_ARGS_find_pf_ann_idx __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+#define ASSERT_ARGS_find_pf_ann_bound __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
        PARROT_ASSERT_ARG(pfa) \
     , PARROT_ASSERT_ARG(key))
 #define ASSERT_ARGS_load_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
@@ -1694,7 +1709,11 @@ Parrot_new_debug_seg(PARROT_INTERP, ARGMOD(PackFile_ByteCode *cs), size_t size)
     /* it exists already, resize it */
     if (cs->debugs) {
         debug = cs->debugs;
-        debug->base.data = mem_gc_realloc_n_typed(interp, debug->base.data, size, opcode_t);
+        debug->base.data = mem_gc_realloc_n_typed_zeroed(interp, debug->base.data,
+                size, debug->base.size, opcode_t);
+
+        /* the code it describes is growing too: reindex on next lookup */
+        debug->indexed_size = 0;
     }
     /* create one */
     else {
@@ -1776,7 +1795,7 @@ Parrot_debug_add_mapping(PARROT_INTERP, ARGMOD(PackFile_Debug *debug),
             if (debug->mappings[i].offset > offset) {
                 insert_pos = i;
                 memmove(debug->mappings + i + 1, debug->mappings + i,
-                    debug->num_mappings - i);
+                    (debug->num_mappings - i) * sizeof (PackFile_DebugFilenameMapping));
                 break;
             }
         }
@@ -1837,21 +1856,115 @@ Parrot_debug_pc_to_filename(PARROT_INTERP, ARGIN(const PackFile_Debug *debug),
     opcode_t pc)
 {
     ASSERT_ARGS(Parrot_debug_pc_to_filename)
-    /* Look through mappings until we find one that maps the passed
-       bytecode offset. */
-
-    int i;
-    for (i = 0; i < debug->num_mappings; ++i) {
-        /* If this is the last mapping or the current position is
-           between this mapping and the next one, return a filename. */
-       if (i + 1 == debug->num_mappings
-       || (debug->mappings[i].offset     <= pc
-       &&  debug->mappings[i + 1].offset >  pc))
-            return debug->code->const_table->str.constants[debug->mappings[i].filename];
+    /* Mappings are sorted by offset: find the last one at or before pc. */
+    opcode_t lo = 0;
+    opcode_t hi = debug->num_mappings;
+
+    /* No mappings == no filename. */
+    if (!hi)
+        return CONST_STRING(interp, "(unknown file)");
+
+    while (lo < hi) {
+        const opcode_t mid = lo + (hi - lo) / 2;
+
+        if (debug->mappings[mid].offset <= pc)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return debug->code->const_table->str.constants[debug->mappings[lo ? lo - 1 : 0].filename];
+}
+
+/*
+
+=item C<const opcode_t * Parrot_debug_get_op_offsets(PARROT_INTERP,
+PackFile_Debug *debug, opcode_t *count)>
+
+Returns the bytecode offset of each op that C<debug> has a line for, in
+ascending order, and stores their number in C<count>.  Entry C<n> is the op
+whose line is C<debug-E<gt>base.data[n]>.
+
+The index is built by walking the code segment the first time it is needed,
+and again only after the code segment grows.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+const opcode_t *
+Parrot_debug_get_op_offsets(PARROT_INTERP, ARGMOD(PackFile_Debug *debug),
+        ARGOUT(opcode_t *count))
+{
+    ASSERT_ARGS(Parrot_debug_get_op_offsets)
+    PackFile_ByteCode * const code = debug->code;
+
+    if (!debug->op_offsets || debug->indexed_size != code->base.size) {
+        const size_t      code_size = code->base.size;
+        const size_t      max_ops   = debug->base.size;
+        opcode_t         *pc        = code->base.data;
+        opcode_t         *offsets   = debug->op_offsets;
+        size_t            i, n;
+
+        if (max_ops)
+            offsets = mem_gc_realloc_n_typed(interp, offsets, max_ops, opcode_t);
+
+        for (i = n = 0; n < code_size && i < max_ops; ++i) {
+            const op_info_t * const op_info  = code->op_info_table[*pc];
+            opcode_t                var_args = 0;
+
+            offsets[i] = n;
+            ADD_OP_VAR_PART(interp, code, pc, var_args);
+            n  += op_info->op_count + var_args;
+            pc += op_info->op_count + var_args;
+        }
+
+        debug->op_offsets     = offsets;
+        debug->num_op_offsets = i;
+        debug->indexed_size   = code_size;
+    }
+
+    *count = debug->num_op_offsets;
+    return debug->op_offsets;
+}
+
+/*
+
+=item C<INTVAL Parrot_debug_pc_to_line(PARROT_INTERP, PackFile_Debug *debug,
+opcode_t pc)>
+
+Returns the source line of the op at bytecode offset C<pc>, or -1 if the
+debug segment has none.  This is a binary search over the index from
+C<Parrot_debug_get_op_offsets>.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_debug_pc_to_line(PARROT_INTERP, ARGMOD(PackFile_Debug *debug), opcode_t pc)
+{
+    ASSERT_ARGS(Parrot_debug_pc_to_line)
+    opcode_t        count;
+    const opcode_t * const offsets = Parrot_debug_get_op_offsets(interp, debug, &count);
+    opcode_t        lo = 0;
+    opcode_t        hi = count;
+
+    /* the first op starting at or after pc */
+    while (lo < hi) {
+        const opcode_t mid = lo + (hi - lo) / 2;
+
+        if (offsets[mid] < pc)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
 
-    /* Otherwise, no mappings == no filename. */
-    return CONST_STRING(interp, "(unknown file)");
+    return lo < count ? debug->base.data[lo] : -1;
 }
 
 
@@ -1907,47 +2020,37 @@ Parrot_switch_to_cs(PARROT_INTERP, ARGIN(PackFile_ByteCode *new_cs), int really)
 
 /*
 
-=item C<static INTVAL find_pf_ann_idx(PackFile_Annotations *pfa,
-PackFile_Annotations_Key *key, UINTVAL offs)>
+=item C<static UINTVAL find_pf_ann_bound(const PackFile_Annotations *pfa, const
+PackFile_Annotations_Key *key, opcode_t offs)>
 
-Find the index of the active annotation at the given offset.
+Binary searches the entries of C<key>, which are sorted by bytecode offset,
+and returns the index of the first one at or after C<offs>.  The entry in
+force at C<offs> is the one before that, if it belongs to C<key>.
 
 =cut
 
 */
 
-
 PARROT_PURE_FUNCTION
 PARROT_WARN_UNUSED_RESULT
-static INTVAL
-find_pf_ann_idx(ARGIN(PackFile_Annotations *pfa),
-                ARGIN(PackFile_Annotations_Key *key), UINTVAL offs)
+static UINTVAL
+find_pf_ann_bound(ARGIN(const PackFile_Annotations *pfa),
+                ARGIN(const PackFile_Annotations_Key *key), opcode_t offs)
 {
-    ASSERT_ARGS(find_pf_ann_idx)
-    UINTVAL hi, lo;
-
-    lo = key->start;
-    hi = key->start + key->len;
+    ASSERT_ARGS(find_pf_ann_bound)
+    UINTVAL lo = key->start;
+    UINTVAL hi = key->start + key->len;
 
-    while (1) {
-        const UINTVAL mid = (lo + hi) / 2;
-        const UINTVAL mid_val = pfa->base.data[mid * 2 + ANN_ENTRY_OFF];
+    while (lo < hi) {
+        const UINTVAL mid = lo + (hi - lo) / 2;
 
-        if (mid_val < offs) {
-            if (lo == mid)
-                return mid; /* end of range search */
-            lo = mid;
-        }
-        else if (mid_val > offs) {
-            if (hi == key->start)
-                return -1; /* bottomed out */
+        if (pfa->base.data[mid * 2 + ANN_ENTRY_OFF] < offs)
+            lo = mid + 1;
+        else
             hi = mid;
-        }
-        else {
-            /* exact match: retrun prior annotation */
-            return mid - 1;
-        }
     }
+
+    return lo;
 }
 
 /*
@@ -2017,9 +2120,7 @@ PackFile_Annotations_add_entry(PARROT_INTERP, ARGMOD(PackFile_Annotations *self)
     }
 
     /* Lookup position where value will be inserted. */
-    idx = self->keys[key_id].len == 0  ?
-          self->keys[key_id].start * 2 :
-          (UINTVAL)(find_pf_ann_idx(self, &self->keys[key_id], offset) + 1) * 2;
+    idx = find_pf_ann_bound(self, &self->keys[key_id], offset) * 2;
 
     /* Extend segment data and shift subsequent data by 2. */
     self->base.data = (opcode_t *)mem_sys_realloc(self->base.data,
@@ -2066,55 +2167,122 @@ PackFile_Annotations_lookup(PARROT_INTERP, ARGIN(PackFile_Annotations *self),
         /* find all annotations for this offset */
         PMC * const result = Parrot_pmc_new(interp, enum_class_Hash);
         INTVAL i;
-        for (i = 0; i < self->num_keys; i++) {
-            STRING * const k = self->code->const_table->str.constants[self->keys[i].name];
-            PMC    * const v = PackFile_Annotations_lookup(interp, self, offset, k);
+        for (i = 0; i < self->num_keys; ++i) {
+            PMC * const v = annotation_value_at(interp, self, &self->keys[i], offset);
             if (!PMC_IS_NULL(v))
-                VTABLE_set_pmc_keyed_str(interp, result, k, v);
+                VTABLE_set_pmc_keyed_str(interp, result,
+                    self->code->const_table->str.constants[self->keys[i].name], v);
         }
 
         return result;
     }
 
     else {
-        PackFile_Annotations_Key *key = NULL;
-        INTVAL i;
-        opcode_t val;
-
-        for (i = 0; i < self->num_keys; i++) {
-            STRING * const test_key = self->code->const_table->str.constants[self->keys[i].name];
-            if (STRING_equal(interp, test_key, name)) {
-                key = &self->keys[i];
-                break;
-            }
-        }
+        const INTVAL key_id = Parrot_pf_annotations_find_key(interp, self, name);
 
-        if (!key)
+        if (key_id < 0)
             return PMCNULL; /* no such key */
 
-        i = find_pf_ann_idx(self, key, offset);
+        return annotation_value_at(interp, self, &self->keys[key_id], offset);
+    }
+}
 
-        if (i < 0)
-            return PMCNULL; /* no active entry */
+/*
 
-        val = self->base.data[i * 2 + ANN_ENTRY_VAL];
+=item C<static PMC * annotation_value_at(PARROT_INTERP, const
+PackFile_Annotations *self, const PackFile_Annotations_Key *key, opcode_t
+offset)>
 
-        switch (key->type) {
-          case PF_ANNOTATION_KEY_TYPE_INT:
-            return Parrot_pmc_box_integer(interp, val);
-          case PF_ANNOTATION_KEY_TYPE_STR:
-            return Parrot_pmc_box_string(interp, self->code->const_table->str.constants[val]);
-          case PF_ANNOTATION_KEY_TYPE_PMC:
-            return self->code->const_table->pmc.constants[val];
-          default:
-            Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "unexpected annotation type found");
-            return PMCNULL;
-        }
+Returns the value of C<key> in force at the given bytecode offset, or a NULL
+PMC if there is none.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static PMC *
+annotation_value_at(PARROT_INTERP, ARGIN(const PackFile_Annotations *self),
+        ARGIN(const PackFile_Annotations_Key *key), opcode_t offset)
+{
+    ASSERT_ARGS(annotation_value_at)
+    const UINTVAL i = find_pf_ann_bound(self, key, offset);
+    opcode_t      val;
+
+    if (i == key->start)
+        return PMCNULL; /* no active entry */
+
+    val = self->base.data[(i - 1) * 2 + ANN_ENTRY_VAL];
+
+    switch (key->type) {
+      case PF_ANNOTATION_KEY_TYPE_INT:
+        return Parrot_pmc_box_integer(interp, val);
+      case PF_ANNOTATION_KEY_TYPE_STR:
+        return Parrot_pmc_box_string(interp, self->code->const_table->str.constants[val]);
+      case PF_ANNOTATION_KEY_TYPE_PMC:
+        return self->code->const_table->pmc.constants[val];
+      default:
+        Parrot_warn(interp, PARROT_WARNINGS_ALL_FLAG, "unexpected annotation type found");
+        return PMCNULL;
     }
 }
 
 /*
 
+=item C<INTVAL Parrot_pf_annotations_find_key(PARROT_INTERP, const
+PackFile_Annotations *self, STRING *name)>
+
+Returns the index into C<self-E<gt>keys> of the annotation key called
+C<name>, or -1 if the segment has no such key.
+
+=item C<opcode_t Parrot_pf_annotations_range(const PackFile_Annotations *self,
+INTVAL key_id, opcode_t start, opcode_t end, opcode_t *first)>
+
+Finds the entries of key C<key_id> whose bytecode offsets lie in
+C<[start, end)>, such as the C<line> annotations of one sub.  Returns how many
+there are, and stores the index of the first in C<first>; entry C<n> is at
+C<self-E<gt>base.data[n * 2]>.  Both lookups are binary searches over the
+key's sorted entries.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pf_annotations_find_key(PARROT_INTERP, ARGIN(const PackFile_Annotations *self),
+        ARGIN(STRING *name))
+{
+    ASSERT_ARGS(Parrot_pf_annotations_find_key)
+    INTVAL i;
+
+    for (i = 0; i < self->num_keys; ++i) {
+        STRING * const test_key = self->code->const_table->str.constants[self->keys[i].name];
+        if (STRING_equal(interp, test_key, name))
+            return i;
+    }
+
+    return -1;
+}
+
+PARROT_EXPORT
+opcode_t
+Parrot_pf_annotations_range(ARGIN(const PackFile_Annotations *self), INTVAL key_id,
+        opcode_t start, opcode_t end, ARGOUT(opcode_t *first))
+{
+    ASSERT_ARGS(Parrot_pf_annotations_range)
+    const PackFile_Annotations_Key * const key = &self->keys[key_id];
+    const UINTVAL lo = find_pf_ann_bound(self, key, start);
+    const UINTVAL hi = find_pf_ann_bound(self, key, end);
+
+    *first = lo;
+    return hi - lo;
+}
+
+/*
+
 =item C<PackFile_Annotations * Parrot_pf_get_annotations_segment(PARROT_INTERP,
 PackFile *pf, PackFile_ByteCode *bc)>
 
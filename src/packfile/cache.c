@@ -0,0 +1,511 @@
+/*
+Copyright (C) 2012, Parrot Foundation.
+This program is free software. It is subject to the same license as
+Parrot itself.
+
+=head1 NAME
+
+src/packfile/cache.c - On-disk cache of compiled packfiles
+
+=head1 DESCRIPTION
+
+When the C<PARROT_BYTECODE_CACHE> environment variable names a directory,
+compilers may keep the packfiles they produce there, and look them up again
+instead of recompiling an unchanged source.
+
+The compiler describes everything its output depends on in an identifier
+string: source text, included files, options.  The identifier is hashed
+together with the Parrot version and bytecode format version into the name of
+the cache entry, so stale entries are never found, only left behind.  Each
+entry is an ordinary F<.pbc> file, written under a temporary name and renamed
+into place so that concurrent processes never see half an entry.  A compiler
+may store a blob of its own state next to it, to restore on a hit whatever
+else compiling the source would have done.
+
+Failures to read or write the cache are never errors; the caller just
+compiles as if the cache were not there.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/parrot.h"
+#include "parrot/packfile.h"
+#include "parrot/events.h"
+#include "parrot/oplib/core_ops.h"
+#include "pmc/pmc_sub.h"
+#include "cache.str"
+
+/* FNV-1a, run in several lanes to give a cache entry name wide enough that
+ * identifiers never collide in practice */
+#define CACHE_HASH_LANES  4
+#define CACHE_FNV_OFFSET  2166136261U
+#define CACHE_FNV_PRIME   16777619U
+
+/* HEADERIZER HFILE: include/parrot/packfile.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * cache_dir(PARROT_INTERP)
+        __attribute__nonnull__(1);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * cache_entry_name(PARROT_INTERP, ARGIN(STRING *id))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL cacheable(PARROT_INTERP, ARGIN(PMC *pf_pmc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL hash_bytes(ARGIN(const char *buf), size_t len, UINTVAL hash)
+        __attribute__nonnull__(1);
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING * read_cache_file(PARROT_INTERP, ARGIN(STRING *path))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void write_cache_file(PARROT_INTERP,
+    ARGIN(STRING *path),
+    ARGIN(const char *buf),
+    size_t len)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_cache_dir __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp))
+#define ASSERT_ARGS_cache_entry_name __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(id))
+#define ASSERT_ARGS_cacheable __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(pf_pmc))
+#define ASSERT_ARGS_hash_bytes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(buf))
+#define ASSERT_ARGS_read_cache_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path))
+#define ASSERT_ARGS_write_cache_file __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(path) \
+    , PARROT_ASSERT_ARG(buf))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<INTVAL Parrot_pf_cache_enabled(PARROT_INTERP)>
+
+Return true if the C<PARROT_BYTECODE_CACHE> environment variable names a
+cache directory.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+INTVAL
+Parrot_pf_cache_enabled(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_pf_cache_enabled)
+    return !STRING_IS_NULL(cache_dir(interp));
+}
+
+/*
+
+=item C<PMC * Parrot_pf_cache_find(PARROT_INTERP, STRING *id, STRING *path,
+STRING **state)>
+
+Look up the packfile cached for C<id> and return a new PackfileView for it,
+named C<path>, or PMCNULL if there is none.  If C<state> is given, the blob
+stored with the entry goes there, and an entry without one is a miss.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CANNOT_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC *
+Parrot_pf_cache_find(PARROT_INTERP, ARGIN(STRING *id), ARGIN_NULLOK(STRING *path),
+        ARGOUT_NULLOK(STRING **state))
+{
+    ASSERT_ARGS(Parrot_pf_cache_find)
+    STRING * const entry   = cache_entry_name(interp, id);
+    STRING * const pbc_ext = CONST_STRING(interp, ".pbc");
+    STRING        *bytes;
+    PackFile      *pf;
+    Parrot_runloop jmp;
+    INTVAL         ok = 0;
+
+    if (STRING_IS_NULL(entry))
+        return PMCNULL;
+
+    if (state) {
+        STRING * const state_ext = CONST_STRING(interp, ".state");
+        *state = read_cache_file(interp, Parrot_str_concat(interp, entry, state_ext));
+        if (STRING_IS_NULL(*state))
+            return PMCNULL;
+    }
+
+    bytes = read_cache_file(interp, Parrot_str_concat(interp, entry, pbc_ext));
+    if (STRING_IS_NULL(bytes))
+        return PMCNULL;
+
+    pf = PackFile_new(interp, 0);
+    pf->options = 0;
+
+    /* a collection could move the bytes while they are being unpacked */
+    Parrot_block_GC_mark(interp);
+
+    if (setjmp(jmp.resume)) {
+        /* catch: a damaged entry is a miss */
+        Parrot_cx_delete_handler_local(interp);
+    }
+    else {
+        Parrot_ex_add_c_handler(interp, &jmp);
+        ok = PackFile_unpack(interp, pf, (const opcode_t *)bytes->strstart,
+                Parrot_str_byte_length(interp, bytes)) != 0;
+        Parrot_cx_delete_handler_local(interp);
+    }
+
+    Parrot_unblock_GC_mark(interp);
+
+    if (!ok) {
+        PackFile_destroy(interp, pf);
+        return PMCNULL;
+    }
+
+    return Parrot_pf_get_packfile_pmc(interp, pf, path);
+}
+
+/*
+
+=item C<void Parrot_pf_cache_store(PARROT_INTERP, STRING *id, PMC *pf_pmc,
+STRING *state)>
+
+Keep the freshly compiled packfile C<pf_pmc> as the cache entry for C<id>,
+along with the optional C<state> blob.
+
+Call this before any of the packfile's subs have run.  Packfiles with
+C<:immediate> or C<:postcomp> subs, which run while compiling, and packfiles
+whose subs are lexically nested in a sub from elsewhere aren't stored, as
+loading them from the cache could not repeat that.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_pf_cache_store(PARROT_INTERP, ARGIN(STRING *id), ARGIN(PMC *pf_pmc),
+        ARGIN_NULLOK(STRING *state))
+{
+    ASSERT_ARGS(Parrot_pf_cache_store)
+    PackFile * const pf    = (PackFile *)VTABLE_get_pointer(interp, pf_pmc);
+    STRING   * const entry = cache_entry_name(interp, id);
+    Parrot_runloop   jmp;
+
+    if (STRING_IS_NULL(entry) || !pf || !pf->cur_cs || !cacheable(interp, pf_pmc))
+        return;
+
+    Parrot_block_GC_mark(interp);
+
+    if (setjmp(jmp.resume)) {
+        /* catch: leave the cache as it was */
+        Parrot_cx_delete_handler_local(interp);
+    }
+    else {
+        Parrot_ex_add_c_handler(interp, &jmp);
+
+        /* the state goes in first, so that any entry found has its state */
+        if (!STRING_IS_NULL(state)) {
+            STRING * const state_ext = CONST_STRING(interp, ".state");
+            write_cache_file(interp, Parrot_str_concat(interp, entry, state_ext),
+                state->strstart, Parrot_str_byte_length(interp, state));
+        }
+
+        {
+            STRING * const   pbc_ext = CONST_STRING(interp, ".pbc");
+            const size_t     size    = PackFile_pack_size(interp, pf) * sizeof (opcode_t);
+            opcode_t * const packed  = (opcode_t *)mem_sys_allocate(size);
+
+            PackFile_pack(interp, pf, packed);
+            write_cache_file(interp, Parrot_str_concat(interp, entry, pbc_ext),
+                (const char *)packed, size);
+            mem_sys_free(packed);
+        }
+
+        Parrot_cx_delete_handler_local(interp);
+    }
+
+    Parrot_unblock_GC_mark(interp);
+}
+
+/*
+
+=item C<static STRING * cache_dir(PARROT_INTERP)>
+
+Return the cache directory, or STRINGNULL if caching is off.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+cache_dir(PARROT_INTERP)
+{
+    ASSERT_ARGS(cache_dir)
+    STRING * const dir = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_BYTECODE_CACHE"));
+
+    if (STRING_IS_NULL(dir) || STRING_length(dir) == 0)
+        return STRINGNULL;
+
+    return dir;
+}
+
+/*
+
+=item C<static STRING * cache_entry_name(PARROT_INTERP, STRING *id)>
+
+Return the path, without extension, of the cache entry for C<id>, or
+STRINGNULL if caching is off.
+
+The name hashes C<id> with the Parrot version, the bytecode format version and
+the number of core ops, so that upgrading Parrot invalidates every entry.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+cache_entry_name(PARROT_INTERP, ARGIN(STRING *id))
+{
+    ASSERT_ARGS(cache_entry_name)
+    STRING * const dir = cache_dir(interp);
+    STRING        *version;
+    UINTVAL        lanes[CACHE_HASH_LANES];
+    char           name[CACHE_HASH_LANES * 8 + 1];
+    int            i;
+
+    if (STRING_IS_NULL(dir))
+        return STRINGNULL;
+
+    version = Parrot_sprintf_c(interp, "%s %d.%d %d\n", PARROT_VERSION,
+                PARROT_PBC_MAJOR, PARROT_PBC_MINOR,
+                (int)PARROT_CORE_OPLIB_INIT(interp, 1)->op_count);
+
+    for (i = 0; i < CACHE_HASH_LANES; ++i) {
+        /* give every lane its own starting point */
+        lanes[i] = (CACHE_FNV_OFFSET ^ ((UINTVAL)i * 0x9e3779b9U)) & 0xffffffffU;
+        lanes[i] = hash_bytes(version->strstart,
+                        Parrot_str_byte_length(interp, version), lanes[i]);
+        lanes[i] = hash_bytes(id->strstart,
+                        Parrot_str_byte_length(interp, id), lanes[i]);
+    }
+
+    for (i = 0; i < CACHE_HASH_LANES * 8; ++i)
+        name[i] = "0123456789abcdef"[(lanes[i / 8] >> (28 - 4 * (i % 8))) & 0xf];
+    name[CACHE_HASH_LANES * 8] = '\0';
+
+    return Parrot_sprintf_c(interp, "%Ss/%s", dir, name);
+}
+
+/*
+
+=item C<static UINTVAL hash_bytes(const char *buf, size_t len, UINTVAL hash)>
+
+Run 32-bit FNV-1a over C<len> bytes of C<buf>, starting from C<hash>.
+
+=cut
+
+*/
+
+PARROT_PURE_FUNCTION
+PARROT_WARN_UNUSED_RESULT
+static UINTVAL
+hash_bytes(ARGIN(const char *buf), size_t len, UINTVAL hash)
+{
+    ASSERT_ARGS(hash_bytes)
+    const unsigned char *p = (const unsigned char *)buf;
+
+    while (len--) {
+        hash ^= *p++;
+        hash  = (hash * CACHE_FNV_PRIME) & 0xffffffffU;
+    }
+
+    return hash;
+}
+
+/*
+
+=item C<static INTVAL cacheable(PARROT_INTERP, PMC *pf_pmc)>
+
+Return false if loading C<pf_pmc> back from the cache would not do what
+compiling it did: if it has subs that run at compile time, or subs whose
+C<:outer> lives in some other packfile.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+static INTVAL
+cacheable(PARROT_INTERP, ARGIN(PMC *pf_pmc))
+{
+    ASSERT_ARGS(cacheable)
+    PMC * const  subs = Parrot_pf_all_subs(interp, pf_pmc);
+    const INTVAL n    = VTABLE_elements(interp, subs);
+    INTVAL       i;
+
+    for (i = 0; i < n; ++i) {
+        PMC * const sub_pmc = VTABLE_get_pmc_keyed_int(interp, subs, i);
+        Parrot_Sub_attributes *sub;
+
+        if (PObj_get_FLAGS(sub_pmc) & (SUB_FLAG_PF_IMMEDIATE | SUB_FLAG_PF_POSTCOMP))
+            return 0;
+
+        PMC_get_sub(interp, sub_pmc, sub);
+        if (!PMC_IS_NULL(sub->outer_sub)) {
+            INTVAL j;
+
+            for (j = 0; j < n; ++j)
+                if (VTABLE_get_pmc_keyed_int(interp, subs, j) == sub->outer_sub)
+                    break;
+
+            if (j == n)
+                return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+
+=item C<static STRING * read_cache_file(PARROT_INTERP, STRING *path)>
+
+Return the contents of the file C<path> as a binary string, or STRINGNULL if
+it can't be read.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+static STRING *
+read_cache_file(PARROT_INTERP, ARGIN(STRING *path))
+{
+    ASSERT_ARGS(read_cache_file)
+    PIOHANDLE io;
+    INTVAL    size;
+    size_t    got = 0;
+    char     *buf;
+    STRING   *bytes;
+
+    if (!Parrot_file_stat_intval(interp, path, STAT_EXISTS)
+    ||  !Parrot_file_stat_intval(interp, path, STAT_ISREG))
+        return STRINGNULL;
+
+    size = Parrot_file_stat_intval(interp, path, STAT_FILESIZE);
+    io   = Parrot_io_internal_open(interp, path, PIO_F_READ);
+    if (size <= 0 || io == PIO_INVALID_HANDLE)
+        return STRINGNULL;
+
+    buf = mem_gc_allocate_n_typed(interp, size, char);
+    while (got < (size_t)size) {
+        const size_t n = Parrot_io_internal_read(interp, io, buf + got, size - got);
+        if (n == 0)
+            break;
+        got += n;
+    }
+    Parrot_io_internal_close(interp, io);
+
+    bytes = got == (size_t)size
+          ? Parrot_str_new_init(interp, buf, got, Parrot_binary_encoding_ptr, 0)
+          : STRINGNULL;
+    mem_gc_free(interp, buf);
+    return bytes;
+}
+
+/*
+
+=item C<static void write_cache_file(PARROT_INTERP, STRING *path, const char
+*buf, size_t len)>
+
+Write C<len> bytes of C<buf> to the file C<path>, by way of a temporary file
+that is renamed over it when complete.  Creates the cache directory if need
+be.  Throws if anything goes wrong.
+
+=cut
+
+*/
+
+static void
+write_cache_file(PARROT_INTERP, ARGIN(STRING *path), ARGIN(const char *buf), size_t len)
+{
+    ASSERT_ARGS(write_cache_file)
+    STRING * const dir = cache_dir(interp);
+    STRING * const tmp = Parrot_sprintf_c(interp, "%Ss.%d.tmp", path, (int)Parrot_getpid());
+    PIOHANDLE      io;
+    size_t         written;
+
+    if (!STRING_IS_NULL(dir) && !Parrot_file_stat_intval(interp, dir, STAT_EXISTS))
+        Parrot_file_mkdir(interp, dir, 0777);
+
+    io = Parrot_io_internal_open(interp, tmp, PIO_F_WRITE);
+    if (io == PIO_INVALID_HANDLE)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot open cache file %Ss", tmp);
+
+    written = Parrot_io_internal_write(interp, io, buf, len);
+    Parrot_io_internal_close(interp, io);
+
+    if (written != len) {
+        Parrot_file_unlink(interp, tmp);
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "Cannot write cache file %Ss", tmp);
+    }
+
+    Parrot_file_rename(interp, tmp, path);
+}
+
+/*
+
+=back
+
+=head1 SEE ALSO
+
+F<compilers/imcc/main.c>, F<docs/running.pod>
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
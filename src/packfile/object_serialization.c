@@ -59,6 +59,27 @@ Parrot_freeze(PARROT_INTERP, ARGIN(PMC *pmc))
 }
 
 
+/*
+
+=item C<void Parrot_freeze_to_handle(PARROT_INTERP, PMC *pmc, PMC *handle)>
+
+Freezes C<pmc> and writes the image to C<handle> as it is produced, a chunk at
+a time, rather than building the whole image in a STRING first.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_freeze_to_handle(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_freeze_to_handle)
+    PMC * const image = Parrot_pmc_new_init(interp, enum_class_ImageIOFreeze, handle);
+    VTABLE_set_pmc(interp, image, pmc);
+}
+
+
 /*
 
 =item C<opcode_t * Parrot_freeze_pbc(PARROT_INTERP, PMC *pmc, const
@@ -242,6 +263,42 @@ Parrot_thaw(PARROT_INTERP, ARGIN(STRING *image))
 }
 
 
+/*
+
+=item C<PMC * Parrot_thaw_from_handle(PARROT_INTERP, PMC *handle)>
+
+Thaws a PMC from an image read from C<handle>, as written by
+C<Parrot_freeze_to_handle>. Only the bytes of that one image are read.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+PMC *
+Parrot_thaw_from_handle(PARROT_INTERP, ARGIN(PMC *handle))
+{
+    ASSERT_ARGS(Parrot_thaw_from_handle)
+
+    PMC        *result;
+    PMC * const info = Parrot_pmc_new(interp, enum_class_ImageIOThaw);
+
+    /* see Parrot_thaw */
+    Parrot_block_GC_mark(interp);
+    Parrot_block_GC_sweep(interp);
+
+    VTABLE_set_pmc(interp, info, handle);
+    result = VTABLE_get_pmc(interp, info);
+
+    Parrot_unblock_GC_mark(interp);
+    Parrot_unblock_GC_sweep(interp);
+
+    return result;
+}
+
+
 /*
 
 =item C<PMC* Parrot_thaw_pbc(PARROT_INTERP, PackFile_ConstTable *ct, const
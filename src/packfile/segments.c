@@ -18,6 +18,7 @@ Functions in this file represent behaviors for different PackFile segments.
 #include "parrot/parrot.h"
 #include "pf_private.h"
 #include "pmc/pmc_parrotlibrary.h"
+#include "pmc/pmc_sub.h"
 #include "segments.str"
 
 /* HEADERIZER BEGIN: static */
@@ -409,8 +410,10 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
     for (i = 0; i < self->num.const_count; i++)
         self->num.constants[i] = PF_fetch_number(pf, &cursor);
 
+    /* share identical names and literals across all loaded packfiles */
     for (i = 0; i < self->str.const_count; i++)
-        self->str.constants[i] = PF_fetch_string(interp, pf, &cursor);
+        self->str.constants[i] = Parrot_str_intern(interp,
+                                    PF_fetch_string(interp, pf, &cursor));
 
     for (i = 0; i < self->pmc.const_count; i++)
         self->pmc.constants[i] = PackFile_Constant_unpack_pmc(interp, self, &cursor);
@@ -425,8 +428,17 @@ PackFile_ConstTable_unpack(PARROT_INTERP, ARGMOD(PackFile_Segment *seg),
 
         /* magically place subs into namespace stashes
          * XXX make this explicit with :load subs in PBC */
-        if (VTABLE_isa(interp, pmc, sub_str))
+        if (VTABLE_isa(interp, pmc, sub_str)) {
+            Parrot_Sub_attributes *sub;
+
             Parrot_ns_store_sub(interp, pmc);
+
+            /* SUB_FLAG_IS_OUTER isn't frozen, but without it the outer sub
+             * doesn't keep its context for the inner subs to close over */
+            PMC_get_sub(interp, pmc, sub);
+            if (!PMC_IS_NULL(sub->outer_sub))
+                PObj_get_FLAGS(sub->outer_sub) |= SUB_FLAG_IS_OUTER;
+        }
     }
 
     self->ntags = PF_fetch_opcode(pf, &cursor);
@@ -2007,6 +2019,12 @@ pf_debug_destroy(PARROT_INTERP, ARGMOD(PackFile_Segment *self))
     mem_gc_free(interp, debug->mappings);
     debug->mappings     = NULL;
     debug->num_mappings = 0;
+
+    if (debug->op_offsets) {
+        mem_gc_free(interp, debug->op_offsets);
+        debug->op_offsets     = NULL;
+        debug->num_op_offsets = 0;
+    }
 }
 
 
@@ -26,22 +26,28 @@ itimer stuff
 
 #ifdef PARROT_HAS_SETITIMER
 
+/* the handles new_sys_timer_ms() and new_sys_cpu_timer_ms() hand out */
+static char real_timer;
+static char cpu_timer;
+
+#  define TIMER_WHICH(handle) ((handle) == &cpu_timer ? ITIMER_PROF : ITIMER_REAL)
+
 /*
 
 =item C<void start_sys_timer_ms(void *handle, int ms)>
 
 Start a system timer with the passed value in milli seconds.
 
-The handle is that, what new_sys_timer_ms() returned.
-We could pass ITIMER_REAL in handle, but for now we ignore it
-as we are just having one timer.
+The handle is that, what new_sys_timer_ms() or new_sys_cpu_timer_ms()
+returned; it selects the interval timer to program.  A NULL handle means the
+real-time timer.
 
 =cut
 
 */
 
 void
-start_sys_timer_ms(SHIM(void *handle), int ms)
+start_sys_timer_ms(ARGIN_NULLOK(void *handle), int ms)
 {
     struct itimerval its;
     memset(&its, 0, sizeof (its));
@@ -49,7 +55,7 @@ start_sys_timer_ms(SHIM(void *handle), int ms)
         its.it_interval.tv_sec = its.it_value.tv_sec = ms/1000;
         its.it_interval.tv_usec = its.it_value.tv_usec = 1000 *(ms%1000);
     }
-    setitimer(ITIMER_REAL, &its, NULL);
+    setitimer(TIMER_WHICH(handle), &its, NULL);
 }
 
 /*
@@ -80,10 +86,10 @@ given timer handle.
 */
 
 int
-get_sys_timer_ms(SHIM(void *handle))
+get_sys_timer_ms(ARGIN_NULLOK(void *handle))
 {
     struct itimerval ots;
-    getitimer(ITIMER_REAL, &ots);
+    getitimer(TIMER_WHICH(handle), &ots);
     return ots.it_interval.tv_sec * 1000 + ots.it_interval.tv_usec/1000;
 }
 
@@ -93,6 +99,7 @@ get_sys_timer_ms(SHIM(void *handle))
 
 Create a new system timer with ~ms resolution.
 The returned handle is passed to the other timer functions.
+The timer counts wall-clock time and delivers C<SIGALRM>.
 
 =cut
 
@@ -102,7 +109,25 @@ PARROT_CAN_RETURN_NULL
 void *
 new_sys_timer_ms(void)
 {
-    return NULL;
+    return &real_timer;
+}
+
+/*
+
+=item C<void * new_sys_cpu_timer_ms(void)>
+
+Like new_sys_timer_ms(), but the timer counts the CPU time the process uses
+and delivers C<SIGPROF>, which is what a sampling profiler wants.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+void *
+new_sys_cpu_timer_ms(void)
+{
+    return &cpu_timer;
 }
 
 #else
@@ -1186,7 +1186,8 @@ Parrot_pmc_getprop(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(STRING *key))
 =item C<void Parrot_pmc_setprop(PARROT_INTERP, PMC *pmc, STRING *key, PMC
 *value)>
 
-Sets the property for C<*key> to C<*value>.
+Sets the property for C<*key> to C<*value>. Throws for sealed shared data,
+which includes clearing its C<_ro> property.
 
 =cut
 
@@ -1197,6 +1198,10 @@ void
 Parrot_pmc_setprop(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(STRING *key), ARGIN(PMC *value))
 {
     ASSERT_ARGS(Parrot_pmc_setprop)
+    if (Parrot_thread_is_sealed(pmc))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_WRITE_TO_CONSTCLASS,
+            "Cannot set a property on sealed shared data");
+
     if (check_set_std_props(interp, pmc, key, value))
         return;
 
@@ -1221,6 +1226,10 @@ void
 Parrot_pmc_delprop(PARROT_INTERP, ARGIN(PMC *pmc), ARGIN(STRING *key))
 {
     ASSERT_ARGS(Parrot_pmc_delprop)
+    if (Parrot_thread_is_sealed(pmc))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_WRITE_TO_CONSTCLASS,
+            "Cannot delete a property of sealed shared data");
+
     if (!PMC_IS_NULL(PMC_metadata(pmc)))
         VTABLE_delete_keyed_str(interp, PMC_metadata(pmc), key);
 }
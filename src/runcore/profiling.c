@@ -493,8 +493,8 @@ ARGIN(PMC *ctx_pmc))
     INTVAL line_num = Parrot_hash_value_to_int(interp, runcore->line_cache,
             Parrot_hash_get(interp, runcore->line_cache, ctx->current_pc));
 
-    /* Parrot_sub_get_line_from_pc eats up about 20-30% of execution time
-     * *with* this cache in place. */
+    /* Parrot_sub_get_line_from_pc is a binary search over the debug
+     * segment's op index; the cache still saves that per executed op. */
     if (line_num == 0) {
         line_num = Parrot_sub_get_line_from_pc(interp,
                 Parrot_pcc_get_sub(interp, ctx_pmc), ctx->current_pc);
@@ -0,0 +1,851 @@
+/*
+Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+src/runcore/sampling.c - Parrot's sampling profiler runcore
+
+=head1 DESCRIPTION
+
+The sampling runcore runs ops like the fast core, but every few milliseconds
+it notes the call chain that is executing into a call tree.  Unlike the
+profiling and subprof cores it does no work on most ops, so it is cheap
+enough to leave on for a whole run.
+
+Ticks come from the CPU-time interval timer (see
+F<src/platform/generic/itimer.c>), whose signal handler does nothing but
+bump a counter.  The runloop compares that counter against the last one it
+saw before each op and takes the sample itself, at an op boundary in the
+interpreter's own thread, where walking the context chain is safe.  Platforms
+without an interval timer poll the hires clock every C<SAMPLING_POLL_OPS> ops
+instead.
+
+When the interpreter is destroyed the tree is written out, either as folded
+stacks (one C<outer;inner count> line per distinct stack, as flame graph
+tools expect) or in the format of the profiling runcore, which
+F<tools/dev/pprof2cg.pl> turns into a Callgrind profile.
+
+=head2 Functions
+
+=over 4
+
+=cut
+
+*/
+
+#include "parrot/runcore_api.h"
+#include "parrot/runcore_sampling.h"
+
+#include "parrot/oplib/core_ops.h"
+
+#include "sampling.str"
+
+#include "pmc/pmc_sub.h"
+#include "pmc/pmc_callcontext.h"
+
+#if defined(PARROT_HAS_SOME_SYS_TIMER) && defined(PARROT_HAS_SIGACTION)
+#  define SAMPLING_USE_ITIMER 1
+#  include <signal.h>
+#endif
+
+/* default sampling interval, in milliseconds */
+#define SAMPLING_DEFAULT_INTERVAL 10
+
+/* how many ops run between looks at the clock, without an interval timer */
+#define SAMPLING_POLL_OPS 1024
+
+#ifdef SAMPLING_USE_ITIMER
+
+/* bumped by the SIGPROF handler; read by the runloop */
+static volatile sig_atomic_t sampling_ticks = 0;
+
+/* the interpreter that started the timer, and stops it again */
+static Interp *timer_owner = NULL;
+
+#  define SAMPLE_DUE(sdata) ((UINTVAL)sampling_ticks != (sdata)->last_tick)
+
+#else
+
+#  define SAMPLE_DUE(sdata) (--(sdata)->countdown == 0)
+
+#endif
+
+/* HEADERIZER HFILE: include/parrot/runcore_sampling.h */
+
+/* HEADERIZER BEGIN: static */
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+
+static void destroy_sampling_core(PARROT_INTERP,
+    ARGIN(Parrot_sampling_runcore_t *runcore))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+PARROT_CANNOT_RETURN_NULL
+static sample_node * find_child(PARROT_INTERP,
+    ARGMOD(sampling_data *sdata),
+    ARGMOD(sample_node *parent),
+    ARGIN(PMC *sub),
+    ARGIN_NULLOK(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*sdata)
+        FUNC_MODIFIES(*parent);
+
+static void fold_stacks(PARROT_INTERP,
+    ARGIN(const sample_node *node),
+    ARGIN_NULLOK(STRING *prefix),
+    ARGMOD(PMC *stacks))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(4)
+        FUNC_MODIFIES(*stacks);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING * frame_label(PARROT_INTERP,
+    ARGIN(const sample_node *node),
+    ARGOUT(Parrot_Context_info *info))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3)
+        FUNC_MODIFIES(*info);
+
+static void free_sample_nodes(PARROT_INTERP, ARGMOD(sample_node *node))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*node);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * init_sampling_core(PARROT_INTERP,
+    ARGIN(Parrot_sampling_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void open_sampling_output(PARROT_INTERP,
+    ARGMOD(sampling_data *sdata))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*sdata);
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t * runops_sampling_core(PARROT_INTERP,
+    ARGIN(Parrot_sampling_runcore_t *runcore),
+    ARGIN(opcode_t *pc))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+static void sampling_tick(int sig);
+static void take_due_sample(PARROT_INTERP, ARGMOD(sampling_data *sdata))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*sdata);
+
+static void take_sample(PARROT_INTERP,
+    ARGMOD(sampling_data *sdata),
+    UINTVAL weight)
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        FUNC_MODIFIES(*sdata);
+
+static void write_folded(PARROT_INTERP, ARGIN(sampling_data *sdata))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2);
+
+static void write_pprof_stacks(PARROT_INTERP,
+    ARGIN(sampling_data *sdata),
+    ARGIN(const sample_node *node))
+        __attribute__nonnull__(1)
+        __attribute__nonnull__(2)
+        __attribute__nonnull__(3);
+
+#define ASSERT_ARGS_destroy_sampling_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore))
+#define ASSERT_ARGS_find_child __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sdata) \
+    , PARROT_ASSERT_ARG(parent) \
+    , PARROT_ASSERT_ARG(sub))
+#define ASSERT_ARGS_fold_stacks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(node) \
+    , PARROT_ASSERT_ARG(stacks))
+#define ASSERT_ARGS_frame_label __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(node) \
+    , PARROT_ASSERT_ARG(info))
+#define ASSERT_ARGS_free_sample_nodes __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(node))
+#define ASSERT_ARGS_init_sampling_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_open_sampling_output __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sdata))
+#define ASSERT_ARGS_runops_sampling_core __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(runcore) \
+    , PARROT_ASSERT_ARG(pc))
+#define ASSERT_ARGS_sampling_tick __attribute__unused__ int _ASSERT_ARGS_CHECK = (0)
+#define ASSERT_ARGS_take_due_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sdata))
+#define ASSERT_ARGS_take_sample __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sdata))
+#define ASSERT_ARGS_write_folded __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sdata))
+#define ASSERT_ARGS_write_pprof_stacks __attribute__unused__ int _ASSERT_ARGS_CHECK = (\
+       PARROT_ASSERT_ARG(interp) \
+    , PARROT_ASSERT_ARG(sdata) \
+    , PARROT_ASSERT_ARG(node))
+/* Don't modify between HEADERIZER BEGIN / HEADERIZER END.  Your changes will be lost. */
+/* HEADERIZER END: static */
+
+/*
+
+=item C<void Parrot_runcore_sampling_init(PARROT_INTERP)>
+
+Registers the sampling runcore with Parrot.
+
+=cut
+
+*/
+
+void
+Parrot_runcore_sampling_init(PARROT_INTERP)
+{
+    ASSERT_ARGS(Parrot_runcore_sampling_init)
+
+    Parrot_sampling_runcore_t * const coredata =
+            mem_gc_allocate_zeroed_typed(interp, Parrot_sampling_runcore_t);
+
+    coredata->name        = CONST_STRING(interp, "sampling");
+    coredata->id          = PARROT_SAMPLING_CORE;
+    coredata->opinit      = PARROT_CORE_OPLIB_INIT;
+    coredata->runops      = (Parrot_runcore_runops_fn_t) init_sampling_core;
+    coredata->destroy     = (Parrot_runcore_destroy_fn_t) destroy_sampling_core;
+    coredata->prepare_run = NULL;
+    coredata->flags       = 0;
+
+    PARROT_RUNCORE_FUNC_TABLE_SET(coredata);
+
+    Parrot_runcore_register(interp, (Parrot_runcore_t *) coredata);
+}
+
+/*
+
+=item C<static opcode_t * init_sampling_core(PARROT_INTERP,
+Parrot_sampling_runcore_t *runcore, opcode_t *pc)>
+
+Reads the sampling settings from the environment, opens the output file and
+starts the timer, then runs C<pc> with the sampling runloop.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+init_sampling_core(PARROT_INTERP, ARGIN(Parrot_sampling_runcore_t *runcore),
+        ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(init_sampling_core)
+
+    sampling_data          *sdata;
+    INTVAL                  interval = SAMPLING_DEFAULT_INTERVAL;
+    Parrot_sampling_output  output   = SAMPLING_OUTPUT_FOLDED;
+    STRING                 *env;
+
+    env = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_SAMPLING_INTERVAL"));
+    if (!STRING_IS_NULL(env)) {
+        interval = Parrot_str_to_int(interp, env);
+        if (interval <= 0)
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "'%Ss' is not a valid sampling interval; "
+                "it must be a positive number of milliseconds", env);
+    }
+
+    env = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_SAMPLING_OUTPUT"));
+    if (!STRING_IS_NULL(env)) {
+        if (STRING_equal(interp, env, CONST_STRING(interp, "pprof")))
+            output = SAMPLING_OUTPUT_PPROF;
+        else if (!STRING_equal(interp, env, CONST_STRING(interp, "folded")))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "'%Ss' is not a valid sampling output format; "
+                "valid values are folded and pprof", env);
+    }
+
+    sdata             = mem_gc_allocate_zeroed_typed(interp, sampling_data);
+    sdata->interp     = interp;
+    sdata->interval   = interval;
+    sdata->output     = output;
+    sdata->stack_size = 64;
+    sdata->stack      = mem_gc_allocate_n_typed(interp, sdata->stack_size, PMC *);
+    sdata->seen_subs  = Parrot_hash_new_pointer_hash(interp);
+    sdata->markpmcs   = Parrot_pmc_new(interp, enum_class_ResizablePMCArray);
+    Parrot_pmc_gc_register(interp, sdata->markpmcs);
+    runcore->sdata    = sdata;
+
+    open_sampling_output(interp, sdata);
+
+#ifdef SAMPLING_USE_ITIMER
+    if (!timer_owner) {
+        struct sigaction sa;
+
+        memset(&sa, 0, sizeof (sa));
+        sa.sa_handler = sampling_tick;
+        sa.sa_flags   = SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        sigaction(SIGPROF, &sa, NULL);
+
+        timer_owner  = interp;
+        sdata->timer = new_sys_cpu_timer_ms();
+        start_sys_timer_ms(sdata->timer, sdata->interval);
+    }
+    sdata->last_tick = (UINTVAL)sampling_ticks;
+#else
+    sdata->countdown   = SAMPLING_POLL_OPS;
+    sdata->next_sample = Parrot_hires_get_time()
+                       + (UHUGEINTVAL)sdata->interval * 1000000 / Parrot_hires_get_tick_duration();
+#endif
+
+    runcore->runops = (Parrot_runcore_runops_fn_t) runops_sampling_core;
+
+    return runops_sampling_core(interp, runcore, pc);
+}
+
+/*
+
+=item C<static void open_sampling_output(PARROT_INTERP, sampling_data *sdata)>
+
+Opens the file named by C<PARROT_SAMPLING_FILENAME>, or
+F<parrot.folded.PID> / F<parrot.pprof.PID> by default, so a bad name is
+reported before the program runs rather than after.
+
+=cut
+
+*/
+
+static void
+open_sampling_output(PARROT_INTERP, ARGMOD(sampling_data *sdata))
+{
+    ASSERT_ARGS(open_sampling_output)
+
+    STRING * const env = Parrot_getenv(interp, CONST_STRING(interp, "PARROT_SAMPLING_FILENAME"));
+    STRING        *lc_filename;
+    char          *filename_cstr;
+
+    if (!STRING_IS_NULL(env))
+        sdata->filename = env;
+    else if (sdata->output == SAMPLING_OUTPUT_PPROF)
+        sdata->filename = Parrot_sprintf_c(interp, "parrot.pprof.%d", getpid());
+    else
+        sdata->filename = Parrot_sprintf_c(interp, "parrot.folded.%d", getpid());
+
+    Parrot_str_gc_register(interp, sdata->filename);
+    filename_cstr = Parrot_str_to_cstring(interp, sdata->filename);
+    lc_filename   = Parrot_str_downcase(interp, sdata->filename);
+
+    if (STRING_equal(interp, lc_filename, CONST_STRING(interp, "stderr")))
+        sdata->out = stderr;
+    else if (STRING_equal(interp, lc_filename, CONST_STRING(interp, "stdout")))
+        sdata->out = stdout;
+    else
+        sdata->out = fopen(filename_cstr, "w");
+
+    Parrot_str_free_cstring(filename_cstr);
+
+    if (!sdata->out)
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_PIO_ERROR,
+            "unable to open %Ss for writing", sdata->filename);
+}
+
+/*
+
+=item C<static opcode_t * runops_sampling_core(PARROT_INTERP,
+Parrot_sampling_runcore_t *runcore, opcode_t *pc)>
+
+Runs the Parrot operations starting at C<pc> until there are no more
+operations, taking a sample before the next op whenever one is due.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+static opcode_t *
+runops_sampling_core(PARROT_INTERP, ARGIN(Parrot_sampling_runcore_t *runcore),
+        ARGIN(opcode_t *pc))
+{
+    ASSERT_ARGS(runops_sampling_core)
+
+    sampling_data * const sdata = runcore->sdata;
+
+    if (sdata->interp != interp)
+        Parrot_ex_throw_from_c_args(interp, NULL, 1,
+            "illegal interpreter change while sampling");
+
+    while (pc) {
+        Parrot_pcc_set_pc(interp, CURRENT_CONTEXT(interp), pc);
+        if (SAMPLE_DUE(sdata))
+            take_due_sample(interp, sdata);
+        DO_OP(pc, interp);
+    }
+
+    return pc;
+}
+
+/*
+
+=item C<static void sampling_tick(int sig)>
+
+The C<SIGPROF> handler.  Anything more than counting the tick is left to the
+runloop, as little else is safe to do in a signal handler.
+
+=cut
+
+*/
+
+static void
+sampling_tick(SHIM(int sig))
+{
+    ASSERT_ARGS(sampling_tick)
+
+#ifdef SAMPLING_USE_ITIMER
+    ++sampling_ticks;
+#endif
+}
+
+/*
+
+=item C<static void take_due_sample(PARROT_INTERP, sampling_data *sdata)>
+
+Called from the runloop when C<SAMPLE_DUE> is true.  Works out how many ticks
+have passed since the last sample, so time spent inside a long op is still
+charged in full, and samples the current call chain with that weight.
+
+=cut
+
+*/
+
+static void
+take_due_sample(PARROT_INTERP, ARGMOD(sampling_data *sdata))
+{
+    ASSERT_ARGS(take_due_sample)
+
+    UINTVAL weight;
+
+#ifdef SAMPLING_USE_ITIMER
+    const UINTVAL tick = (UINTVAL)sampling_ticks;
+
+    weight           = tick - sdata->last_tick;
+    sdata->last_tick = tick;
+#else
+    const UHUGEINTVAL now      = Parrot_hires_get_time();
+    const UHUGEINTVAL interval = (UHUGEINTVAL)sdata->interval * 1000000
+                               / Parrot_hires_get_tick_duration();
+
+    sdata->countdown = SAMPLING_POLL_OPS;
+    if (now < sdata->next_sample)
+        return;
+
+    weight              = 1 + (UINTVAL)((now - sdata->next_sample) / interval);
+    sdata->next_sample += weight * interval;
+#endif
+
+    take_sample(interp, sdata, weight);
+}
+
+/*
+
+=item C<static void take_sample(PARROT_INTERP, sampling_data *sdata, UINTVAL
+weight)>
+
+Walks the context chain from the current context to the outermost one and
+adds C<weight> samples to the matching path of the call tree, growing the
+path where this stack has not been seen before.  Frames without a sub are
+left out.
+
+=cut
+
+*/
+
+static void
+take_sample(PARROT_INTERP, ARGMOD(sampling_data *sdata), UINTVAL weight)
+{
+    ASSERT_ARGS(take_sample)
+
+    sample_node *node  = &sdata->root;
+    UINTVAL      depth = 0;
+    PMC         *ctx;
+
+    for (ctx = CURRENT_CONTEXT(interp); !PMC_IS_NULL(ctx);
+            ctx = Parrot_pcc_get_caller_ctx(interp, ctx)) {
+        if (depth == sdata->stack_size) {
+            sdata->stack_size *= 2;
+            sdata->stack = mem_gc_realloc_n_typed(interp, sdata->stack,
+                    sdata->stack_size, PMC *);
+        }
+        sdata->stack[depth++] = ctx;
+    }
+
+    while (depth--) {
+        PMC * const sub = Parrot_pcc_get_sub(interp, sdata->stack[depth]);
+
+        if (!PMC_IS_NULL(sub))
+            node = find_child(interp, sdata, node, sub,
+                    Parrot_pcc_get_pc(interp, sdata->stack[depth]));
+    }
+
+    node->self     += weight;
+    sdata->samples += weight;
+}
+
+/*
+
+=item C<static sample_node * find_child(PARROT_INTERP, sampling_data *sdata,
+sample_node *parent, PMC *sub, opcode_t *pc)>
+
+Returns the frame called from C<parent> that is running C<sub> at C<pc>,
+adding it if it is new.  A frame that is found moves to the front of its
+siblings, so the hot path through the tree stays short to search.
+
+=cut
+
+*/
+
+PARROT_CANNOT_RETURN_NULL
+static sample_node *
+find_child(PARROT_INTERP, ARGMOD(sampling_data *sdata), ARGMOD(sample_node *parent),
+        ARGIN(PMC *sub), ARGIN_NULLOK(opcode_t *pc))
+{
+    ASSERT_ARGS(find_child)
+
+    sample_node *prev = NULL;
+    sample_node *node;
+
+    for (node = parent->child; node; prev = node, node = node->sibling) {
+        if (node->sub == sub && node->pc == pc) {
+            if (prev) {
+                prev->sibling = node->sibling;
+                node->sibling = parent->child;
+                parent->child = node;
+            }
+            return node;
+        }
+    }
+
+    node          = mem_gc_allocate_zeroed_typed(interp, sample_node);
+    node->sub     = sub;
+    node->pc      = pc;
+    node->parent  = parent;
+    node->sibling = parent->child;
+    parent->child = node;
+    ++sdata->nodes;
+
+    /* keep the sub alive until the profile is written */
+    if (!Parrot_hash_exists(interp, sdata->seen_subs, sub)) {
+        Parrot_hash_put(interp, sdata->seen_subs, sub, sub);
+        VTABLE_push_pmc(interp, sdata->markpmcs, sub);
+    }
+
+    return node;
+}
+
+/*
+
+=item C<static STRING * frame_label(PARROT_INTERP, const sample_node *node,
+Parrot_Context_info *info)>
+
+Fills C<info> for the frame C<node> and returns the name to show for it in a
+folded stack: the full name of its sub, with C<::> between the namespace
+parts, as C<;> separates frames there.
+
+=cut
+
+*/
+
+PARROT_WARN_UNUSED_RESULT
+PARROT_CANNOT_RETURN_NULL
+static STRING *
+frame_label(PARROT_INTERP, ARGIN(const sample_node *node), ARGOUT(Parrot_Context_info *info))
+{
+    ASSERT_ARGS(frame_label)
+
+    PMC *parts;
+
+    Parrot_sub_frame_get_info(interp, node->sub, node->pc, info);
+
+    if (STRING_IS_NULL(info->fullname))
+        return CONST_STRING(interp, "???");
+
+    parts = Parrot_str_split(interp, Parrot_str_new_constant(interp, ";"), info->fullname);
+    return Parrot_str_join(interp, CONST_STRING(interp, "::"), parts);
+}
+
+/*
+
+=item C<static void fold_stacks(PARROT_INTERP, const sample_node *node, STRING
+*prefix, PMC *stacks)>
+
+Adds the samples of C<node> and its callees to C<stacks>, keyed by their
+folded stack.  Frames at different pcs of the same sub fold together here.
+
+=cut
+
+*/
+
+static void
+fold_stacks(PARROT_INTERP, ARGIN(const sample_node *node), ARGIN_NULLOK(STRING *prefix),
+        ARGMOD(PMC *stacks))
+{
+    ASSERT_ARGS(fold_stacks)
+
+    const sample_node *child;
+
+    for (child = node->child; child; child = child->sibling) {
+        Parrot_Context_info info;
+        STRING * const label = frame_label(interp, child, &info);
+        STRING * const stack = STRING_IS_NULL(prefix)
+                             ? label
+                             : Parrot_sprintf_c(interp, "%Ss;%Ss", prefix, label);
+
+        if (child->self)
+            VTABLE_set_integer_keyed_str(interp, stacks, stack,
+                VTABLE_get_integer_keyed_str(interp, stacks, stack) + child->self);
+
+        fold_stacks(interp, child, stack, stacks);
+    }
+}
+
+/*
+
+=item C<static void write_folded(PARROT_INTERP, sampling_data *sdata)>
+
+Writes one C<outer;inner count> line per distinct stack.
+
+=cut
+
+*/
+
+static void
+write_folded(PARROT_INTERP, ARGIN(sampling_data *sdata))
+{
+    ASSERT_ARGS(write_folded)
+
+    PMC * const stacks = Parrot_pmc_new(interp, enum_class_Hash);
+    PMC        *iter;
+
+    fold_stacks(interp, &sdata->root, STRINGNULL, stacks);
+
+    iter = VTABLE_get_iter(interp, stacks);
+    while (VTABLE_get_bool(interp, iter)) {
+        STRING * const stack = VTABLE_shift_string(interp, iter);
+        char   * const cstr  = Parrot_str_to_cstring(interp, stack);
+
+        fprintf(sdata->out, "%s %ld\n", cstr,
+            (long)VTABLE_get_integer_keyed_str(interp, stacks, stack));
+        Parrot_str_free_cstring(cstr);
+    }
+}
+
+/*
+
+=item C<static void write_pprof_stacks(PARROT_INTERP, sampling_data *sdata,
+const sample_node *node)>
+
+Writes each stack under C<node> in the profiling runcore's format, as a
+runloop of its own: a context switch into each frame from the outermost
+in, an op line for each call site, and an op line for the sampled op that
+carries the sampled time.  Every frame is its own context, so
+F<pprof2cg.pl> charges the time to each caller as well.
+
+=cut
+
+*/
+
+static void
+write_pprof_stacks(PARROT_INTERP, ARGIN(sampling_data *sdata), ARGIN(const sample_node *node))
+{
+    ASSERT_ARGS(write_pprof_stacks)
+
+    const sample_node *child;
+
+    if (node->self) {
+        const sample_node  *frame;
+        const sample_node **path;
+        UINTVAL             depth = 0;
+        UINTVAL             i;
+
+        for (frame = node; frame->parent; frame = frame->parent)
+            ++depth;
+
+        path = mem_gc_allocate_n_typed(interp, depth, const sample_node *);
+        for (i = depth, frame = node; i > 0; frame = frame->parent)
+            path[--i] = frame;
+
+        for (i = 0; i < depth; ++i) {
+            Parrot_Context_info    info;
+            Parrot_Sub_attributes *sub;
+            char                  *ns_cstr;
+            char                  *file_cstr;
+            const char            *op_name = "???";
+
+            Parrot_sub_frame_get_info(interp, path[i]->sub, path[i]->pc, &info);
+            ns_cstr   = Parrot_str_to_cstring(interp,
+                            STRING_IS_NULL(info.fullname) ? info.subname : info.fullname);
+            file_cstr = Parrot_str_to_cstring(interp, info.file);
+
+            PMC_get_sub(interp, path[i]->sub, sub);
+            if (sub && sub->seg && path[i]->pc)
+                op_name = sub->seg->op_info_table[*path[i]->pc]->name;
+
+            fprintf(sdata->out,
+                "CS:{x{ns:%s}x}{x{file:%s}x}{x{sub:%p}x}{x{ctx:0x%lx}x}\n",
+                ns_cstr, file_cstr, (void *)path[i]->sub, (unsigned long)i + 1);
+            fprintf(sdata->out, "OP:{x{line:%d}x}{x{time:%lu}x}{x{op:%s}x}\n",
+                info.line,
+                i + 1 < depth ? 0UL : (unsigned long)(node->self * sdata->interval * 1000000),
+                op_name);
+
+            Parrot_str_free_cstring(ns_cstr);
+            Parrot_str_free_cstring(file_cstr);
+        }
+
+        fprintf(sdata->out, "END_OF_RUNLOOP:1\n");
+        mem_gc_free(interp, path);
+    }
+
+    for (child = node->child; child; child = child->sibling)
+        write_pprof_stacks(interp, sdata, child);
+}
+
+/*
+
+=item C<static void free_sample_nodes(PARROT_INTERP, sample_node *node)>
+
+Frees the callees of C<node>, recursively.
+
+=cut
+
+*/
+
+static void
+free_sample_nodes(PARROT_INTERP, ARGMOD(sample_node *node))
+{
+    ASSERT_ARGS(free_sample_nodes)
+
+    sample_node *child = node->child;
+
+    while (child) {
+        sample_node * const next = child->sibling;
+        free_sample_nodes(interp, child);
+        mem_gc_free(interp, child);
+        child = next;
+    }
+
+    node->child = NULL;
+}
+
+/*
+
+=item C<static void destroy_sampling_core(PARROT_INTERP,
+Parrot_sampling_runcore_t *runcore)>
+
+Stops the timer and writes out the profile, if the core was ever run.
+
+=cut
+
+*/
+
+static void
+destroy_sampling_core(PARROT_INTERP, ARGIN(Parrot_sampling_runcore_t *runcore))
+{
+    ASSERT_ARGS(destroy_sampling_core)
+
+    sampling_data * const sdata = runcore->sdata;
+    char                 *filename_cstr;
+
+    if (!sdata)
+        return;
+
+    runcore->sdata = NULL;
+
+#ifdef SAMPLING_USE_ITIMER
+    /* the handler stays installed: a SIGPROF still in flight must not
+     * take the default action and kill the process */
+    if (timer_owner == interp) {
+        stop_sys_timer_ms(sdata->timer);
+        timer_owner = NULL;
+    }
+#endif
+
+    /* the output file couldn't be opened; nothing was sampled */
+    if (sdata->out) {
+        if (sdata->output == SAMPLING_OUTPUT_PPROF) {
+            PMC * const argv = VTABLE_get_pmc_keyed_int(interp, interp->iglobals,
+                                    IGLOBALS_ARGV_LIST);
+
+            fprintf(sdata->out, "VERSION:2\n");
+            if (!PMC_IS_NULL(argv)) {
+                STRING * const space    = CONST_STRING(interp, " ");
+                char   * const cli_cstr = Parrot_str_to_cstring(interp,
+                                            Parrot_str_join(interp, space, argv));
+                fprintf(sdata->out, "CLI: %s\n", cli_cstr);
+                Parrot_str_free_cstring(cli_cstr);
+            }
+            write_pprof_stacks(interp, sdata, &sdata->root);
+        }
+        else
+            write_folded(interp, sdata);
+
+        filename_cstr = Parrot_str_to_cstring(interp, sdata->filename);
+        fprintf(stderr, "\nSAMPLING RUNCORE: wrote %lu samples (%lu ms apart) to %s\n",
+            (unsigned long)sdata->samples, (unsigned long)sdata->interval, filename_cstr);
+        if (sdata->output == SAMPLING_OUTPUT_PPROF)
+            fprintf(stderr, "Use tools/dev/pprof2cg.pl to generate Callgrind-compatible "
+                "output from this file.\n");
+        Parrot_str_free_cstring(filename_cstr);
+
+        if (sdata->out != stdout && sdata->out != stderr)
+            fclose(sdata->out);
+        else
+            fflush(sdata->out);
+    }
+
+    free_sample_nodes(interp, &sdata->root);
+    Parrot_hash_destroy(interp, sdata->seen_subs);
+    Parrot_pmc_gc_unregister(interp, sdata->markpmcs);
+    if (sdata->filename)
+        Parrot_str_gc_unregister(interp, sdata->filename);
+    mem_gc_free(interp, sdata->stack);
+    mem_gc_free(interp, sdata);
+}
+
+/*
+
+=back
+
+=cut
+
+*/
+
+/*
+ * Local variables:
+ *   c-file-style: "parrot"
+ * End:
+ * vim: expandtab shiftwidth=4 cinoptions='\:2=2' :
+ */
@@ -249,8 +249,8 @@ static lineinfo * sync_hll_linechange(PARROT_INTERP,
 =item C<static INTVAL * sptodebug(PARROT_INTERP, subprofiledata *spdata, const
 subprofile *sp)>
 
-Unpacks the debug segment data into an array indexed by the opcode offset.
-Hashes the result in spdata->seg2debug.
+Unpacks the debug segment data into an array indexed by the opcode offset,
+using the segment's op offset index.  Hashes the result in spdata->seg2debug.
 
 =cut
 
@@ -262,10 +262,11 @@ sptodebug(PARROT_INTERP, ARGMOD(subprofiledata *spdata), ARGIN(const subprofile
 {
     ASSERT_ARGS(sptodebug)
 
-    INTVAL *xdebug;
-    size_t di, op;
-    opcode_t *base_pc, *debug_ops;
-    size_t code_size, debug_size;
+    INTVAL         *xdebug;
+    PackFile_Debug *debug;
+    const opcode_t *offsets;
+    opcode_t        nops, i;
+    size_t          op, code_size;
 
     if (!spdata->seg2debug)
         spdata->seg2debug = Parrot_hash_new_pointer_hash(interp);
@@ -273,25 +274,16 @@ sptodebug(PARROT_INTERP, ARGMOD(subprofiledata *spdata), ARGIN(const subprofile
     if (xdebug)
         return xdebug;
 
-    base_pc = sp->subattrs->seg->base.data;
+    debug     = sp->subattrs->seg->debugs;
     code_size = sp->subattrs->seg->base.size;
-    debug_ops = sp->subattrs->seg->debugs->base.data;
-    debug_size = sp->subattrs->seg->debugs->base.size;
+    offsets   = Parrot_debug_get_op_offsets(interp, debug, &nops);
 
+    /* words that do not start an op are -2 */
     xdebug = (INTVAL *)mem_sys_allocate_zeroed(code_size * sizeof (INTVAL));
-    for (di = 0, op = 0; op < code_size && di < debug_size; di++) {
-        const op_info_t * const op_info  = sp->subattrs->seg->op_info_table[*base_pc];
-        opcode_t opsize = op_info->op_count;
-        ADD_OP_VAR_PART(interp, sp->subattrs->seg, base_pc, opsize);
-        base_pc += opsize;
-        xdebug[op++] = *debug_ops >= 0 ? *debug_ops : -1;
-        while (--opsize > 0) {
-            xdebug[op++] = -2;
-        }
-        debug_ops++;
-    }
-    while (op < code_size)
-        xdebug[op++] = -2;
+    for (op = 0; op < code_size; op++)
+        xdebug[op] = -2;
+    for (i = 0; i < nops; i++)
+        xdebug[offsets[i]] = debug->base.data[i] >= 0 ? debug->base.data[i] : -1;
     Parrot_hash_put(interp, spdata->seg2debug, (void*)sp->subattrs->seg, (void*)xdebug);
     return xdebug;
 }
@@ -341,45 +333,23 @@ findlineannotations(PARROT_INTERP,
 {
     ASSERT_ARGS(findlineannotations)
 
-    int    i;
-    size_t j,
-           cnt,
-           first;
+    INTVAL   key_id;
+    opcode_t cnt, first;
 
-    PackFile_Annotations     *ann = sp->subattrs->seg->annotations;
-    PackFile_Annotations_Key *key;
-    STRING                   *line_str;
+    PackFile_Annotations * const ann = sp->subattrs->seg->annotations;
 
     if (!ann)
         return NULL;
 
-    line_str = Parrot_str_new_constant(interp, "line");
-
-    /* search for the first line annotation in our sub */
-    for (i = 0; i < ann->num_keys; i++) {
-        STRING * const test_key = ann->code->const_table->str.constants[ann->keys[i].name];
-
-        if (STRING_equal(interp, test_key, line_str))
-            break;
-    }
+    key_id = Parrot_pf_annotations_find_key(interp, ann,
+                Parrot_str_new_constant(interp, "line"));
 
-    if (i == ann->num_keys)
+    if (key_id < 0)
         return NULL;    /* no annotations with this key */
 
-    cnt   = 0;
-    first = 0;
-    key   = ann->keys + i;
-
-    for (j = key->start; j < key->start + key->len; j++) {
-        if ((size_t)ann->base.data[j * 2 + ANN_ENTRY_OFF] < sp->subattrs->start_offs)
-            continue;
-        if ((size_t)ann->base.data[j * 2 + ANN_ENTRY_OFF] >= sp->subattrs->end_offs)
-            break;
-        if (!cnt++) {
-            first = j;
-        }
-    }
-
+    /* the line annotations in our sub */
+    cnt   = Parrot_pf_annotations_range(ann, key_id,
+                sp->subattrs->start_offs, sp->subattrs->end_offs, &first);
     *cntp = cnt;
 
     return cnt ? ann->base.data + first * 2 : NULL;
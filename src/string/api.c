@@ -139,6 +139,8 @@ Parrot_str_init(PARROT_INTERP)
 
     /* initialize the constant string table */
     if (interp->parent_interpreter) {
+        /* child interpreters don't intern; the table isn't thread-safe */
+        interp->interned_strings    = NULL;
         interp->const_cstring_table =
             interp->parent_interpreter->const_cstring_table;
         interp->const_cstring_hash  =
@@ -152,6 +154,10 @@ Parrot_str_init(PARROT_INTERP)
                                         Hash_key_type_cstring,
                                         n_parrot_cstrings);
     interp->const_cstring_hash  = const_cstring_hash;
+    interp->interned_strings    = Parrot_hash_create_sized(interp,
+                                        enum_type_STRING,
+                                        Hash_key_type_STRING_enc,
+                                        n_parrot_cstrings);
     Parrot_encodings_init(interp);
 
     /* initialize STRINGNULL, but not in the constant table */
@@ -171,9 +177,10 @@ Parrot_str_init(PARROT_INTERP)
                 parrot_cstrings[i].len,
                 Parrot_default_encoding_ptr,
                 PObj_external_FLAG|PObj_constant_FLAG);
+        STRING * const interned = Parrot_str_intern(interp, s);
         Parrot_hash_put(interp, const_cstring_hash,
-            PARROT_const_cast(char *, parrot_cstrings[i].string), (void *)s);
-        interp->const_cstring_table[i] = s;
+            PARROT_const_cast(char *, parrot_cstrings[i].string), (void *)interned);
+        interp->const_cstring_table[i] = interned;
     }
 }
 
@@ -201,6 +208,11 @@ Parrot_str_finish(PARROT_INTERP)
         Parrot_deinit_encodings(interp);
         Parrot_hash_destroy(interp, interp->const_cstring_hash);
     }
+
+    if (interp->interned_strings) {
+        Parrot_hash_destroy(interp, interp->interned_strings);
+        interp->interned_strings = NULL;
+    }
 }
 
 
@@ -411,8 +423,9 @@ Parrot_str_copy(PARROT_INTERP, ARGIN_NULLOK(const STRING *s))
     /* Clear live flag. It might be set on constant strings */
     PObj_live_CLEAR(d);
 
-    /* Set the string copy flag */
+    /* Set the string copy flag; only the original can be canonical */
     PObj_is_string_copy_SET(d);
+    STRING_interned_CLEAR(d);
 
     is_movable = PObj_is_movable_TESTALL(s);
 
@@ -630,6 +643,7 @@ Parrot_str_new_constant(PARROT_INTERP, ARGIN(const char *buffer))
     s = Parrot_str_new_init(interp, buffer, strlen(buffer),
                        Parrot_default_encoding_ptr,
                        PObj_external_FLAG|PObj_constant_FLAG);
+    s = Parrot_str_intern(interp, s);
 
     Parrot_hash_put(interp, cstring_cache,
         PARROT_const_cast(char *, buffer), (void *)s);
@@ -637,6 +651,53 @@ Parrot_str_new_constant(PARROT_INTERP, ARGIN(const char *buffer))
     return s;
 }
 
+
+/*
+
+=item C<STRING * Parrot_str_intern(PARROT_INTERP, STRING *s)>
+
+Returns the canonical copy of C<s> from the interpreter's intern table. Equal
+interned STRINGs are the same object, so they compare by pointer and carry a
+cached C<hashval>.
+
+Only constant STRINGs are added to the table.  Any other STRING is returned
+unchanged unless an equal constant was interned before, so interning never
+keeps a STRING alive that the GC could otherwise collect.  Strings with
+different encodings are interned separately.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_WARN_UNUSED_RESULT
+PARROT_CAN_RETURN_NULL
+STRING *
+Parrot_str_intern(PARROT_INTERP, ARGIN_NULLOK(STRING *s))
+{
+    ASSERT_ARGS(Parrot_str_intern)
+    Hash   * const table = interp->interned_strings;
+    STRING *canonical;
+
+    if (STRING_IS_NULL(s) || STRING_interned_TEST(s) || !table)
+        return s;
+
+    canonical = (STRING *)Parrot_hash_get(interp, table, s);
+
+    if (canonical)
+        return canonical;
+
+    if (PObj_constant_TEST(s)) {
+        if (!s->hashval)
+            (void)STRING_hash(interp, s, table->seed);
+
+        STRING_interned_SET(s);
+        Parrot_hash_put(interp, table, s, s);
+    }
+
+    return s;
+}
+
 /*
 
 =item C<STRING * Parrot_str_new_init(PARROT_INTERP, const char *buffer, UINTVAL
@@ -1428,7 +1489,8 @@ necessary. The null string is considered equal to the empty string.
 
 Returns 1 if the strings are equal, and 0 otherwise.
 
-Identical to the STRING_equal macro.
+Identical to the STRING_equal macro, except that identical pointers (as for
+interned strings) short-circuit the comparison.
 
 =cut
 
@@ -1441,6 +1503,9 @@ Parrot_str_equal(PARROT_INTERP, ARGIN_NULLOK(const STRING *s1), ARGIN_NULLOK(con
 {
     ASSERT_ARGS(Parrot_str_equal)
 
+    if (s1 == s2)
+        return 1;
+
     if (s1 == NULL)
         s1 = STRINGNULL;
 
@@ -2291,6 +2356,8 @@ Parrot_str_free_cstring(ARGFREE(char *p))
 =item C<void Parrot_str_pin(PARROT_INTERP, STRING *s)>
 
 Replaces the specified Parrot string's managed buffer memory by system memory.
+Only the string's own bytes are copied, not the whole buffer it may share with
+other strings, so pinning a short substring of a large buffer stays cheap.
 
 =cut
 
@@ -2301,11 +2368,13 @@ void
 Parrot_str_pin(SHIM_INTERP, ARGMOD(STRING *s))
 {
     ASSERT_ARGS(Parrot_str_pin)
-    const size_t size = Buffer_buflen(s);
-    char * const memory = (char *)mem_internal_allocate(size);
+    const size_t size = s->bufused;
+    char * const memory = (char *)mem_internal_allocate(size ? size : 1);
 
-    memcpy(memory, Buffer_bufstart(s), size);
+    if (size)
+        memcpy(memory, s->strstart, size);
     Buffer_bufstart(s) = memory;
+    Buffer_buflen(s)   = size;
     s->strstart        = memory;
 
     /* Mark the memory as both from the system and immobile */
@@ -22,6 +22,7 @@ Subroutines, continuations, co-routines and other fun stuff...
 #include "sub.str"
 #include "pmc/pmc_sub.h"
 #include "pmc/pmc_continuation.h"
+#include "pmc/pmc_lexpad.h"
 #include "parrot/oplib/core_ops.h"
 
 /* HEADERIZER HFILE: include/parrot/sub.h */
@@ -102,9 +103,30 @@ Parrot_sub_context_get_info(PARROT_INTERP, ARGIN(PMC *ctx),
     ARGOUT(Parrot_Context_info *info))
 {
     ASSERT_ARGS(Parrot_sub_context_get_info)
-    PMC                   *subpmc;
+
+    return Parrot_sub_frame_get_info(interp, Parrot_pcc_get_sub(interp, ctx),
+            Parrot_pcc_get_pc(interp, ctx), info);
+}
+
+/*
+
+=item C<int Parrot_sub_frame_get_info(PARROT_INTERP, PMC *subpmc, opcode_t *pc,
+Parrot_Context_info *info)>
+
+Like C<Parrot_sub_context_get_info>, for a sub and pc that need not belong to
+a live context, such as the frames an exception notes when thrown.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+int
+Parrot_sub_frame_get_info(PARROT_INTERP, ARGIN_NULLOK(PMC *subpmc),
+    ARGIN_NULLOK(opcode_t *pc), ARGOUT(Parrot_Context_info *info))
+{
+    ASSERT_ARGS(Parrot_sub_frame_get_info)
     Parrot_Sub_attributes *sub;
-    opcode_t              *pc;
 
     /* set file/line/pc defaults */
     info->file     = CONST_STRING(interp, "(unknown file)");
@@ -114,8 +136,6 @@ Parrot_sub_context_get_info(PARROT_INTERP, ARGIN(PMC *ctx),
     info->subname  = NULL;
     info->fullname = NULL;
 
-    subpmc = Parrot_pcc_get_sub(interp, ctx);
-
     /* is the current sub of the specified context valid? */
     if (PMC_IS_NULL(subpmc)) {
         info->subname  = Parrot_str_new(interp, "???", 3);
@@ -143,8 +163,6 @@ Parrot_sub_context_get_info(PARROT_INTERP, ARGIN(PMC *ctx),
         info->fullname = Parrot_sub_full_sub_name(interp, subpmc);
     }
 
-    pc = Parrot_pcc_get_pc(interp, ctx);
-
     /* return here if there is no current pc */
     if (!pc)
         return 1;
@@ -153,30 +171,20 @@ Parrot_sub_context_get_info(PARROT_INTERP, ARGIN(PMC *ctx),
     info->pc = pc - sub->seg->base.data;
 
     /* determine the current source file/line */
-    if (pc) {
-        const size_t offs = info->pc;
-        size_t i, n;
-        opcode_t *pc = sub->seg->base.data;
+    {
         PackFile_Debug * const debug = sub->seg->debugs;
+        INTVAL                 line;
 
         if (!debug)
             return 0;
-        for (i = n = 0; n < sub->seg->base.size; ++i) {
-            op_info_t * const op_info = sub->seg->op_info_table[*pc];
-            opcode_t var_args = 0;
-
-            if (i >= debug->base.size)
-                return 0;
-            if (n >= offs) {
-                /* set source line and file */
-                info->line = debug->base.data[i];
-                info->file = Parrot_debug_pc_to_filename(interp, debug, i);
-                break;
-            }
-            ADD_OP_VAR_PART(interp, sub->seg, pc, var_args);
-            n  += op_info->op_count + var_args;
-            pc += op_info->op_count + var_args;
-        }
+
+        line = Parrot_debug_pc_to_line(interp, debug, info->pc);
+        if (line < 0)
+            return 0;
+
+        /* set source line and file */
+        info->line = line;
+        info->file = Parrot_debug_pc_to_filename(interp, debug, info->pc);
     }
 
     return 1;
@@ -200,39 +208,17 @@ Parrot_sub_get_line_from_pc(PARROT_INTERP, ARGIN_NULLOK(PMC *subpmc), ARGIN_NULL
 {
     ASSERT_ARGS(Parrot_sub_get_line_from_pc)
     Parrot_Sub_attributes *sub;
-    opcode_t              *base_pc, *debug_ops;
-    size_t                 i, op, current_annotation, debug_size, code_size;
 
     if (!subpmc || !pc)
         return -1;
 
     PMC_get_sub(interp, subpmc, sub);
 
-    debug_ops          = sub->seg->debugs->base.data;
-    debug_size         = sub->seg->debugs->base.size;
-    code_size          = sub->seg->base.size;
-    base_pc            = sub->seg->base.data;
-    current_annotation = pc - base_pc;
-
     /* assert pc is in correct segment */
-    PARROT_ASSERT(base_pc <= pc && pc <= base_pc + code_size);
-
-    for (i = op = 0; op < code_size; ++i) {
-        op_info_t * const op_info  = sub->seg->op_info_table[*base_pc];
-        opcode_t          var_args = 0;
+    PARROT_ASSERT(sub->seg->base.data <= pc
+               && pc <= sub->seg->base.data + sub->seg->base.size);
 
-        if (i >= debug_size)
-            return -1;
-
-        if (op >= current_annotation)
-            return debug_ops[i];
-
-        ADD_OP_VAR_PART(interp, sub->seg, base_pc, var_args);
-        op      += op_info->op_count + var_args;
-        base_pc += op_info->op_count + var_args;
-    }
-
-    return -1;
+    return Parrot_debug_pc_to_line(interp, sub->seg->debugs, pc - sub->seg->base.data);
 }
 
 
@@ -287,12 +273,37 @@ STRING*
 Parrot_sub_Context_infostr(PARROT_INTERP, ARGIN(PMC *ctx), int is_top)
 {
     ASSERT_ARGS(Parrot_sub_Context_infostr)
+
+    return Parrot_sub_frame_infostr(interp, Parrot_pcc_get_sub(interp, ctx),
+            Parrot_pcc_get_pc(interp, ctx), is_top);
+}
+
+/*
+
+=item C<STRING* Parrot_sub_frame_infostr(PARROT_INTERP, PMC *subpmc, opcode_t
+*pc, int is_top)>
+
+Formats the information for a sub at the given pc, as
+C<Parrot_sub_Context_infostr> does for a context.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+STRING*
+Parrot_sub_frame_infostr(PARROT_INTERP, ARGIN_NULLOK(PMC *subpmc),
+        ARGIN_NULLOK(opcode_t *pc), int is_top)
+{
+    ASSERT_ARGS(Parrot_sub_frame_infostr)
     Parrot_Context_info info;
     STRING             *res = NULL;
     const char * const  msg = is_top ? "current instr.:" : "called from Sub";
 
     Parrot_block_GC_mark(interp);
-    if (Parrot_sub_context_get_info(interp, ctx, &info)) {
+    if (Parrot_sub_frame_get_info(interp, subpmc, pc, &info)) {
 
         res = Parrot_sprintf_c(interp,
             "%s '%Ss' pc %d (%Ss:%d)", msg,
@@ -337,6 +348,67 @@ Parrot_sub_find_pad(PARROT_INTERP, ARGIN(STRING *lex_name), ARGIN(PMC *ctx))
 }
 
 
+/*
+
+=item C<PMC* Parrot_sub_find_lex_slot_ctx(PARROT_INTERP, PMC *ctx, INTVAL
+depth)>
+
+Return the context C<depth> steps out from C<ctx>, whose registers hold the
+lexicals the compiler resolved for C<find_lex_slot> and C<store_lex_slot>.
+
+That resolution followed the static C<:outer> chain of subs, so every context
+on the way must have a plain C<LexPad> built from the C<LexInfo> of the
+matching sub on that chain. Return NULL if any doesn't; the ops then look the
+lexical up by name.
+
+=cut
+
+*/
+
+PARROT_CAN_RETURN_NULL
+PARROT_WARN_UNUSED_RESULT
+PMC*
+Parrot_sub_find_lex_slot_ctx(PARROT_INTERP, ARGIN(PMC *ctx), INTVAL depth)
+{
+    ASSERT_ARGS(Parrot_sub_find_lex_slot_ctx)
+    PMC *sub_pmc = Parrot_pcc_get_sub(interp, ctx);
+
+    while (1) {
+        PMC * const lex_pad = Parrot_pcc_get_lex_pad(interp, ctx);
+        PMC        *lex_info;
+        Parrot_Sub_attributes *sub;
+
+        if (PMC_IS_NULL(sub_pmc))
+            return NULL;
+
+        PMC_get_sub(interp, sub_pmc, sub);
+
+        if (PMC_IS_NULL(lex_pad)) {
+            /* only a pad on the way out may be missing */
+            if (!depth || !PMC_IS_NULL(sub->lex_info))
+                return NULL;
+        }
+        else {
+            if (lex_pad->vtable->base_type != enum_class_LexPad)
+                return NULL;
+
+            GETATTR_LexPad_lexinfo(interp, lex_pad, lex_info);
+            if (lex_info != sub->lex_info)
+                return NULL;
+        }
+
+        if (!depth--)
+            return ctx;
+
+        ctx     = Parrot_pcc_get_outer_ctx(interp, ctx);
+        sub_pmc = sub->outer_sub;
+
+        if (PMC_IS_NULL(ctx))
+            return NULL;
+    }
+}
+
+
 /*
 
 =item C<PMC* Parrot_sub_find_dynamic_pad(PARROT_INTERP, STRING *lex_name, PMC
@@ -135,7 +135,8 @@ Parrot_thread_run(PARROT_INTERP, ARGMOD(PMC *thread_interp_pmc), SHIM(PMC *sub),
 =item C<PMC* Parrot_thread_create_proxy(PARROT_INTERP, Parrot_Interp const
 thread, PMC *pmc)>
 
-Create a local proxy in the thread interp for the pmc belonging to interp
+Create a local proxy in the thread interp for the pmc belonging to interp.
+Sealed PMCs (see C<Parrot_thread_seal>) are returned as they are.
 
 =cut
 
@@ -146,7 +147,7 @@ PMC*
 Parrot_thread_create_proxy(PARROT_INTERP, ARGIN(Parrot_Interp const thread), ARGIN(PMC *pmc))
 {
     ASSERT_ARGS(Parrot_thread_create_proxy)
-    if (PMC_IS_NULL(pmc))
+    if (PMC_IS_NULL(pmc) || Parrot_thread_is_sealed(pmc))
         return pmc;
 
     if (pmc->vtable->base_type == enum_class_Sub) {
@@ -259,6 +260,82 @@ Parrot_thread_create_local_task(PARROT_INTERP, ARGIN(Parrot_Interp const thread_
 
 /*
 
+=item C<void Parrot_thread_seal(PARROT_INTERP, PMC *pmc)>
+
+Seals the data graph rooted at C<pmc> into the shared, read-only heap so that
+thread interpreters can use it directly instead of getting a clone or a proxy.
+
+Every PMC reachable from C<pmc> is switched to its read-only vtable and
+flagged as shared and sealed, so that thread GCs skip it and any mutation
+throws. Every string it contains is pinned, copying only its own bytes, so
+string compaction in the main interpreter never moves a buffer while a thread
+reads it. The root is
+registered with the main interpreter's GC, so the graph lives as long as
+the process. Sealing cannot be undone.
+
+Only plain data can be sealed. Subs, classes and objects are rejected
+because threads must bind them to their own interpreter.
+
+=cut
+
+*/
+
+PARROT_EXPORT
+void
+Parrot_thread_seal(PARROT_INTERP, ARGIN(PMC *pmc))
+{
+    ASSERT_ARGS(Parrot_thread_seal)
+    STRING * const _sub    = interp->vtables[enum_class_Sub]->whoami;
+    PMC    * const visitor = Parrot_pmc_new(interp, enum_class_ImageIOSize);
+    PMC           *strings;
+    Hash          *seen;
+    INTVAL         i, n;
+
+    if (Interp_flags_TEST(interp, PARROT_IS_THREAD))
+        Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+            "Shared data can only be sealed by the main interpreter");
+
+    if (PMC_IS_NULL(pmc) || Parrot_thread_is_sealed(pmc))
+        return;
+
+    VTABLE_set_pmc(interp, visitor, pmc);
+    seen = (Hash *)VTABLE_get_pointer(interp, visitor);
+
+    /* check the whole graph first, so a failure leaves nothing half sealed */
+    parrot_hash_iterate(seen, {
+        PMC * const p = (PMC *)_bucket->key;
+        if (!Parrot_thread_is_sealed(p)
+        && (!(p->vtable->flags & VTABLE_HAS_READONLY_FLAG)
+        ||  PObj_is_object_TEST(p) || PObj_is_class_TEST(p)
+        ||  VTABLE_isa(interp, p, _sub)))
+            Parrot_ex_throw_from_c_args(interp, NULL, EXCEPTION_INVALID_OPERATION,
+                "Cannot seal a %Ss", p->vtable->whoami);
+    });
+
+    strings = Parrot_freeze_strings(interp, pmc);
+    n       = VTABLE_elements(interp, strings);
+
+    for (i = 0; i < n; ++i) {
+        STRING * const s = VTABLE_get_string_keyed_int(interp, strings, i);
+
+        if (s && Buffer_bufstart(s) && PObj_is_movable_TESTALL(s))
+            Parrot_str_pin(interp, s);
+    }
+
+    parrot_hash_iterate(seen, {
+        PMC * const p = (PMC *)_bucket->key;
+        if (!Parrot_thread_is_sealed(p)) {
+            p->vtable = p->vtable->ro_variant_vtable;
+            PObj_is_shared_SET(p);
+            PObj_is_sealed_SET(p);
+        }
+    });
+
+    Parrot_pmc_gc_register(interp, pmc);
+}
+
+/*
+
 =item C<void Parrot_thread_schedule_task(PARROT_INTERP, Interp *thread_interp,
 PMC *task)>
 
@@ -477,7 +554,7 @@ PMC *arg)>
 Creates a local copy of the PMC. This includes workarounds for Parrot_clone()
 not doing the Right Thing with subroutines (specifically, code segments aren't
 preserved and it is difficult to do so as long as Parrot_clone() depends on
-freezing).
+freezing). Sealed PMCs are not copied at all.
 
 =cut
 
@@ -494,6 +571,8 @@ Parrot_thread_make_local_copy(PARROT_INTERP, ARGIN(Parrot_Interp from), ARGIN(PM
 
     if (PMC_IS_NULL(arg))
         ret_val = PMCNULL;
+    else if (Parrot_thread_is_sealed(arg))
+        ret_val = arg;
     else if (VTABLE_isa(from, arg, _multi_sub)) {
         INTVAL i = 0;
         const INTVAL n = VTABLE_elements(from, arg);
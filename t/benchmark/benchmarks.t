@@ -138,6 +138,7 @@ FixedPMCArray:\s\d+\.\d+s\n
         Copying\sa\stotal\sof\s\d+\sbytes\n
         There\sare\s\d+\sactive\sBuffer\sstructs\n
         There\sare\s\d+\stotal\sBuffer\sstructs\n$/x,
+    q{imcc_compile.pir} => qr/^Compiled\s\d+\slines\sin\s\d+\.\d+s\s\(\d+\slines\/s\)\n$/x,
 #omitted because they're slow and doesn't exercise anything novel
 #    q{mops.pasm} => qr/^Iterations:\s\s\s\s10000000\n
 #        Estimated\sops:\s20000000\n
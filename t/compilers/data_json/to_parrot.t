@@ -6,7 +6,7 @@ use warnings;
 use lib qw( t . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 61;
+use Parrot::Test tests => 64;
 
 =head1 NAME
 
@@ -693,6 +693,74 @@ JSON
 ]
 OUT
 
+pir_output_is( <<'CODE', <<'OUT', 'each call of the compiled sub gets values of its own' );
+.sub test :main
+    load_language 'data_json'
+    .local pmc json, code
+    json = compreg 'data_json'
+    code = json.'compile'('[1,{"a":true}]')
+    $P0  = code()
+    $P1  = code()
+    push $P0, 2
+    $S0 = json.'encode'($P0)
+    say $S0
+    $S0 = json.'encode'($P1)
+    say $S0
+.end
+CODE
+[1,{"a":true},2]
+[1,{"a":true}]
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', 'decode method and PIR target' );
+.sub test :main
+    load_language 'data_json'
+    .local pmc json
+    json = compreg 'data_json'
+    $P0  = json.'decode'('{"b":[null]}')
+    $S0  = json.'encode'($P0, 1)
+    print $S0
+    $P0  = json.'compile'('[1]', 'target' => 'pir')
+    $S0  = $P0
+    $I0  = index $S0, '.sub'
+    say $I0
+.end
+CODE
+{
+  "b" : [
+    null
+  ]
+}
+0
+OUT
+pir_output_is( <<'CODE', <<'OUT', 'decode and encode without the jsoncodec library' );
+.sub test :main
+    load_language 'data_json'
+    .local pmc json
+    json = compreg 'data_json'
+    null $P0
+    set_root_global ['parrot'; 'data_json'], '$codec', $P0
+    $P0  = json.'decode'('{"b":[1,2.5]}')
+    $S0  = json.'encode'($P0, 1)
+    print $S0
+    $P0  = new ['StringHandle']
+    $P0.'open'('json', 'w')
+    $P0.'print'('[3]')
+    $P0.'close'()
+    $P0.'open'('json', 'r')
+    $P0  = json.'decode'($P0)
+    $S0  = json.'encode'($P0)
+    say $S0
+.end
+CODE
+{
+  "b" : [
+    1,
+    2.5
+  ]
+}
+[3]
+OUT
 
 # GH #570 Need many more tests, exercising all aspects of http://www.json.org/
 
@@ -0,0 +1,126 @@
+#!perl
+# Copyright (C) 2012, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+use Parrot::Test tests => 5;
+
+# the "opt1" in this file's name runs every test with -O1, where symbols
+# whose live ranges don't overlap share a register
+
+pir_output_is( <<'CODE', <<'OUT', "disjoint temporaries share registers" );
+.sub main :main
+    foo()
+.end
+.sub foo
+    .local pmc m
+    .include "interpinfo.pasm"
+    m = interpinfo .INTERPINFO_CURRENT_SUB
+    $I0 = 1
+    print $I0
+    $I1 = 2
+    print $I1
+    $I2 = 3
+    print $I2
+    print "\n"
+    $I3 = m."__get_regs_used"('I')
+    print $I3
+    print "\n"
+.end
+CODE
+123
+1
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values carried around a loop" );
+.sub main :main
+    .local int i, sum
+    sum = 0
+    i = 0
+  loop:
+    $I0 = i * 2
+    sum += $I0
+    inc i
+    if i < 5 goto loop
+    $S0 = sum
+    print $S0
+    print "\n"
+.end
+CODE
+20
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "registers live at an exception handler" );
+.sub main :main
+    $P0 = new 'String'
+    $P0 = "kept\n"
+    push_eh handler
+    $P1 = new 'Integer'
+    $P1 = 3
+    die "oops"
+    pop_eh
+    print "not reached\n"
+    .return ()
+  handler:
+    .get_results ($P2)
+    pop_eh
+    print $P0
+.end
+CODE
+kept
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "lexicals stored from an inner sub" );
+.sub main :main
+    .local pmc a, b, c
+    .lex 'a', a
+    .lex 'b', b
+    a = box 1
+    inner()
+    b = box 2
+    c = find_lex 'a'
+    print c
+    print b
+    print "\n"
+.end
+.sub inner :outer(main)
+    $P0 = box 5
+    store_lex 'a', $P0
+.end
+CODE
+52
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values live across a call resumed twice" );
+.sub main :main
+    .local pmc k
+    .local int n
+    $S0 = "tail\n"
+    n = 0
+    k = grab()
+    inc n
+    $S1 = "once\n"
+    print $S1
+    if n > 1 goto done
+    k()
+  done:
+    print $S0
+.end
+.sub grab
+    .include "interpinfo.pasm"
+    $P0 = interpinfo .INTERPINFO_CURRENT_CONT
+    .return ($P0)
+.end
+CODE
+once
+once
+tail
+OUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
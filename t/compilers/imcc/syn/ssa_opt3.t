@@ -0,0 +1,182 @@
+#!perl
+# Copyright (C) 2012, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 8;
+use Parrot::Config;
+use Parrot::Test::Util 'create_tempfile';
+
+# the "opt3" in this file's name runs every test with -O3: copy propagation,
+# value numbering and loop-invariant code motion
+
+my $loop = <<'CODE';
+.sub main :main
+    .local int i, n, k, sum
+    .local num x
+    n = 10
+    k = 7
+    x = 1.5
+    sum = 0
+    i = 0
+  loop:
+    $I0 = k * 3
+    $I1 = $I0 + n
+    $I2 = n + $I0
+    $I3 = $I1
+    sum += $I3
+    sum += $I2
+    $N0 = x * 2.0
+    inc i
+    if i < n goto loop
+    print sum
+    print "\n"
+    print $N0
+    print "\n"
+.end
+CODE
+
+pir_output_is( $loop, <<'OUT', "invariants and redundant ops in a loop" );
+620
+3
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values computed on either branch" );
+.sub main :main
+    .local int a, b, c
+    a = 3
+    b = 4
+    c = 0
+    unless c goto other
+    $I0 = a + b
+    print $I0
+    print "\n"
+    goto join
+  other:
+    $I1 = a * b
+    print $I1
+    print "\n"
+  join:
+    $I2 = a + b
+    $I3 = a * b
+    print $I2
+    print " "
+    print $I3
+    print "\n"
+.end
+CODE
+12
+7 12
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "ops depending on the loop stay in it" );
+.sub main :main
+    .local int i, sum
+    sum = 0
+    i = 0
+  loop:
+    $I0 = i * 2
+    sum += $I0
+    inc i
+    if i < 4 goto loop
+    print sum
+    print "\n"
+.end
+CODE
+12
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "copies of PMCs and strings" );
+.sub main :main
+    $P0 = new 'ResizablePMCArray'
+    $P1 = $P0
+    push $P1, 1
+    push $P1, 2
+    $I0 = elements $P0
+    print $I0
+    print "\n"
+    $S0 = "abc"
+    $S1 = $S0
+    $S2 = $S1 . "def"
+    print $S2
+    print "\n"
+.end
+CODE
+2
+abcdef
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "values reaching an exception handler" );
+.sub main :main
+    .local int a
+    a = 5
+    push_eh handler
+    $I0 = a + 1
+    $P0 = new 'Integer'
+    $P0 = $I0
+    die "oops"
+  handler:
+    .get_results ($P1)
+    pop_eh
+    $I1 = a + 1
+    print $I1
+    print "\n"
+.end
+CODE
+6
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "lexicals are left alone" );
+.sub main :main
+    .lex '$x', $P0
+    $P0 = box 1
+    $P1 = $P0
+    bump()
+    $P2 = find_lex '$x'
+    print $P2
+    print " "
+    print $P1
+    print "\n"
+.end
+.sub bump :outer(main)
+    $P0 = box 2
+    store_lex '$x', $P0
+.end
+CODE
+2 1
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "copies of PMCs that add replaces" );
+.sub main :main
+    $P0 = box 1
+    $P3 = $P0
+    $P1 = box 2
+    $P2 = box 5
+    add $P0, $P1, $P2
+    say $P3
+    say $P0
+.end
+CODE
+1
+7
+OUT
+
+{
+    my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+    my ( $fh, $file ) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh $loop;
+    close $fh;
+    my $stats = qx{$PARROT -O3 -v $file 2>&1};
+    like( $stats, qr/3 invariants_moved\n\s*1 copies propagated, 1 values numbered/,
+        '-v counts the ops moved and deleted' );
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,156 @@
+#!perl
+# Copyright (C) 2012, Parrot Foundation.
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 6;
+use Parrot::Config;
+use Parrot::Test::Util 'create_tempfile';
+
+# the "opt3" in this file's name runs every test with -O3, where ops reading
+# Integer and Float PMCs boxed from native values may use the values instead
+
+my $float = <<'CODE';
+.sub main :main
+    .local pmc x, y, z, lim
+    .local int i
+    x = box 0.5
+    y = box 2
+    lim = box 3
+    z = x + y
+    $N0 = z
+    print $N0
+    print "\n"
+    i = 0
+  loop:
+    inc i
+    $P0 = box i
+    if $P0 < lim goto loop
+    print i
+    print "\n"
+    $P1 = box 1.5
+    $I0 = $P1
+    print $I0
+    print "\n"
+    print z
+    print "\n"
+.end
+CODE
+
+pir_output_is( $float, <<'OUT', "Float arithmetic and comparisons" );
+2.5
+3
+1
+2.5
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "Integers compared with Floats" );
+.sub main :main
+    .param pmc argv
+    $I0 = elements argv
+    $N0 = $I0
+    $N0 += 0.25
+    $P0 = box $I0
+    $P1 = box $N0
+    $P2 = box 1.25
+    if $P0 > $P1 goto bad
+    unless $P0 < $P1 goto bad
+    if $P1 == $P2 goto ok
+  bad:
+    print "not "
+  ok:
+    print "ok 1\n"
+    $P3 = box 1.9
+    if $P0 == $P3 goto eq
+    print "not "
+  eq:
+    print "ok 2\n"
+.end
+CODE
+ok 1
+ok 2
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "comparisons with NaN go through cmp" );
+.sub main :main
+    $N0 = 'NaN'
+    $P0 = box $N0
+    $P1 = box 1.0
+    if $P0 <= $P1 goto le
+    print "not "
+  le:
+    print "ok 1\n"
+    if $P0 < $P1 goto bad
+    if $P0 > $P1 goto bad
+    if $P0 == $P1 goto bad
+    print "ok 2\n"
+    .return ()
+  bad:
+    print "not ok 2\n"
+.end
+CODE
+ok 1
+ok 2
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "PMCs changed in place or passed on stay boxed" );
+.sub main :main
+    $P0 = box 1
+    inc $P0
+    if $P0 > 1 goto ok1
+    print "not "
+  ok1:
+    print "ok 1\n"
+    $P1 = box 1.5
+    bump($P1)
+    $N0 = $P1
+    print $N0
+    print "\n"
+.end
+.sub bump
+    .param pmc n
+    n += 1
+.end
+CODE
+ok 1
+2.5
+OUT
+
+pir_output_is( <<'CODE', <<'OUT', "Integer arithmetic keeps its PMCs" );
+.sub main :main
+    $P0 = box 7
+    $P1 = box 3
+    $P2 = $P0 * $P1
+    $P3 = $P0 - $P1
+    print $P2
+    print " "
+    print $P3
+    print "\n"
+    $P4 = box 2.5
+    $P5 = $P0 * $P4
+    print $P5
+    print "\n"
+.end
+CODE
+21 4
+17
+OUT
+
+{
+    my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+    my ( $fh, $file ) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+    print $fh $float;
+    close $fh;
+    my $stats = qx{$PARROT -O3 -v $file 2>&1};
+    like( $stats, qr/values numbered, 4 ops unboxed/, '-v counts the ops unboxed' );
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -0,0 +1,116 @@
+#!./parrot
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+t/compilers/pge/05-prescan.t - Test the start-of-match prescan and quantified lists
+
+=head1 SYNOPSIS
+
+        % prove t/compilers/pge/05-prescan.t
+
+=head1 DESCRIPTION
+
+Unanchored regexes skip ahead to where a match could start, alternations
+skip alternatives that can't match, and quantified character lists are
+matched in one scan.  These check that the matches found don't change.
+
+=cut
+
+.namespace []
+
+.sub main :main
+    .include 'test_more.pir'
+    plan(19)
+
+    load_bytecode 'PGE.pbc'
+    test_literal()
+    test_alternation()
+    test_cclass()
+    test_enumcharlist()
+.end
+
+
+.sub 'match_is'
+    .param string source
+    .param string target
+    .param string expected
+    .param string desc
+
+    .local pmc p6regex
+    p6regex = compreg 'PGE::Perl6Regex'
+    $P0 = p6regex(source)
+    $P1 = $P0(target)
+    $S0 = ''
+    unless $P1 goto have_match
+    $S0 = $P1
+  have_match:
+    is($S0, expected, desc)
+.end
+
+
+.sub 'test_literal'
+    .local pmc p6regex, regex, match
+    p6regex = compreg 'PGE::Perl6Regex'
+
+    $P0 = p6regex('foo', 'target'=>'pir')
+    $S0 = $P0
+    $I0 = index $S0, 'index target, "foo", cpos'
+    isnt($I0, -1, 'a literal start is found with index')
+
+    regex = p6regex('foo')
+    match = regex('xxfoox')
+    $I0 = match.'from'()
+    is($I0, 2, '... and matches where it occurs')
+    match = regex('xxfoo', 'pos'=>0)
+    nok(match, '... but not past an anchored position')
+
+    regex = p6regex('a.')
+    match = regex('abxac')
+    match.'next'()
+    is(match, 'ac', '... and backtracking into the match scans on')
+
+    $I1 = 0
+    $I0 = 0
+  continue_loop:
+    match = regex('a1a2a3a', 'c'=>$I0)
+    unless match goto continue_done
+    inc $I1
+    $I0 = match.'to'()
+    goto continue_loop
+  continue_done:
+    is($I1, 3, '... and so does :c')
+
+    match_is(':i FOO', 'xfOo', 'fOo', 'ignorecase literals still match')
+    match_is('a*b', 'ccb', 'b', 'a start that can be empty still matches')
+.end
+
+
+.sub 'test_alternation'
+    match_is('abc|abd', 'xxabdy', 'abd', 'alternation with a common prefix')
+    match_is('x|y', 'aay', 'y', 'alternation of single characters')
+    match_is('ab|a', 'aac', 'a', 'an alternative that fails its guard falls through')
+    match_is('[ab|<[cd]>]e', 'xxde', 'de', 'alternation of a literal and a list')
+.end
+
+
+.sub 'test_cclass'
+    match_is('\d+', 'ab123c', '123', 'a class start')
+    match_is('\N+', "\n\nab\n", 'ab', '... and a negated one')
+    match_is('\n a', "x\na", "\na", '... and a newline')
+.end
+
+
+.sub 'test_enumcharlist'
+    match_is('<[a..c]>+c', 'xabcbcy', 'abcbc', 'quantified lists backtrack when greedy')
+    match_is('<[ab]>+?b', 'aab', 'aab', '... and when eager')
+    match_is('<[a]>**{2..3}', 'aaaaa', 'aaa', '... and stop at the maximum')
+    match_is('<-[x]>+', 'xxabx', 'ab', '... and can be negated')
+    match_is('[:ratchet <[ab]>+ b]', 'aab', '', '... and give nothing back when ratcheting')
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
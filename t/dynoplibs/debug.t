@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 10;
+use Parrot::Test tests => 11;
 use Parrot::Config;
 
 use Parrot::Test::Util 'create_tempfile';
@@ -228,6 +228,24 @@ called from Sub 'rec' pc (\d+|-1) \(.*?:(\d+|-1)\)
 called from Sub 'main' pc (\d+|-1) \(.*?:(\d+|-1)\)$/
 OUTPUT
 
+pir_error_output_like( <<'CODE', <<'OUTPUT', "debug backtrace - exact line numbers" );
+.sub main :main
+    $I0 = 1
+    inner()
+.end
+
+.sub inner
+    $I0 = 2
+
+    $P0 = null
+    $P0()
+.end
+CODE
+/^Null PMC access in invoke\(\)
+current instr\.: 'inner' pc (\d+|-1) \(.*?:(10|-1)\)
+called from Sub 'main' pc (\d+|-1) \(.*?:(3|-1)\)$/
+OUTPUT
+
 $nolineno = $ENV{TEST_PROG_ARGS} =~ /--runcore=fast/
     ? '\(\(unknown file\):-1\)' : '\(xyz.pir:126\)';
 
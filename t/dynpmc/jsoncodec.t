@@ -0,0 +1,178 @@
+#!./parrot
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+t/dynpmc/jsoncodec.t - test the JSONCodec PMC
+
+=head1 SYNOPSIS
+
+        % parrot t/dynpmc/jsoncodec.t
+
+=head1 DESCRIPTION
+
+Tests the C<JSONCodec> PMC, the native JSON decoder and encoder.
+
+=cut
+
+.sub 'main' :main
+    .include 'test_more.pir'
+
+    plan(27)
+    $P0 = loadlib 'jsoncodec'
+    test_scalars()
+    test_numbers()
+    test_strings()
+    test_containers()
+    test_handle()
+    test_errors()
+    test_encode()
+    test_encode_pretty()
+.end
+
+.sub 'test_scalars'
+    .local pmc codec
+    codec = new ['JSONCodec']
+
+    $P0 = codec.'decode'('true')
+    $S0 = typeof $P0
+    is($S0, 'Boolean', 'true is a Boolean')
+    ok($P0, '... which is true')
+    $P0 = codec.'decode'(' false ')
+    nok($P0, 'false, with whitespace around it')
+    $P0 = codec.'decode'('null')
+    $I0 = isnull $P0
+    ok($I0, 'null is a null PMC')
+.end
+
+.sub 'test_numbers'
+    .local pmc codec
+    codec = new ['JSONCodec']
+
+    $P0 = codec.'decode'('-42')
+    $S0 = typeof $P0
+    is($S0, 'Integer', 'integers are Integers')
+    is($P0, -42, '... with the value')
+    $P0 = codec.'decode'('9223372036854775808')
+    $S0 = typeof $P0
+    is($S0, 'Float', 'integers too large for an INTVAL are Floats')
+    $P0 = codec.'decode'('-3.14e+2')
+    $S0 = typeof $P0
+    is($S0, 'Float', 'fractions and exponents are Floats')
+    is($P0, -314.0, '... with the value')
+.end
+
+.sub 'test_strings'
+    .local pmc codec
+    codec = new ['JSONCodec']
+
+    $P0 = codec.'decode'("\"a\\\"b\\\\c\\/d\\n\\t\"")
+    is($P0, "a\"b\\c/d\n\t", 'escapes')
+    $P0 = codec.'decode'("\"\\u00e4\\u203e\"")
+    $S0 = $P0
+    $I0 = ord $S0, 0
+    $I1 = ord $S0, 1
+    is($I0, 0xe4, '\u escapes')
+    is($I1, 0x203e, '... outside latin1 too')
+    $P0 = codec.'decode'("\"\\ud83d\\ude00\\udc00\"")
+    $S0 = $P0
+    $I0 = ord $S0, 0
+    $I1 = ord $S0, 1
+    is($I0, 0x1f600, 'surrogate pairs are joined')
+    is($I1, 0xfffd, '... and lone ones replaced')
+.end
+
+.sub 'test_containers'
+    .local pmc codec, result
+    codec  = new ['JSONCodec']
+    result = codec.'decode'('{ "a" : [1, {"b" : null}, []], "a" : [2], "c" : {} }')
+
+    $S0 = typeof result
+    is($S0, 'Hash', 'objects are Hashes')
+    $P0 = result['a']
+    $S0 = typeof $P0
+    is($S0, 'ResizablePMCArray', 'arrays are ResizablePMCArrays')
+    $I0 = elements $P0
+    is($I0, 1, 'the last value of a repeated key wins')
+    $P0 = result['c']
+    $I0 = elements $P0
+    is($I0, 0, 'empty objects')
+.end
+
+.sub 'test_handle'
+    .local pmc codec, fh, result
+    codec = new ['JSONCodec']
+    fh    = new ['StringHandle']
+    fh.'open'('json', 'w')
+    fh.'print'("[1,\n 2]\n")
+    fh.'close'()
+    fh.'open'('json', 'r')
+    result = codec.'decode'(fh)
+    $I0 = result[1]
+    is($I0, 2, 'decodes what it reads from a handle')
+.end
+
+.sub 'test_errors'
+    throws_like(<<'CODE', "'not a valid JSON value at line 2, near \"x}\"'", 'syntax errors say where')
+.sub main
+    $P0 = loadlib 'jsoncodec'
+    $P0 = new ['JSONCodec']
+    $P0.'decode'("{\"a\":\n x}")
+.end
+CODE
+    throws_like(<<'CODE', "'not a valid JSON value'", 'trailing text is an error')
+.sub main
+    $P0 = loadlib 'jsoncodec'
+    $P0 = new ['JSONCodec']
+    $P0.'decode'('[1] 2')
+.end
+CODE
+    throws_like(<<'CODE', "'not a valid JSON value'", 'leading zeros are an error')
+.sub main
+    $P0 = loadlib 'jsoncodec'
+    $P0 = new ['JSONCodec']
+    $P0.'decode'('01')
+.end
+CODE
+.end
+
+.sub 'test_encode'
+    .local pmc codec, data
+    codec = new ['JSONCodec']
+    data  = codec.'decode'('{"b":[1,2.5,true,null],"a":"x\"\\\n\u0001"}')
+
+    $S0 = codec.'encode'(data)
+    is($S0, '{"a":"x\"\\\n\u0001","b":[1,2.5,true,null]}', 'encode sorts keys and escapes strings')
+    $S0 = codec.'encode'('plain')
+    is($S0, '"plain"', 'encode a string')
+
+    throws_like(<<'CODE', 'cyclic', 'cyclic data is refused')
+.sub main
+    $P0 = loadlib 'jsoncodec'
+    $P1 = new ['JSONCodec']
+    $P0 = new 'ResizablePMCArray'
+    push $P0, $P0
+    $P1.'encode'($P0)
+.end
+CODE
+.end
+
+.sub 'test_encode_pretty'
+    .local pmc codec, data
+    load_bytecode 'JSON.pbc'
+    codec = new ['JSONCodec']
+    data  = codec.'decode'('{"list":[1,[],{"k":"v","e":{}}],"n":null,"empty":[]}')
+
+    $S0 = codec.'encode'(data, 1)
+    $S1 = _json(data, 1)
+    is($S0, $S1, 'pretty text is laid out like _json')
+    $S0 = codec.'encode'(data)
+    $S1 = _json(data)
+    is($S0, $S1, '... and so is the compact text')
+.end
+
+# Local Variables:
+#   mode: pir
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4 ft=pir:
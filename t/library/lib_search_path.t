@@ -8,7 +8,9 @@ use lib qw(lib);
 use Test::More;
 use Parrot::Config;
 use Parrot::Test;
-plan tests => 7;
+use File::Temp qw(tempdir);
+use File::Spec;
+plan tests => 9;
 
 =head1 NAME
 
@@ -174,6 +176,111 @@ CODE
 loaded
 OUTPUT
 
+# resolved names are cached per search path, and the cache must notice
+# changes made to the search path arrays directly
+my @probe_dirs = map { tempdir( CLEANUP => 1 ) } 1 .. 2;
+for my $i (0 .. 1) {
+    my $file = File::Spec->catfile( $probe_dirs[$i], 'lsp_probe.pasm' );
+    open my $fh, '>', $file or die "Can't write $file: $!";
+    print $fh ".macro_const PROBE_DIR $i\n";
+    close $fh;
+}
+
+pir_output_is( <<"CODE", <<'OUTPUT', "resolved include names follow search path changes" );
+.include 'iglobals.pasm'
+.include 'libpaths.pasm'
+
+.sub main :main
+    .local pmc interp, paths
+    getinterp interp
+    paths = interp[.IGLOBALS_LIB_PATHS]
+    paths = paths[.PARROT_LIB_PATH_INCLUDE]
+
+    unshift paths, '$probe_dirs[0]/'
+    probe()
+    probe()
+    unshift paths, '$probe_dirs[1]/'
+    probe()
+    \$S0 = shift paths
+    probe()
+.end
+
+.sub probe
+    .local pmc pir
+    pir = compreg 'PIR'
+    \$P0 = pir(<<'PROBE')
+.include 'lsp_probe.pasm'
+.sub probe_dir
+    say .PROBE_DIR
+.end
+PROBE
+    \$P1 = \$P0.'first_sub_in_const_table'()
+    \$P1()
+.end
+CODE
+0
+0
+1
+0
+OUTPUT
+
+# a name found through a relative search path means something else once the
+# working directory changes
+my @cwd_dirs = map { tempdir( CLEANUP => 1 ) } 1 .. 2;
+my %cwd_probes = (
+    File::Spec->catfile( $cwd_dirs[0], 'second' ) => 0,
+    File::Spec->catfile( $cwd_dirs[1], 'first' )  => 1,
+    File::Spec->catfile( $cwd_dirs[1], 'second' ) => 2,
+);
+while ( my ( $dir, $value ) = each %cwd_probes ) {
+    mkdir $dir or die "Can't create $dir: $!";
+    my $file = File::Spec->catfile( $dir, 'lsp_cwd_probe.pasm' );
+    open my $fh, '>', $file or die "Can't write $file: $!";
+    print $fh ".macro_const PROBE_DIR $value\n";
+    close $fh;
+}
+
+pir_output_is( <<"CODE", <<'OUTPUT', "resolved include names follow the working directory" );
+.include 'iglobals.pasm'
+.include 'libpaths.pasm'
+
+.sub main :main
+    .local pmc interp, paths, os
+    .local string start
+    getinterp interp
+    paths = interp[.IGLOBALS_LIB_PATHS]
+    paths = paths[.PARROT_LIB_PATH_INCLUDE]
+    os    = new ['OS']
+    start = os.'cwd'()
+
+    unshift paths, 'second/'
+    unshift paths, 'first/'
+    os.'chdir'('$cwd_dirs[0]')
+    probe()
+    os.'chdir'('$cwd_dirs[1]')
+    probe()
+    os.'chdir'(start)
+    \$S0 = shift paths
+    \$S0 = shift paths
+.end
+
+.sub probe
+    .local pmc pir
+    pir = compreg 'PIR'
+    \$P0 = pir(<<'PROBE')
+.include 'lsp_cwd_probe.pasm'
+.sub probe_dir
+    say .PROBE_DIR
+.end
+PROBE
+    \$P1 = \$P0.'first_sub_in_const_table'()
+    \$P1()
+.end
+CODE
+0
+1
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -18,12 +18,13 @@ Test various use cases of the annotate directive.
 .sub main :main
     .include 'test_more.pir'
 
-    plan(33)
+    plan(35)
 
     'no_annotations'()
     'annotations_exception'()
     'annotations_ops'()
     'backtrace_annotations'()
+    'backtrace_handler_frame'()
     'parrotinterpreter_annotations'()
     'eval_test'()
 .end
@@ -166,6 +167,30 @@ Test various use cases of the annotate directive.
 .end
 
 
+.sub 'backtrace_handler_frame'
+    .annotate 'file', 'handler.p6'
+    .annotate 'line', 10
+    push_eh failed
+    'baz'()
+
+  failed:
+    .local pmc exception, bt, frame, ann
+    pop_eh
+    .get_results (exception)
+    .annotate 'line', 20
+    bt = exception.'backtrace'()
+    frame = bt[1]
+    ann = frame["annotations"]
+    $I0 = ann["line"]
+    is ($I0, 10, 'handler frame keeps the line it called from')
+
+    bt = exception.'backtrace_strings'()
+    $S0 = bt[0]
+    $I0 = index $S0, '(handler.p6:10)'
+    $I0 = $I0 >= 0
+    ok ($I0, 'backtrace string keeps the line the handler frame called from')
+.end
+
 .sub 'parrotinterpreter_annotations'
     .annotate 'file', 'answer.p6'
     .annotate 'line', 42
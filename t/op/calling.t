@@ -6,7 +6,7 @@ use warnings;
 use lib qw( . lib ../lib ../../lib );
 
 use Test::More;
-use Parrot::Test tests => 104;
+use Parrot::Test tests => 106;
 
 =head1 NAME
 
@@ -2674,6 +2674,63 @@ CODE
 /Null PMC access/
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', "same sub called with matching and coerced arguments" );
+.sub main :main
+    $P0 = box 1
+    $I0 = 0
+  loop:
+    foo($P0, 'a')
+    foo(2, 'b')
+    foo($P0, $P0)
+    inc $I0
+    if $I0 < 2 goto loop
+.end
+
+.sub foo
+    .param pmc x
+    .param string s
+    $S0 = typeof x
+    print $S0
+    print ' '
+    print x
+    print ' '
+    say s
+.end
+CODE
+Integer 1 a
+Integer 2 b
+Integer 1 1
+Integer 1 a
+Integer 2 b
+Integer 1 1
+OUTPUT
+
+pir_output_is( <<'CODE', <<'OUTPUT', "deep self tailcall with multiple returns" );
+.sub main :main
+    ($I0, $S0) = 'count'(0, 200000)
+    print $I0
+    print ' '
+    say $S0
+    ($I0, $S0) = 'count'(5, 3)
+    print $I0
+    print ' '
+    say $S0
+.end
+
+.sub 'count'
+    .param int i
+    .param int n
+    if i < n goto more
+    .return (i, 'done')
+  more:
+    inc i
+    .tailcall 'count'(i, n)
+.end
+CODE
+200000 done
+5 done
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
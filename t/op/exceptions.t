@@ -5,7 +5,7 @@ use strict;
 use warnings;
 use lib qw( . lib ../lib ../../lib );
 use Test::More;
-use Parrot::Test tests => 32,
+use Parrot::Test tests => 33,
     qw[run_command slurp_file];
 use Parrot::Test::Util 'create_tempfile';
 
@@ -778,6 +778,46 @@ WX2
         "user-level backtraces the same as automatically generated backtraces");
 }
 
+pir_output_is( <<'CODE', <<'OUTPUT', "push_eh label - pop_eh in a loop, catching sometimes" );
+.sub main :main
+    .local pmc seen, ex, eh
+    seen = new ['ResizablePMCArray']
+    $I0 = 0
+  loop:
+    push_eh catch
+    if $I0 == 2 goto throw
+    if $I0 == 4 goto throw
+    pop_eh
+    goto next
+  throw:
+    die "thrown"
+  catch:
+    .get_results(ex)
+    pop_eh
+    eh = getattribute ex, 'handler'
+    push seen, eh
+    $S0 = ex
+    print $S0
+    print " "
+    say $I0
+  next:
+    inc $I0
+    if $I0 < 6 goto loop
+
+    $P0 = seen[0]
+    $P1 = seen[1]
+    $I0 = issame $P0, $P1
+    say $I0
+    $I0 = count_eh
+    say $I0
+.end
+CODE
+thrown 2
+thrown 4
+0
+0
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
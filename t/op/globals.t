@@ -15,7 +15,7 @@ Tests the C<get_global> and C<set_global> operations.
 
 =cut
 
-.const int TESTS = 12
+.const int TESTS = 21
 
 .namespace []
 
@@ -32,6 +32,8 @@ Tests the C<get_global> and C<set_global> operations.
     find_null_global()
     get_hll_global_not_found()
     find_store_with_key()
+    repeated_lookups_see_changes()
+    native_stores_through_namespace()
 .end
 
 .namespace []
@@ -152,6 +154,76 @@ Tests the C<get_global> and C<set_global> operations.
     set_hll_global [ "Monkey2"; "Toaster" ], "Explosion", $P0
 .end
 
+.namespace []
+.sub 'repeated_lookups_see_changes'
+    .local pmc ns, seen
+    ns   = get_namespace
+    seen = new ['ResizablePMCArray']
+
+    $I0 = 0
+  loop:
+    $P0 = get_global 'Changing'
+    push seen, $P0
+    if $I0 == 0 goto store_first
+    if $I0 == 1 goto store_second
+    if $I0 == 2 goto delete_it
+    if $I0 == 3 goto store_direct
+    goto done
+  store_first:
+    $P1 = box 'first'
+    set_global 'Changing', $P1
+    goto next
+  store_second:
+    $P1 = box 'second'
+    set_global 'Changing', $P1
+    goto next
+  delete_it:
+    ns.'del_var'('Changing')
+    goto next
+  store_direct:
+    $P1 = box 'third'
+    ns['Changing'] = $P1
+  next:
+    inc $I0
+    goto loop
+  done:
+
+    $P0 = seen[0]
+    $I1 = isnull $P0
+    ok($I1, 'repeated lookup: not there yet')
+    $P0 = seen[1]
+    is($P0, 'first', 'repeated lookup: sees set_global')
+    $P0 = seen[2]
+    is($P0, 'second', 'repeated lookup: sees the global replaced')
+    $P0 = seen[3]
+    $I1 = isnull $P0
+    ok($I1, 'repeated lookup: sees the global deleted')
+    $P0 = seen[4]
+    is($P0, 'third', 'repeated lookup: sees a store through the NameSpace')
+.end
+
+.sub 'native_stores_through_namespace'
+    .local pmc ns
+    ns = get_namespace
+
+    # the first lookup caches the miss
+    $P0 = get_global 'Native'
+    $I0 = isnull $P0
+    ok($I0, 'native store: not there yet')
+
+    ns['Native'] = 42
+    $P0 = get_global 'Native'
+    is($P0, 42, 'native store: sees an integer stored through the NameSpace')
+
+    ns['Native'] = 2.5
+    $P0 = get_global 'Native'
+    is($P0, 2.5, 'native store: sees a number stored through the NameSpace')
+
+    ns['Native'] = 'native'
+    $P0 = get_global 'Native'
+    is($P0, 'native', 'native store: sees a string stored through the NameSpace')
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
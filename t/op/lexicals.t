@@ -13,7 +13,7 @@ $ENV{TEST_PROG_ARGS} ||= '';
 plan( skip_all => 'lexicals not thawed properly from PBC, GH #430' )
     if $ENV{TEST_PROG_ARGS} =~ /--run-pbc/;
 
-plan( tests => 54 );
+plan( tests => 55 );
 
 =head1 NAME
 
@@ -1644,6 +1644,40 @@ Starobrno
 Pilsner Urquell
 OUTPUT
 
+pir_output_is( <<'CODE', <<'OUTPUT', 'lexicals two :outer levels out, after the outer returned' );
+.sub main :main
+    .lex 'n', $I0
+    $I0 = 10
+    $P0 = 'middle'()
+    $P0()
+    $P0()
+    $I1 = find_lex 'n'
+    say $I1
+.end
+.sub 'middle' :outer('main')
+    .lex 's', $S0
+    $S0 = 'count'
+    .const 'Sub' inner = 'inner'
+    $P0 = newclosure inner
+    .return ($P0)
+.end
+.sub 'inner' :outer('middle')
+    $I0 = find_lex 'n'
+    inc $I0
+    store_lex 'n', $I0
+    $S0 = find_lex 's'
+    $S0 .= '!'
+    store_lex 's', $S0
+    print $S0
+    print ' '
+    say $I0
+.end
+CODE
+count! 11
+count!! 12
+12
+OUTPUT
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4
@@ -18,7 +18,7 @@ Tests the CallContext PMC.
 .sub 'main' :main
     .include 'test_more.pir'
 
-    plan(65)
+    plan(71)
 
     test_instantiate()
     test_get_set_attrs()
@@ -31,6 +31,8 @@ Tests the CallContext PMC.
     test_clone()
     test_short_sign()
     test_named_args('Int' => 10, 'Num' => 3.14, 'Str' => 'A String', 'Pmc' => 'A String PMC')
+    test_escaped_frames()
+    test_exception_results()
 .end
 
 .sub 'test_instantiate'
@@ -353,6 +355,114 @@ second_eh:
     is( p, 'A String PMC', 'set/get_pmc_keyed_str' )
 .end
 
+
+# Returned frames may be recycled for later calls; frames which were
+# exposed before returning must survive intact.
+.sub 'test_escaped_frames'
+    .local pmc sig, ctx
+    sig = 'keep_call_sig'(1, 'two')
+    'churn'()
+    $P0 = 'keep_call_sig'(3)
+    $I0 = issame sig, $P0
+    is($I0, 0, 'call_sig kept after return is not reused')
+    $P0 = 'keep_call_sig'(4)
+    $I0 = issame sig, $P0
+    is($I0, 0, '... by any later call')
+
+    ctx = 'keep_context'()
+    'churn'()
+    $P0 = getattribute ctx, 'current_sub'
+    $S0 = $P0
+    is($S0, 'keep_context', 'exposed context kept after return')
+
+    $I0 = 'call_twice'()
+    is($I0, 2, 'return continuation captured by callee can be reinvoked')
+.end
+
+.sub 'keep_call_sig'
+    .param pmc sig :call_sig
+    .return (sig)
+.end
+
+.sub 'keep_context'
+    $P0 = getinterp
+    $P1 = $P0['context']
+    .return ($P1)
+.end
+
+.sub 'churn'
+    $I0 = 0
+  loop:
+    'leaf'($I0)
+    inc $I0
+    if $I0 < 10 goto loop
+.end
+
+.sub 'leaf'
+    .param int i
+    .return (i)
+.end
+
+.sub 'call_twice'
+    .local int count
+    count = 0
+    $P0 = 'capture_cc'()
+    inc count
+    'churn'()
+    if count >= 2 goto done
+    $P0()
+  done:
+    .return (count)
+.end
+
+.sub 'capture_cc'
+    .include 'interpinfo.pasm'
+    $P0 = interpinfo .INTERPINFO_CURRENT_CONT
+    .return ($P0)
+.end
+
+# The signature that hands a caught exception to get_results is not a
+# returned frame and must not be recycled as one.
+.sub 'test_exception_results'
+    .local int i, sum, caught
+    i      = 0
+    sum    = 0
+    caught = 0
+  loop:
+    push_eh handler
+    $I0 = 'throw_and_resume'(i)
+    sum += $I0
+    pop_eh
+    inc i
+    if i < 50 goto loop
+    is(caught, 50, 'get_results sees every thrown exception')
+    is(sum, 1275, 'resumed callers return normally')
+    .return ()
+
+  handler:
+    .local pmc ex, resume
+    .get_results (ex)
+    $P0 = ex['payload']
+    $I0 = $P0
+    if $I0 != i goto skip
+    inc caught
+  skip:
+    'churn'()
+    resume = ex['resume']
+    resume()
+.end
+
+.sub 'throw_and_resume'
+    .param int n
+    $P0 = new ['Exception']
+    $P1 = box n
+    $P0['payload'] = $P1
+    throw $P0
+    $I0 = 'leaf'(n)
+    inc $I0
+    .return ($I0)
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
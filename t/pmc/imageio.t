@@ -17,8 +17,9 @@ Tests the ImageIO PMC.
 
 .sub main :main
     .include 'test_more.pir'
+    .include 'hash_key_type.pasm'
 
-    plan(12)
+    plan(24)
 
     .local pmc frz, thw
     frz = new ['ImageIOFreeze']
@@ -57,6 +58,143 @@ Tests the ImageIO PMC.
     $P1 = thaw $S1
     is_deeply($P0, $P1, 'thaw gives same PMC as ImageIO (aggregate)')
     is_deeply($P0, test_pmc, 'round trip gives same PMC (aggregate)')
+
+    'test_stream'()
+    'test_shared_strings'()
+    'test_collect_while_thawing'()
+.end
+
+.sub test_collect_while_thawing
+    .local pmc list, junk, thw, got
+    .local int i, n, bad
+    n = 0
+  again:
+    # the image shares a block with strings dropped before the thaw, so
+    # compacting may move it
+    junk = new ['ResizableStringArray']
+    list = new ['ResizableStringArray']
+    i = 0
+  fill:
+    $S0 = i
+    $S0 = concat 'junk string to be dropped ', $S0
+    push junk, $S0
+    $I0 = i % 50
+    if $I0 goto next
+    $S0 = concat 'kept ', $S0
+    push list, $S0
+  next:
+    inc i
+    if i < 5000 goto fill
+    $S1 = freeze list
+    null junk
+    # unlike the thaw op, the PMC leaves the GC running
+    thw = new ['ImageIOThaw']
+    thw = $S1
+    got = deref thw
+    inc n
+    if n < 20 goto again
+
+    bad = 0
+    i   = 0
+  check:
+    $S2 = got[i]
+    $S3 = list[i]
+    if $S2 == $S3 goto ok
+    inc bad
+  ok:
+    inc i
+    if i < 100 goto check
+    is(bad, 0, 'thaw as the GC runs and compacts')
+.end
+
+.sub test_shared_strings
+    .local pmc h, ih, got, got_ih
+    h = new ['Hash']
+    h['plain'] = 'value'
+    h['empty'] = ''
+    $S0 = utf8:"\x{263a} smile"
+    h[$S0] = utf8:"caf\x{e9}"
+    ih = new ['Hash']
+    ih.'set_key_type'(.Hash_key_type_int)
+    ih[42] = 'forty-two'
+    ih[-7] = 'minus seven'
+    push_eh nok_shared
+    $P0 = new ['ResizablePMCArray']
+    push $P0, h
+    push $P0, ih
+    $S1 = freeze $P0
+    $P1 = thaw $S1
+    got = $P1[0]
+    got_ih = $P1[1]
+    # move the thawed strings' shared buffer around
+    $S1 = ''
+    sweep 1
+    collect
+    $S2 = got['plain']
+    is($S2, 'value', 'thawed string sharing the image survives a collection')
+    $S2 = got['empty']
+    is($S2, '', 'thawed empty string')
+    $S2 = got[$S0]
+    $I0 = length $S2
+    is($I0, 4, 'thawed utf8 key and value keep their encoding')
+    $S2 = got_ih[42]
+    is($S2, 'forty-two', 'thawed integer-keyed hash (positive key)')
+    $S2 = got_ih[-7]
+    is($S2, 'minus seven', 'thawed integer-keyed hash (negative key)')
+    pop_eh
+    .return ()
+  nok_shared:
+    pop_eh
+    ok(0, 'thaw with shared strings threw')
+.end
+
+.sub test_stream
+    .local pmc sh, test_pmc, big, got, got2
+    test_pmc = 'get_test_aggregate'()
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    freeze sh, test_pmc
+    sh.'close'()
+    sh.'open'('image', 'r')
+    $S0 = sh.'readall'()
+    sh.'close'()
+    $S1 = freeze test_pmc
+    is($S0, $S1, 'freezing to a handle writes the same image')
+
+    # larger than one chunk, with floats and a cycle
+    big = new ['ResizablePMCArray']
+    $I0 = 0
+  fill:
+    $S0 = $I0
+    $S0 = concat 'item ', $S0
+    push big, $S0
+    $N0 = $I0 / 4.0
+    push big, $N0
+    inc $I0
+    if $I0 < 2000 goto fill
+    push big, big
+
+    sh = new ['StringHandle']
+    sh.'encoding'('binary')
+    sh.'open'('image', 'w')
+    freeze sh, big
+    freeze sh, test_pmc
+    sh.'close'()
+    sh.'open'('image', 'r')
+    thaw got, sh
+    thaw got2, sh
+
+    $I0 = elements got
+    is($I0, 4001, 'thaw from a handle (large aggregate)')
+    $S0 = got[3998]
+    is($S0, 'item 1999', 'strings survive a streamed round trip')
+    $N0 = got[3999]
+    is($N0, 499.75, 'floats survive a streamed round trip')
+    $P0 = got[4000]
+    $I0 = issame $P0, got
+    ok($I0, 'cycles survive a streamed round trip')
+    is_deeply(got2, test_pmc, 'second image on the same handle thaws')
 .end
 
 .sub get_test_simple
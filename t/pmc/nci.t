@@ -38,7 +38,7 @@ SKIP: {
     unless ( -e "runtime/parrot/dynext/libnci_test$PConfig{load_ext}" ) {
         plan skip_all => "Please make libnci_test$PConfig{load_ext}";
     }
-    plan tests => 61;
+    plan tests => 62;
 
     pir_output_is( << 'CODE', << 'OUTPUT', 'load library fails' );
 .sub test :main
@@ -2414,6 +2414,50 @@ ok 2
 ok 3
 OUTPUT
 
+SKIP:
+    {
+
+        skip( "needs the libffi frame builder", 1 ) unless $PConfig{HAS_LIBFFI};
+
+        # no precompiled thunk has this signature, so libffi builds one
+        pir_output_is( << 'CODE', << 'OUTPUT', "libffi thunk with direct and coerced args" );
+.sub test :main
+    .local pmc libnci_test, nci_NN, other
+    libnci_test = loadlib "libnci_test"
+    nci_NN = dlfunc libnci_test, "nci_dd", "NN"
+    other  = dlfunc libnci_test, "nci_dd", "NN"
+
+    $N0 = nci_NN(1.5)
+    say $N0
+    $N0 = nci_NN(3)
+    say $N0
+    $P0 = box 4.25
+    $N0 = other($P0)
+    say $N0
+
+    push_eh too_many
+    $N0 = nci_NN(1.0, 2.0)
+    say "no exception"
+  too_many:
+    pop_eh
+
+    $N1 = 0.0
+    $I0 = 0
+  loop:
+    $N0 = nci_NN(0.5)
+    $N1 += $N0
+    inc $I0
+    if $I0 < 1000 goto loop
+    say $N1
+.end
+CODE
+3
+6
+8.5
+1000
+OUTPUT
+    }
+
 }    # SKIP
 
 pir_output_is( << 'CODE', << 'OUTPUT', "opcode 'does'" );
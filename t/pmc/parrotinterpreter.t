@@ -21,7 +21,7 @@ Tests the ParrotInterpreter PMC.
 .sub main :main
 .include 'test_more.pir'
 
-    plan(14)
+    plan(21)
     test_new()      # 1 test
     test_hll_map()  # 3 tests
     test_hll_map_invalid()  # 1 tests
@@ -29,6 +29,7 @@ Tests the ParrotInterpreter PMC.
 # Need for testing
 .annotate 'foo', 'bar'
     test_inspect()  # 9 tests
+    test_seal()     # 7 tests
 .end
 
 .sub test_new
@@ -140,6 +141,105 @@ Tests the ParrotInterpreter PMC.
 
 .end
 
+.sub test_seal
+    .local pmc interp, config, list, sealed, task, args
+    interp = getinterp
+
+    list = new ['ResizablePMCArray']
+    push list, 'alpha'
+    push list, 3.5
+    config = new ['Hash']
+    config['answer'] = 42
+    config['list'] = list
+    $S0 = 'a substring of a longer string'
+    $S0 = substr $S0, 2, 9
+    config['sub'] = $S0
+
+    sealed = interp.'seal'(config)
+    $I0 = issame sealed, config
+    ok($I0, 'seal returns the sealed data')
+
+    sweep 1
+    collect
+    $I0 = config['answer']
+    $S0 = config['sub']
+    $S1 = list[0]
+    $S0 = $S0 . $S1
+    is($S0, 'substringalpha', 'sealed data stays readable')
+
+    $I0 = 0
+    push_eh write_caught
+    config['answer'] = 43
+    goto write_done
+  write_caught:
+    $I0 = 1
+  write_done:
+    pop_eh
+    ok($I0, 'writing to a sealed hash throws')
+
+    $I0 = 0
+    push_eh nested_caught
+    push list, 'omega'
+    goto nested_done
+  nested_caught:
+    $I0 = 1
+  nested_done:
+    pop_eh
+    ok($I0, 'writing to data reachable from a sealed hash throws')
+
+    $I0 = 0
+    push_eh unseal_caught
+    $P0 = new ['Integer']
+    setprop config, '_ro', $P0
+    goto unseal_done
+  unseal_caught:
+    $I0 = 1
+  unseal_done:
+    pop_eh
+    ok($I0, 'sealed data cannot be made writable again')
+
+    $P1 = new ['Hash']
+    $P0 = get_global 'test_seal'
+    $P1['code'] = $P0
+    $I0 = 0
+    push_eh sub_caught
+    interp.'seal'($P1)
+    goto sub_done
+  sub_caught:
+    $I0 = 1
+  sub_done:
+    pop_eh
+    $P1['more'] = 1
+    ok($I0, 'subs cannot be sealed, and the data stays writable')
+
+    # the task runs in a thread interpreter, which would see an unsealed
+    # Hash only through a Proxy without the _ro property
+    args = new ['Hash']
+    $P0 = get_global 'sealed_task'
+    args['code'] = $P0
+    args['data'] = config
+    task = new ['Task'], args
+    schedule task
+    wait task
+.end
+
+.sub sealed_task
+    .param pmc config
+    $P0 = getprop config, '_ro'
+    if null $P0 goto fail
+    $I0 = config['answer']
+    if $I0 != 42 goto fail
+    push_eh ok
+    config['answer'] = 0
+    pop_eh
+  fail:
+    say "not ok 21 - task shares sealed data without copying"
+    .return ()
+  ok:
+    pop_eh
+    say "ok 21 - task shares sealed data without copying"
+.end
+
 # Local Variables:
 #   mode: pir
 #   fill-column: 100
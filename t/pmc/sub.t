@@ -1052,7 +1052,12 @@ CODE
 0101
 OUTPUT
 
-pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
+{
+    # the counts are those of the allocator used without -O
+    local $ENV{TEST_PROG_ARGS} = $ENV{TEST_PROG_ARGS};
+    $ENV{TEST_PROG_ARGS} =~ s/(?:^|\s)-O\S*//g;
+
+    pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
 .sub main :main
     foo()
 .end
@@ -1080,6 +1085,7 @@ pir_output_is( <<'CODE', <<'OUTPUT', "__get_regs_used 2" );
 CODE
 2301
 OUTPUT
+}
 
 pir_output_like( <<"CODE", <<'OUTPUT', 'warn on in main' );
 .sub 'test' :main
@@ -0,0 +1,96 @@
+#! perl
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+t/profiling/sampling.t - test the sampling runcore
+
+=head1 SYNOPSIS
+
+    % prove t/profiling/sampling.t
+
+=head1 DESCRIPTION
+
+Runs a busy PIR program under C<-R sampling> and checks the folded and pprof
+profiles it writes, and that bad settings are refused.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 7;
+use Parrot::Config;
+use File::Spec;
+use Parrot::Test::Util 'create_tempfile';
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+my $devnull = File::Spec->devnull;
+
+my $pir = <<'PIR';
+.namespace ['Samp']
+.sub main :main
+    spin(3000000)
+.end
+
+.sub spin
+    .param int n
+    $I0 = 0
+  loop:
+    inc $I0
+    if $I0 < n goto loop
+.end
+PIR
+
+my ( $pir_fh, $pir_file ) = create_tempfile( SUFFIX => '.pir', UNLINK => 1 );
+print $pir_fh $pir;
+close $pir_fh;
+
+my ( undef, $out_file ) = create_tempfile( UNLINK => 1 );
+
+sub run_sampled {
+    my (%env) = @_;
+    local $ENV{PARROT_SAMPLING_FILENAME} = $out_file;
+    local $ENV{PARROT_SAMPLING_INTERVAL} = $env{interval} || 1;
+    local $ENV{PARROT_SAMPLING_OUTPUT}   = $env{output} || 'folded';
+    my $rc = system(qq|$PARROT -R sampling $pir_file > $devnull 2> $devnull|) >> 8;
+
+    open my $fh, '<', $out_file or return ( $rc, '' );
+    local $/;
+    my $profile = <$fh>;
+    close $fh;
+    return ( $rc, $profile );
+}
+
+my ( $rc, $profile ) = run_sampled( output => 'folded' );
+is( $rc, 0, 'sampled program exits normally' );
+like( $profile, qr/(?:^|;)parrot::Samp::main;parrot::Samp::spin [1-9]\d*$/m,
+    'folded stack shows spin called from main' );
+unlike( $profile, qr/^(?!\S+ \d+$).+$/m, 'every folded line is a stack and a count' );
+
+( $rc, $profile ) = run_sampled( output => 'pprof' );
+like( $profile, qr/\AVERSION:2\n/, 'pprof profile starts with its version' );
+like( $profile,
+    qr/^CS:\{x\{ns:parrot;Samp;spin\}x\}.*\nOP:\{x\{line:\d+\}x\}\{x\{time:[1-9]\d*\}x\}/m,
+    'pprof profile charges sampled time to spin' );
+
+{
+    local $ENV{PARROT_SAMPLING_OUTPUT} = 'bogus';
+    isnt( system(qq|$PARROT -R sampling $pir_file > $devnull 2> $devnull|) >> 8, 0,
+        'bad output format is refused' );
+}
+
+{
+    local $ENV{PARROT_SAMPLING_INTERVAL} = 0;
+    isnt( system(qq|$PARROT -R sampling $pir_file > $devnull 2> $devnull|) >> 8, 0,
+        'zero sampling interval is refused' );
+}
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
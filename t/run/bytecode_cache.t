@@ -0,0 +1,114 @@
+#! perl
+# Copyright (C) 2012, Parrot Foundation.
+
+=head1 NAME
+
+t/run/bytecode_cache.t - test the PARROT_BYTECODE_CACHE directory
+
+=head1 SYNOPSIS
+
+    % prove t/run/bytecode_cache.t
+
+=head1 DESCRIPTION
+
+Runs PIR files with C<PARROT_BYTECODE_CACHE> set and checks that a second run
+reuses the cached bytecode, that changing an included file compiles afresh,
+that code with C<:immediate> subs isn't cached, and that macros defined by a
+cached compilation are still there for later ones.
+
+=cut
+
+use strict;
+use warnings;
+use lib qw( . lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test tests => 10;
+use Parrot::Config;
+use File::Spec;
+use File::Temp qw(tempdir);
+
+my $PARROT = ".$PConfig{slash}$PConfig{test_prog}";
+my $dir    = tempdir( CLEANUP => 1 );
+my $cache  = File::Spec->catdir( $dir, 'cache' );
+
+sub write_file {
+    my ( $name, $text ) = @_;
+    my $path = File::Spec->catfile( $dir, $name );
+    open my $fh, '>', $path or die "Cannot write $path: $!";
+    print $fh $text;
+    close $fh;
+    return $path;
+}
+
+sub run_cached {
+    my $file = shift;
+    local $ENV{PARROT_BYTECODE_CACHE} = $cache;
+    return scalar qx{$PARROT $file 2>&1};
+}
+
+sub entries {
+    opendir my $dh, $cache or return ();
+    my @entries = sort grep { /\.pbc\z/ } readdir $dh;
+    closedir $dh;
+    return @entries;
+}
+
+my $inc = write_file( 'answer.pir', ".macro_const ANSWER 42\n" );
+my $pir = write_file( 'main.pir', <<"CODE" );
+.include '$inc'
+.sub main :main
+    say .ANSWER
+.end
+CODE
+
+is( run_cached($pir), "42\n", 'first run compiles' );
+my @first = entries();
+is( scalar @first, 1, '... and caches the bytecode' );
+
+my $pbc   = File::Spec->catfile( $cache, $first[0] );
+my $mtime = ( stat $pbc )[9];
+utime $mtime - 10, $mtime - 10, $pbc;
+
+is( run_cached($pir), "42\n", 'second run' );
+is_deeply( [ entries() ], \@first, '... reuses the entry' );
+is( ( stat $pbc )[9], $mtime - 10, '... without rewriting it' );
+
+write_file( 'answer.pir', ".macro_const ANSWER 43\n" );
+is( run_cached($pir), "43\n", 'changing an included file recompiles' );
+is( scalar entries(), 2, '... into a new entry' );
+
+my $immediate = write_file( 'immediate.pir', <<'CODE' );
+.sub setup :anon :immediate
+    $P0 = subclass 'ResizablePMCArray', 'CacheStack'
+.end
+.sub main :main
+    $P0 = new 'CacheStack'
+    $S0 = typeof $P0
+    say $S0
+.end
+CODE
+
+run_cached($immediate);
+is( run_cached($immediate), "CacheStack\n", ':immediate subs run on every compile' );
+is( scalar entries(), 2, '... as such code is not cached' );
+
+my $macros = write_file( 'macros.pir', <<'CODE' );
+.sub main :main
+    $P0 = compreg 'PIR'
+    $P0.'compile'(".macro_const LATER 7\n")
+    $P1 = $P0.'compile'(".sub f\n say .LATER\n.end\n")
+    $P2 = get_global 'f'
+    $P2()
+.end
+CODE
+
+run_cached($macros);
+is( run_cached($macros), "7\n", 'macros from a cached compilation stay defined' );
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
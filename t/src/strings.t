@@ -0,0 +1,118 @@
+#!perl
+# Copyright (C) 2013, Parrot Foundation.
+
+use strict;
+use warnings;
+
+use lib qw(. lib ../lib ../../lib );
+
+use Test::More;
+use Parrot::Test;
+use Parrot::Config;
+use File::Spec::Functions;
+
+my $parrot_config = "parrot_config" . $PConfig{o};
+
+plan skip_all => 'src/parrot_config.o does not exist' unless -e catfile("src", $parrot_config);
+
+=head1 NAME
+
+t/src/strings.t - Parrot STRING interning
+
+=head1 SYNOPSIS
+
+    % prove t/src/strings.t
+
+=head1 DESCRIPTION
+
+Tests the interpreter's table of interned STRINGs.
+
+=cut
+
+plan tests => 2;
+
+c_output_is( <<'CODE', <<'OUTPUT', "interned constants are canonical" );
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+    STRING *a      = Parrot_str_new_constant(interp, "interned_name");
+    STRING *b      = Parrot_str_new_init(interp, "interned_name", 13,
+                        Parrot_default_encoding_ptr, PObj_constant_FLAG);
+
+    printf("%s 1\n", STRING_interned_TEST(a) ? "ok" : "not ok");
+    printf("%s 2\n", a->hashval ? "ok" : "not ok");
+
+    /* an equal constant resolves to the existing canonical STRING */
+    printf("%s 3\n", Parrot_str_intern(interp, b) == a ? "ok" : "not ok");
+    printf("%s 4\n", STRING_interned_TEST(b) ? "not ok" : "ok");
+
+    /* interning is idempotent */
+    printf("%s 5\n", Parrot_str_intern(interp, a) == a ? "ok" : "not ok");
+    printf("%s 6\n", Parrot_str_equal(interp, a, a) ? "ok" : "not ok");
+
+    /* copies are never canonical */
+    printf("%s 7\n", STRING_interned_TEST(Parrot_str_copy(interp, a)) ? "not ok" : "ok");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+ok 1
+ok 2
+ok 3
+ok 4
+ok 5
+ok 6
+ok 7
+OUTPUT
+
+c_output_is( <<'CODE', <<'OUTPUT', "only constants are added to the table" );
+
+#include <parrot/parrot.h>
+#include <stdio.h>
+
+int main(int argc, char* argv[])
+{
+    Interp *interp = Parrot_interp_new(NULL);
+    STRING *tmp    = Parrot_str_new(interp, "not_yet_interned", 0);
+    STRING *ascii, *utf8;
+
+    /* a collectable STRING is returned unchanged and not added */
+    printf("%s 1\n", Parrot_str_intern(interp, tmp) == tmp ? "ok" : "not ok");
+    printf("%s 2\n", STRING_interned_TEST(tmp) ? "not ok" : "ok");
+
+    /* once an equal constant exists, the temporary resolves to it */
+    ascii = Parrot_str_new_constant(interp, "not_yet_interned");
+    printf("%s 3\n", Parrot_str_intern(interp, tmp) == ascii ? "ok" : "not ok");
+
+    /* different encodings are interned separately */
+    utf8 = Parrot_str_new_init(interp, "not_yet_interned", 16,
+                Parrot_utf8_encoding_ptr, PObj_constant_FLAG);
+    printf("%s 4\n", Parrot_str_intern(interp, utf8) == utf8 ? "ok" : "not ok");
+    printf("%s 5\n", Parrot_str_equal(interp, ascii, utf8) ? "ok" : "not ok");
+
+    /* null is passed through */
+    printf("%s 6\n", Parrot_str_intern(interp, STRINGNULL) == STRINGNULL ? "ok" : "not ok");
+
+    Parrot_interp_destroy(interp);
+    return 0;
+}
+CODE
+ok 1
+ok 2
+ok 3
+ok 4
+ok 5
+ok 6
+OUTPUT
+
+# Local Variables:
+#   mode: cperl
+#   cperl-indent-level: 4
+#   fill-column: 100
+# End:
+# vim: expandtab shiftwidth=4:
@@ -26,10 +26,11 @@ use Parrot::Config;
 
 my $PARROT    = ".$PConfig{slash}$PConfig{test_prog}";
 my $PBC_MERGE = ".$PConfig{slash}pbc_merge$PConfig{exe}";
+my $PBC_DIS   = ".$PConfig{slash}pbc_disassemble$PConfig{exe}";
 
 # Only test if we have the PBC merge tool built.
 if ( -e $PBC_MERGE ) {
-    plan tests => 5;
+    plan tests => 8;
 }
 else {
     plan skip_all => "PBC Merge tool not built or test disabled";
@@ -47,9 +48,10 @@ sub pir_to_pbc {
 }
 
 sub pbc_merge {
+    my $flags   = $_[0] =~ /^-/ ? shift() . ' ' : '';
     my $outname = "t$PConfig{slash}tools$PConfig{slash}" . shift() . ".pbc";
     my $inputs = join( ' ', map { "t$PConfig{slash}tools$PConfig{slash}$_.pbc" } @_ );
-    system("$PBC_MERGE -o $outname $inputs");
+    system("$PBC_MERGE $flags-o $outname $inputs");
 }
 
 sub run_pbc {
@@ -186,6 +188,106 @@ PIR
     pbc_merge( "pbc_merge_t5", "pbc_merge_t5_1", "pbc_merge_t5_2" );
     is( run_pbc( "pbc_merge_t5" ), "success");
 }
+
+# Sixth test - constants used by several inputs are stored once.
+{
+    pir_to_pbc( "pbc_merge_t6_1", <<'PIR' );
+.sub main :main
+    $N0 = 2.5
+    $P0 = get_hll_global ['T6'], 'half'
+    $N1 = $P0()
+    $N0 += $N1
+    say $N0
+.end
+PIR
+
+    pir_to_pbc( "pbc_merge_t6_2", <<'PIR' );
+.namespace ['T6']
+.sub half
+    $P0 = get_hll_global ['T6'], 'half'
+    .return (2.5)
+.end
+PIR
+    pbc_merge( "pbc_merge_t6", "pbc_merge_t6_1", "pbc_merge_t6_2" );
+    my $dis = `$PBC_DIS t$PConfig{slash}tools$PConfig{slash}pbc_merge_t6.pbc`;
+    my $nums = () = $dis =~ /^NUM_CONST\(\d+\): 2\.5/mg;
+    my $keys = () = $dis =~ /^PMC_CONST\(\d+\): T6$/mg;
+    is( run_pbc("pbc_merge_t6") . "$nums $keys", "5\n1 1", 'shared constants stored once' );
+}
+
+# Seventh test - --strip drops the subs nothing refers to.
+{
+    pir_to_pbc( "pbc_merge_t7_1", <<'PIR' );
+.sub main :main
+    used()
+    $S0 = 'un'
+    $S0 .= 'used'
+    $P0 = get_global $S0
+    if null $P0 goto gone
+    say 'unused kept'
+    .return ()
+  gone:
+    say 'unused stripped'
+.end
+PIR
+
+    pir_to_pbc( "pbc_merge_t7_2", <<'PIR' );
+.sub used
+    say 'used'
+.end
+.sub unused
+    say 'unused'
+.end
+.sub loader :load
+    say 'loader'
+.end
+PIR
+    pbc_merge( "pbc_merge_t7", "pbc_merge_t7_1", "pbc_merge_t7_2" );
+    pbc_merge( "--strip", "pbc_merge_t7s", "pbc_merge_t7_1", "pbc_merge_t7_2" );
+    pir_to_pbc( "pbc_merge_t7_3", <<'PIR' );
+.sub main :main
+    load_bytecode 't/tools/pbc_merge_t7s.pbc'
+.end
+PIR
+    is( run_pbc("pbc_merge_t7") . run_pbc("pbc_merge_t7s") . run_pbc("pbc_merge_t7_3"),
+        "used\nunused kept\nused\nunused stripped\nloader\n", '--strip keeps :load subs' );
+}
+
+# Eighth test - annotations survive merging and stripping.
+{
+    pir_to_pbc( "pbc_merge_t8_1", <<'PIR' );
+.sub main :main
+    push_eh handler
+    failing()
+    pop_eh
+    .return ()
+  handler:
+    .get_results ($P0)
+    $P1 = $P0.'annotations'('file')
+    $P2 = $P0.'annotations'('line')
+    print $P1
+    print ':'
+    say $P2
+.end
+PIR
+
+    pir_to_pbc( "pbc_merge_t8_2", <<'PIR' );
+.sub dropped
+    .annotate 'line', 1
+    say 'dropped'
+.end
+.sub failing
+    .annotate 'file', 'b.pir'
+    .annotate 'line', 7
+    die 'oops'
+.end
+PIR
+    pbc_merge( "pbc_merge_t8", "pbc_merge_t8_1", "pbc_merge_t8_2" );
+    pbc_merge( "-s", "pbc_merge_t8s", "pbc_merge_t8_1", "pbc_merge_t8_2" );
+    is( run_pbc("pbc_merge_t8") . run_pbc("pbc_merge_t8s"), "b.pir:7\nb.pir:7\n",
+        'annotations' );
+}
+
 # Local Variables:
 #   mode: cperl
 #   cperl-indent-level: 4